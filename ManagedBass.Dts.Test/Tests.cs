@@ -164,5 +164,303 @@ namespace ManagedBass.Dts.Test
                 Assert.Fail(string.Format("Failed to free the source stream: {0}", Enum.GetName(typeof(Errors), Bass.LastError)));
             }
         }
+
+        /// <summary>
+        /// Check probing matches the stream.
+        /// </summary>
+        [Test]
+        public void Test004()
+        {
+            var probeInfo = default(DtsProbeInfo);
+            if (!BassDts.Probe(Path.Combine(CurrentDirectory, this.FileName), out probeInfo))
+            {
+                Assert.Fail(string.Format("Failed to probe file: {0}", Enum.GetName(typeof(Errors), Bass.LastError)));
+            }
+
+            var sourceChannel = BassDts.CreateStream(Path.Combine(CurrentDirectory, this.FileName), 0, 0, this.BassFlags);
+            if (sourceChannel == 0)
+            {
+                Assert.Fail(string.Format("Failed to create source stream: {0}", Enum.GetName(typeof(Errors), Bass.LastError)));
+            }
+
+            var channelInfo = default(ChannelInfo);
+            if (!Bass.ChannelGetInfo(sourceChannel, out channelInfo))
+            {
+                Assert.Fail(string.Format("Failed to get stream info: {0}", Enum.GetName(typeof(Errors), Bass.LastError)));
+            }
+
+            Assert.AreEqual(channelInfo.Frequency, probeInfo.Frequency);
+            Assert.AreEqual(channelInfo.Channels, probeInfo.Channels);
+            Assert.Greater(probeInfo.Length, 0);
+
+            if (!Bass.StreamFree(sourceChannel))
+            {
+                Assert.Fail(string.Format("Failed to free the source stream: {0}", Enum.GetName(typeof(Errors), Bass.LastError)));
+            }
+        }
+
+        /// <summary>
+        /// Probe throughput.
+        /// </summary>
+        [Test]
+        public void Test005()
+        {
+            const int Count = 1000;
+            var fileName = Path.Combine(CurrentDirectory, this.FileName);
+            var stopwatch = Stopwatch.StartNew();
+            for (var a = 0; a < Count; a++)
+            {
+                var probeInfo = default(DtsProbeInfo);
+                if (!BassDts.Probe(fileName, out probeInfo))
+                {
+                    Assert.Fail(string.Format("Failed to probe file: {0}", Enum.GetName(typeof(Errors), Bass.LastError)));
+                }
+            }
+            stopwatch.Stop();
+
+            Debug.WriteLine("{0:0} files/second", Count / stopwatch.Elapsed.TotalSeconds);
+        }
+
+        /// <summary>
+        /// Check real-time streams decode without allocating.
+        /// </summary>
+        [Test]
+        public void Test006()
+        {
+            var sourceChannel = BassDts.CreateStream(Path.Combine(CurrentDirectory, this.FileName), 0, 0, this.BassFlags | BassFlags.Decode | BassDts.Realtime);
+            if (sourceChannel == 0)
+            {
+                Assert.Fail(string.Format("Failed to create source stream: {0}", Enum.GetName(typeof(Errors), Bass.LastError)));
+            }
+
+            var buffer = new byte[1024 * 64];
+            while (Bass.ChannelGetData(sourceChannel, buffer, buffer.Length) > 0) ;
+
+            Assert.AreEqual(0, BassDts.GetAllocations(sourceChannel));
+
+            if (!Bass.StreamFree(sourceChannel))
+            {
+                Assert.Fail(string.Format("Failed to free the source stream: {0}", Enum.GetName(typeof(Errors), Bass.LastError)));
+            }
+        }
+
+        /// <summary>
+        /// Check the stage timers and counters of a stream and of the process.
+        /// </summary>
+        [Test]
+        public void Test007()
+        {
+            var sourceChannel = BassDts.CreateStream(Path.Combine(CurrentDirectory, this.FileName), 0, 0, this.BassFlags | BassFlags.Decode);
+            if (sourceChannel == 0)
+            {
+                Assert.Fail(string.Format("Failed to create source stream: {0}", Enum.GetName(typeof(Errors), Bass.LastError)));
+            }
+
+            var buffer = new byte[1024 * 64];
+            while (Bass.ChannelGetData(sourceChannel, buffer, buffer.Length) > 0) ;
+
+            var stats = default(DtsStats);
+            if (!BassDts.GetStats(sourceChannel, out stats))
+            {
+                Assert.Fail(string.Format("Failed to get stream stats: {0}", Enum.GetName(typeof(Errors), Bass.LastError)));
+            }
+
+            Assert.Greater(stats.Frames, 0);
+            Assert.Greater(stats.Stages[DtsStats.FileRead].Calls, 0);
+            Assert.Greater(stats.Stages[DtsStats.Pcm].Calls, 0);
+
+            for (var a = 0; a < DtsStats.StageCount; a++)
+            {
+                if (stats.Stages[a].Calls > 0 && stats.Frequency > 0)
+                {
+                    Debug.WriteLine("Stage {0}: {1:0.000} ms in {2} calls", a, stats.Stages[a].Time * 1000.0 / stats.Frequency, stats.Stages[a].Calls);
+                }
+            }
+
+            if (!Bass.StreamFree(sourceChannel))
+            {
+                Assert.Fail(string.Format("Failed to free the source stream: {0}", Enum.GetName(typeof(Errors), Bass.LastError)));
+            }
+
+            var total = default(DtsStats);
+            if (!BassDts.GetStats(0, out total))
+            {
+                Assert.Fail(string.Format("Failed to get process stats: {0}", Enum.GetName(typeof(Errors), Bass.LastError)));
+            }
+
+            Assert.GreaterOrEqual(total.Frames, stats.Frames);
+        }
+
+        /// <summary>
+        /// Check decoding spans can be exported as a Chrome trace.
+        /// </summary>
+        [Test]
+        public void Test008()
+        {
+            if (!BassDts.TraceStart())
+            {
+                Assert.Fail(string.Format("Failed to start tracing: {0}", Enum.GetName(typeof(Errors), Bass.LastError)));
+            }
+
+            var sourceChannel = BassDts.CreateStream(Path.Combine(CurrentDirectory, this.FileName), 0, 0, this.BassFlags | BassFlags.Decode);
+            if (sourceChannel == 0)
+            {
+                Assert.Fail(string.Format("Failed to create source stream: {0}", Enum.GetName(typeof(Errors), Bass.LastError)));
+            }
+
+            var buffer = new byte[1024 * 64];
+            while (Bass.ChannelGetData(sourceChannel, buffer, buffer.Length) > 0) ;
+
+            if (!Bass.StreamFree(sourceChannel))
+            {
+                Assert.Fail(string.Format("Failed to free the source stream: {0}", Enum.GetName(typeof(Errors), Bass.LastError)));
+            }
+
+            BassDts.TraceStop();
+
+            var trace = BassDts.TraceGet();
+            Assert.IsNotNull(trace);
+            StringAssert.StartsWith("{\"traceEvents\":[", trace);
+            StringAssert.Contains("\"name\":\"dts_file_read\"", trace);
+            StringAssert.Contains("\"name\":\"BASS_DTS_StreamProc\"", trace);
+        }
+
+        /// <summary>
+        /// Check the memory held by a stream is accounted per subsystem.
+        /// </summary>
+        [Test]
+        public void Test009()
+        {
+            var sourceChannel = BassDts.CreateStream(Path.Combine(CurrentDirectory, this.FileName), 0, 0, this.BassFlags | BassFlags.Decode);
+            if (sourceChannel == 0)
+            {
+                Assert.Fail(string.Format("Failed to create source stream: {0}", Enum.GetName(typeof(Errors), Bass.LastError)));
+            }
+
+            var buffer = new byte[1024 * 64];
+            while (Bass.ChannelGetData(sourceChannel, buffer, buffer.Length) > 0) ;
+
+            var memory = default(DtsMemory);
+            if (!BassDts.GetMemory(sourceChannel, out memory))
+            {
+                Assert.Fail(string.Format("Failed to get stream memory: {0}", Enum.GetName(typeof(Errors), Bass.LastError)));
+            }
+
+            Assert.Greater(memory.Accounts[DtsMemory.Core].Live, 0);
+            Assert.Greater(memory.Accounts[DtsMemory.File].Live, 0);
+            Assert.GreaterOrEqual(memory.Accounts[DtsMemory.Total].Peak, memory.Accounts[DtsMemory.Total].Live);
+            Assert.Greater(memory.Size, memory.Accounts[DtsMemory.Total].Live);
+
+            for (var a = 0; a < DtsMemory.AccountCount; a++)
+            {
+                Debug.WriteLine("Account {0}: {1} bytes, {2} peak, {3} allocations", a, memory.Accounts[a].Live, memory.Accounts[a].Peak, memory.Accounts[a].Allocs);
+            }
+
+            if (!Bass.StreamFree(sourceChannel))
+            {
+                Assert.Fail(string.Format("Failed to free the source stream: {0}", Enum.GetName(typeof(Errors), Bass.LastError)));
+            }
+        }
+
+        /// <summary>
+        /// Check a paused compact stream can be trimmed and still decodes to the end, reporting memory and speed of both modes.
+        /// </summary>
+        [Test]
+        public void Test010()
+        {
+            foreach (var flags in new[] { this.BassFlags, this.BassFlags | BassDts.Compact })
+            {
+                var sourceChannel = BassDts.CreateStream(Path.Combine(CurrentDirectory, this.FileName), 0, 0, flags | BassFlags.Decode);
+                if (sourceChannel == 0)
+                {
+                    Assert.Fail(string.Format("Failed to create source stream: {0}", Enum.GetName(typeof(Errors), Bass.LastError)));
+                }
+
+                var buffer = new byte[1000];
+                for (var a = 0; a < 100; a++)
+                {
+                    Bass.ChannelGetData(sourceChannel, buffer, buffer.Length);
+                }
+
+                var before = default(DtsMemory);
+                var after = default(DtsMemory);
+                if (!BassDts.GetMemory(sourceChannel, out before) || !BassDts.Trim(sourceChannel) || !BassDts.GetMemory(sourceChannel, out after))
+                {
+                    Assert.Fail(string.Format("Failed to trim the source stream: {0}", Enum.GetName(typeof(Errors), Bass.LastError)));
+                }
+                Assert.LessOrEqual(after.Size, before.Size);
+
+                while (Bass.ChannelGetData(sourceChannel, buffer, buffer.Length) > 0) ;
+
+                var stats = default(DtsStats);
+                if (!BassDts.GetStats(sourceChannel, out stats))
+                {
+                    Assert.Fail(string.Format("Failed to get stream stats: {0}", Enum.GetName(typeof(Errors), Bass.LastError)));
+                }
+                Assert.Greater(stats.Frames, 0);
+
+                //Conversion is part of the file read stage.
+                var time = 0L;
+                for (var a = 0; a < DtsStats.StageCount; a++)
+                {
+                    if (a != DtsStats.Convert)
+                    {
+                        time += stats.Stages[a].Time;
+                    }
+                }
+                Debug.WriteLine("Flags {0}: {1} bytes, {2} bytes trimmed, {3:0.000} ms per frame", flags, before.Size, after.Size, stats.Frequency > 0 ? time * 1000.0 / stats.Frequency / stats.Frames : 0);
+
+                if (!Bass.StreamFree(sourceChannel))
+                {
+                    Assert.Fail(string.Format("Failed to free the source stream: {0}", Enum.GetName(typeof(Errors), Bass.LastError)));
+                }
+            }
+
+            //Real-time streams keep their memory in an arena and refuse to trim.
+            var realtimeChannel = BassDts.CreateStream(Path.Combine(CurrentDirectory, this.FileName), 0, 0, this.BassFlags | BassFlags.Decode | BassDts.Realtime);
+            if (realtimeChannel == 0)
+            {
+                Assert.Fail(string.Format("Failed to create source stream: {0}", Enum.GetName(typeof(Errors), Bass.LastError)));
+            }
+            Assert.IsFalse(BassDts.Trim(realtimeChannel));
+            Assert.AreEqual(Errors.NotAvailable, Bass.LastError);
+            if (!Bass.StreamFree(realtimeChannel))
+            {
+                Assert.Fail(string.Format("Failed to free the source stream: {0}", Enum.GetName(typeof(Errors), Bass.LastError)));
+            }
+        }
+
+        /// <summary>
+        /// Check single precision synthesis decodes as many samples as the default.
+        /// </summary>
+        [Test]
+        public void Test011()
+        {
+            var lengths = new long[2];
+            var flags = new[] { this.BassFlags, this.BassFlags | BassDts.Float32 };
+            for (var a = 0; a < flags.Length; a++)
+            {
+                var sourceChannel = BassDts.CreateStream(Path.Combine(CurrentDirectory, this.FileName), 0, 0, flags[a] | BassFlags.Decode);
+                if (sourceChannel == 0)
+                {
+                    Assert.Fail(string.Format("Failed to create source stream: {0}", Enum.GetName(typeof(Errors), Bass.LastError)));
+                }
+
+                var buffer = new byte[1024 * 64];
+                var length = default(int);
+                while ((length = Bass.ChannelGetData(sourceChannel, buffer, buffer.Length)) > 0)
+                {
+                    lengths[a] += length;
+                }
+
+                if (!Bass.StreamFree(sourceChannel))
+                {
+                    Assert.Fail(string.Format("Failed to free the source stream: {0}", Enum.GetName(typeof(Errors), Bass.LastError)));
+                }
+            }
+
+            Assert.Greater(lengths[0], 0);
+            Assert.AreEqual(lengths[0], lengths[1]);
+        }
     }
 }
\ No newline at end of file
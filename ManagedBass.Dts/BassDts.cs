@@ -1,4 +1,5 @@
 ﻿using System.IO;
+using System.Text;
 using System.Runtime.InteropServices;
 
 namespace ManagedBass.Dts
@@ -9,6 +10,12 @@ namespace ManagedBass.Dts
 
         public const ChannelType ChannelType = (ChannelType)0x1f200;
 
+        public const BassFlags Realtime = (BassFlags)0x200;
+
+        public const BassFlags Compact = (BassFlags)0x400;
+
+        public const BassFlags Float32 = (BassFlags)0x800;
+
         public static int Module = 0;
 
         public static bool Load(string folderName = null)
@@ -49,5 +56,80 @@ namespace ManagedBass.Dts
         {
             return BASS_DTS_StreamCreateFile(false, File, Offset, Length, Flags);
         }
+
+        [DllImport(DllName)]
+        static extern bool BASS_DTS_Probe(bool Memory, string File, long Offset, long Length, BassFlags Flags, out DtsProbeInfo Info);
+
+        public static bool Probe(string File, out DtsProbeInfo Info, long Offset = 0, long Length = 0, BassFlags Flags = BassFlags.Default)
+        {
+            return BASS_DTS_Probe(false, File, Offset, Length, Flags, out Info);
+        }
+
+        [DllImport(DllName)]
+        static extern int BASS_DTS_GetAllocations(int Handle);
+
+        public static int GetAllocations(int Handle)
+        {
+            return BASS_DTS_GetAllocations(Handle);
+        }
+
+        [DllImport(DllName)]
+        static extern bool BASS_DTS_GetStats(int Handle, out DtsStats Stats);
+
+        public static bool GetStats(int Handle, out DtsStats Stats)
+        {
+            return BASS_DTS_GetStats(Handle, out Stats);
+        }
+
+        [DllImport(DllName)]
+        static extern bool BASS_DTS_GetMemory(int Handle, out DtsMemory Memory);
+
+        public static bool GetMemory(int Handle, out DtsMemory Memory)
+        {
+            return BASS_DTS_GetMemory(Handle, out Memory);
+        }
+
+        [DllImport(DllName)]
+        static extern bool BASS_DTS_Trim(int Handle);
+
+        public static bool Trim(int Handle)
+        {
+            return BASS_DTS_Trim(Handle);
+        }
+
+        [DllImport(DllName)]
+        static extern bool BASS_DTS_TraceStart(int Events);
+
+        public static bool TraceStart(int Events = 65536)
+        {
+            return BASS_DTS_TraceStart(Events);
+        }
+
+        [DllImport(DllName)]
+        static extern bool BASS_DTS_TraceStop();
+
+        public static bool TraceStop()
+        {
+            return BASS_DTS_TraceStop();
+        }
+
+        [DllImport(DllName)]
+        static extern int BASS_DTS_TraceGet(byte[] Buffer, int Length);
+
+        public static string TraceGet()
+        {
+            var length = BASS_DTS_TraceGet(null, 0);
+            while (length != -1)
+            {
+                //More spans may have been recorded since the length was fetched.
+                var buffer = new byte[length + 1];
+                length = BASS_DTS_TraceGet(buffer, buffer.Length);
+                if (length >= 0 && length < buffer.Length)
+                {
+                    return Encoding.ASCII.GetString(buffer, 0, length);
+                }
+            }
+            return null;
+        }
     }
 }
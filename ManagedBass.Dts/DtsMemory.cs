@@ -0,0 +1,37 @@
+﻿using System.Runtime.InteropServices;
+
+namespace ManagedBass.Dts
+{
+    [StructLayout(LayoutKind.Sequential)]
+    public struct DtsMemory
+    {
+        public const int Total = 0;
+
+        public const int Context = 1;
+
+        public const int Core = 2;
+
+        public const int Interpolator = 3;
+
+        public const int Exss = 4;
+
+        public const int Xll = 5;
+
+        public const int XllChset = 6;
+
+        public const int Pbr = 7;
+
+        public const int Lbr = 8;
+
+        public const int Arena = 9;
+
+        public const int File = 10;
+
+        public const int AccountCount = 11;
+
+        [MarshalAs(UnmanagedType.ByValArray, SizeConst = AccountCount)]
+        public DtsMemoryAccount[] Accounts;
+
+        public long Size;
+    }
+}
\ No newline at end of file
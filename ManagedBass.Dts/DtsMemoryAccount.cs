@@ -0,0 +1,18 @@
+﻿using System.Runtime.InteropServices;
+
+namespace ManagedBass.Dts
+{
+    [StructLayout(LayoutKind.Sequential)]
+    public struct DtsMemoryAccount
+    {
+        public long Live;
+
+        public long Peak;
+
+        public long Allocs;
+
+        public long Reallocs;
+
+        public long Frees;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,34 @@
+﻿using System.Runtime.InteropServices;
+
+namespace ManagedBass.Dts
+{
+    [StructLayout(LayoutKind.Sequential)]
+    public struct DtsProbeInfo
+    {
+        public int Frequency;
+
+        public int Channels;
+
+        public int Speakers;
+
+        public int OriginalResolution;
+
+        public int Profile;
+
+        public int Matrix;
+
+        public bool EmbeddedStereo;
+
+        public bool Embedded6Channel;
+
+        public bool Core;
+
+        public bool Extensions;
+
+        public int FrameSamples;
+
+        public long Length;
+
+        public bool Exact;
+    }
+}
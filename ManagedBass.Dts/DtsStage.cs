@@ -0,0 +1,12 @@
+﻿using System.Runtime.InteropServices;
+
+namespace ManagedBass.Dts
+{
+    [StructLayout(LayoutKind.Sequential)]
+    public struct DtsStage
+    {
+        public long Time;
+
+        public long Calls;
+    }
+}
\ No newline at end of file
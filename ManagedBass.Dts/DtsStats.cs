@@ -0,0 +1,52 @@
+﻿using System.Runtime.InteropServices;
+
+namespace ManagedBass.Dts
+{
+    [StructLayout(LayoutKind.Sequential)]
+    public struct DtsStats
+    {
+        public const int CoreParse = 0;
+
+        public const int ExssParse = 1;
+
+        public const int XllParse = 2;
+
+        public const int LbrParse = 3;
+
+        public const int CoreFilter = 4;
+
+        public const int XllFilter = 5;
+
+        public const int LbrFilter = 6;
+
+        public const int Downmix = 7;
+
+        public const int ShiftClip = 8;
+
+        public const int FileRead = 9;
+
+        public const int Convert = 10;
+
+        public const int Pcm = 11;
+
+        public const int StageCount = 12;
+
+        [MarshalAs(UnmanagedType.ByValArray, SizeConst = StageCount)]
+        public DtsStage[] Stages;
+
+        public long Frequency;
+
+        public long Frames;
+
+        public long Errors;
+
+        [MarshalAs(UnmanagedType.ByValArray, SizeConst = 10)]
+        public long[] Warnings;
+
+        public long Resyncs;
+
+        public long Underruns;
+
+        public long PbrCopied;
+    }
+}
\ No newline at end of file
@@ -3,6 +3,13 @@
 #include "dts_stream.h"
 #include "pcm.h"
 #include "buffer.h"
+#include "context_pool.h"
+#include "dts_probe.h"
+#include "file_map.h"
+#include "dts_stats.h"
+#include "dts_trace.h"
+#include "../libdcadec/common.h"
+#include "../libdcadec/stats.h"
 
 //2.4.0.0
 #define BASSDTSVERSION 0x02040000
@@ -50,6 +57,18 @@ BOOL BASSDTSDEF(DllMain)(HANDLE dll, DWORD reason, LPVOID reserved) {
 			MessageBoxA(0, "Incorrect BASS.DLL version (" BASSVERSIONTEXT " is required)", "BASS", MB_ICONERROR | MB_OK);
 			return FALSE;
 		}
+		context_pool_init();
+		file_map_init();
+		dts_stats_init();
+		break;
+	case DLL_PROCESS_DETACH:
+		//Skip the cleanup when the process is terminating.
+		if (!reserved) {
+			context_pool_free();
+			file_map_free();
+			dts_stats_free();
+			dts_trace_free();
+		}
 		break;
 	}
 	return TRUE;
@@ -65,10 +84,14 @@ const VOID* BASSDTSDEF(BASSplugin)(DWORD face) {
 	return NULL;
 }
 
-HSTREAM BASSDTSDEF(BASS_DTS_StreamCreate)(BASSFILE file, DWORD flags) {
+static HSTREAM stream_create(BASSFILE file, const void* memory, QWORD length, DWORD flags) {
 	HSTREAM handle;
 	DTS_STREAM* dts_stream;
-	if (!dts_stream_create(file, 0, &dts_stream)) {
+	BOOL realtime = (flags & BASS_DTS_REALTIME) != 0;
+	//Only real-time streams use an arena, it holds the memory reserved up front. The others allocate from the heap so trimmed memory is given back.
+	BOOL compact = (flags & BASS_DTS_COMPACT) != 0 && !realtime;
+	int decoder_flags = (realtime ? DCADEC_FLAG_ARENA : 0) | ((flags & BASS_DTS_FLOAT32) ? DCADEC_FLAG_CORE_FLOAT32 : 0);
+	if (!dts_stream_create(file, memory, length, decoder_flags, realtime, compact, &dts_stream)) {
 		return 0;
 	}
 	if (flags & BASS_SAMPLE_FLOAT) {
@@ -103,13 +126,18 @@ HSTREAM BASSDTSDEF(BASS_DTS_StreamCreate)(BASSFILE file, DWORD flags) {
 	return handle;
 }
 
+HSTREAM BASSDTSDEF(BASS_DTS_StreamCreate)(BASSFILE file, DWORD flags) {
+	return stream_create(file, NULL, 0, flags);
+}
+
 HSTREAM BASSDTSDEF(BASS_DTS_StreamCreateFile)(BOOL mem, const void* file, QWORD offset, QWORD length, DWORD flags) {
 	HSTREAM handle;
 	BASSFILE bass_file = bassfunc->file.Open(mem, file, offset, length, flags, FALSE);
 	if (!bass_file) {
 		return 0;
 	}
-	handle = BASS_DTS_StreamCreate(bass_file, flags);
+	//Memory streams are parsed straight from the caller's buffer.
+	handle = stream_create(bass_file, mem ? file : NULL, length, flags);
 	if (!handle) {
 		bassfunc->file.Close(bass_file);
 		return 0;
@@ -118,15 +146,40 @@ HSTREAM BASSDTSDEF(BASS_DTS_StreamCreateFile)(BOOL mem, const void* file, QWORD
 	return handle;
 }
 
+BOOL BASSDTSDEF(BASS_DTS_Probe)(BOOL mem, const void* file, QWORD offset, QWORD length, DWORD flags, BASS_DTS_PROBEINFO* info) {
+	//Fetch the stream properties without creating a stream or a decoder.
+	BASSFILE bass_file;
+	BOOL result;
+	if (!info) {
+		error(BASS_ERROR_ILLPARAM);
+	}
+	bass_file = bassfunc->file.Open(mem, file, offset, length, flags, FALSE);
+	if (!bass_file) {
+		return FALSE;
+	}
+	result = dts_probe(bass_file, info);
+	bassfunc->file.Close(bass_file);
+	if (!result) {
+		error(BASS_ERROR_FILEFORM);
+	}
+	noerror();
+}
+
 DWORD BASSDTSDEF(BASS_DTS_StreamProc)(HSTREAM handle, void* buffer, DWORD length, void* user) {
 	DTS_STREAM* dts_stream = user;
 	DWORD position = 0;
 	DWORD remaining = length;
+	uint64_t start = dca_stats_time();
 	while (remaining > 0) {
 		//Make sure samples are available.
 		if (!dts_stream->samples || !dts_stream->sample_count) {
 			if (!dts_stream_update(dts_stream)) {
 				//Reached the end of the file (or some catastrophic failure to synchronize).
+				if (dts_stream->compact) {
+					//Nothing more to decode, a compact stream doesn't need its buffers until it is rewound.
+					dts_stream_trim(dts_stream);
+				}
+				dca_stats_span("BASS_DTS_StreamProc", start);
 				return BASS_STREAMPROC_END;
 			}
 		}
@@ -135,7 +188,12 @@ DWORD BASSDTSDEF(BASS_DTS_StreamProc)(HSTREAM handle, void* buffer, DWORD length
 		}
 	}
 	//If remaining > 0 it's a buffer underrun, ASIO won't be happy. 
-	//Nothing we can do.
+	//Nothing we can do but count it.
+	if (remaining > 0) {
+		dca_stats_count(dts_stream->underruns);
+		dca_stats_span("underrun", start);
+	}
+	dca_stats_span("BASS_DTS_StreamProc", start);
 	return length - remaining;
 }
 
@@ -220,6 +278,102 @@ QWORD BASSDTSDEF(BASS_DTS_SetPosition)(void* inst, QWORD position, DWORD mode) {
 	return 0;
 }
 
+DWORD BASSDTSDEF(BASS_DTS_GetAllocations)(HSTREAM handle) {
+	//Number of times a real-time stream had to allocate memory while decoding, zero for other streams.
+	DTS_STREAM* dts_stream = bassfunc->GetInst(handle, &addon_functions);
+	if (!dts_stream) {
+		errorn(BASS_ERROR_HANDLE);
+	}
+	noerrorn(dts_stream_allocations(dts_stream));
+}
+
+BOOL BASSDTSDEF(BASS_DTS_GetStats)(HSTREAM handle, BASS_DTS_STATS* stats) {
+	//Timing and event counters of a stream, or of all streams in the process if handle is 0.
+	DTS_STREAM* dts_stream;
+	if (!stats) {
+		error(BASS_ERROR_ILLPARAM);
+	}
+	if (!handle) {
+		dts_stats_get_all(stats);
+		noerror();
+	}
+	dts_stream = bassfunc->GetInst(handle, &addon_functions);
+	if (!dts_stream) {
+		error(BASS_ERROR_HANDLE);
+	}
+	dts_stats_get(dts_stream, stats);
+	noerror();
+}
+
+BOOL BASSDTSDEF(BASS_DTS_GetMemory)(HSTREAM handle, BASS_DTS_MEMORY* memory) {
+	//Memory held by a stream per subsystem, or by all open streams if handle is 0.
+	DTS_STREAM* dts_stream;
+	if (!memory) {
+		error(BASS_ERROR_ILLPARAM);
+	}
+	if (!handle) {
+		dts_stats_memory_all(memory);
+		noerror();
+	}
+	dts_stream = bassfunc->GetInst(handle, &addon_functions);
+	if (!dts_stream) {
+		error(BASS_ERROR_HANDLE);
+	}
+	dts_stats_memory(dts_stream, memory);
+	noerror();
+}
+
+BOOL BASSDTSDEF(BASS_DTS_Trim)(HSTREAM handle) {
+	//Release the buffers of an idle (paused) stream, or the pooled decoder contexts if handle is 0.
+	DTS_STREAM* dts_stream;
+	BOOL result;
+	if (!handle) {
+		context_pool_trim(0);
+		noerror();
+	}
+	dts_stream = bassfunc->GetInst(handle, &addon_functions);
+	if (!dts_stream) {
+		error(BASS_ERROR_HANDLE);
+	}
+	if (dts_stream->realtime || (dts_stream->decoder_flags & DCADEC_FLAG_ARENA)) {
+		//Arena streams can't give memory back.
+		error(BASS_ERROR_NOTAVAIL);
+	}
+	//Keep the stream proc out while the buffers go away.
+	BASS_ChannelLock(handle, TRUE);
+	result = dts_stream_trim(dts_stream);
+	BASS_ChannelLock(handle, FALSE);
+	if (!result) {
+		error(BASS_ERROR_MEM);
+	}
+	noerror();
+}
+
+BOOL BASSDTSDEF(BASS_DTS_TraceStart)(DWORD events) {
+	//Record the decoding stages of all streams as spans, the ring keeps the most recent events.
+	if (!events) {
+		error(BASS_ERROR_ILLPARAM);
+	}
+	if (!dts_trace_start(events)) {
+		error(BASS_ERROR_MEM);
+	}
+	noerror();
+}
+
+BOOL BASSDTSDEF(BASS_DTS_TraceStop)() {
+	dts_trace_stop();
+	noerror();
+}
+
+DWORD BASSDTSDEF(BASS_DTS_TraceGet)(char* buffer, DWORD length) {
+	//Write the recorded spans as Chrome trace event JSON, returns the length of the whole text.
+	DWORD result;
+	if (!dts_trace_json(buffer, length, &result)) {
+		errorn(BASS_ERROR_NOTAVAIL);
+	}
+	noerrorn(result);
+}
+
 VOID BASSDTSDEF(BASS_DTS_Free)(void* inst) {
 	DTS_STREAM* dts_stream = inst;
 	dts_stream_free(dts_stream);
@@ -6,16 +6,37 @@
 
 #include "../libdcadec/dca_context.h"
 #include "../libdcadec/dca_frame.h"
+#include "../libdcadec/ta.h"
 
 #ifndef BASSDTSDEF
 #define BASSDTSDEF(f) WINAPI f
 #endif
 
+//BASS_DTS_StreamCreate flag: size everything at creation (in an arena) so decoding doesn't allocate memory.
+#define BASS_DTS_REALTIME 0x200
+//BASS_DTS_StreamCreate flag: release the decoder buffers as soon as the stream reaches the end.
+#define BASS_DTS_COMPACT 0x400
+//BASS_DTS_StreamCreate flag: single precision core synthesis, faster but not identical to the default double precision one.
+#define BASS_DTS_FLOAT32 0x800
+
+//BASS_DTS_STATS stages after the DCADEC_STAGE_* ones.
+#define BASS_DTS_STAGE_FILE_READ (DCADEC_STAGE_COUNT + 0) //Reading and synchronizing, includes bitstream conversion.
+#define BASS_DTS_STAGE_CONVERT (DCADEC_STAGE_COUNT + 1) //Bitstream conversion to 16 bit big endian.
+#define BASS_DTS_STAGE_PCM (DCADEC_STAGE_COUNT + 2) //Sample conversion to the output format.
+#define BASS_DTS_STAGE_COUNT (DCADEC_STAGE_COUNT + 3)
+
+//BASS_DTS_MEMORY accounts after the DCADEC_MEM_* ones.
+#define BASS_DTS_MEM_FILE (DCADEC_MEM_COUNT + 0) //File state and frame buffer.
+#define BASS_DTS_MEM_COUNT (DCADEC_MEM_COUNT + 1)
+
 typedef struct {
 	BYTE header[DCADEC_FRAME_HEADER_SIZE];
 	BYTE* buffer;
+	BYTE* data;
 	size_t size;
 	UINT sync_word;
+	QWORD position;
+	BOOL direct;
 } DTS_FRAME;
 
 typedef struct {
@@ -27,10 +48,28 @@ typedef struct {
 	BOOL has_extensions;
 } DTS_INFO;
 
+typedef struct {
+	WCHAR* name;
+	HANDLE file;
+	HANDLE mapping;
+	QWORD length;
+	int references;
+} FILE_MAP;
+
 typedef struct {
 	BASSFILE bass_file;
 	DTS_FRAME frame;
 	DTS_INFO info;
+	FILE_MAP* map;
+	BYTE* map_data; //Window of the file (or all of the memory) starting at map_offset.
+	QWORD map_offset;
+	QWORD map_size;
+	QWORD map_length;
+	DWORD allocations;
+	struct dcadec_stage_stats read_stats;
+	struct dcadec_stage_stats convert_stats;
+	QWORD resyncs;
+	struct ta_account account;
 } DTS_FILE;
 
 typedef struct {
@@ -47,14 +86,67 @@ typedef struct {
 	int sample_rate;
 	DTS_FILE* dts_file;
 	struct dcadec_context* dcadec_context;
+	int decoder_flags;
+	BOOL realtime;
+	BOOL compact;
+	size_t heap_allocs;
+	BOOL parsed;
 	int** samples;
+	int** pending;
 	int sample_count;
 	int sample_position;
 	PCM_WRITE_SAMPLE write_sample;
 	AUDIO_FORMAT input_format;
 	AUDIO_FORMAT output_format;
+	struct dcadec_stage_stats pcm_stats;
+	QWORD underruns;
 } DTS_STREAM;
 
+typedef struct {
+	DWORD freq; //Sample rate in Hz.
+	DWORD chans; //Number of channels.
+	DWORD speakers; //Speaker activity mask (EXSS format), zero if unavailable.
+	DWORD origres; //Encoded bit depth.
+	DWORD profile; //One of the DCADEC_PROFILE_* values.
+	DWORD matrix; //One of the DCADEC_MATRIX_ENCODING_* values.
+	BOOL embedded_stereo; //A 2.0 downmix is embedded in the stream.
+	BOOL embedded_6ch; //A 5.1 downmix is embedded in the stream.
+	BOOL core; //A backward compatible core is present.
+	BOOL extensions; //An extension sub-stream is present.
+	DWORD frame_samples; //Samples per channel in each frame.
+	QWORD length; //Length in samples per channel.
+	BOOL exact; //The length was read from the DTS-HD container, otherwise it is estimated.
+} BASS_DTS_PROBEINFO;
+
+typedef struct {
+	QWORD time; //Timer ticks spent in the stage.
+	QWORD calls; //Number of times the stage was run.
+} BASS_DTS_STAGE;
+
+typedef struct {
+	BASS_DTS_STAGE stages[BASS_DTS_STAGE_COUNT]; //Indexed by DCADEC_STAGE_* and BASS_DTS_STAGE_*.
+	QWORD frequency; //Timer ticks per second.
+	QWORD frames; //Frames decoded.
+	QWORD errors; //Frames the decoder failed to parse or decode.
+	QWORD warnings[10]; //Decoder warnings, indexed by the DCADEC_W* values.
+	QWORD resyncs; //Times data was skipped to find the next frame.
+	QWORD underruns; //Times less data than requested was returned.
+	QWORD pbr_copied; //Bytes copied into the XLL peak bit rate smoothing buffer.
+} BASS_DTS_STATS;
+
+typedef struct {
+	QWORD live; //Bytes currently allocated.
+	QWORD peak; //Highest number of bytes allocated.
+	QWORD allocs; //Number of allocations.
+	QWORD reallocs; //Number of allocations resized.
+	QWORD frees; //Number of allocations freed.
+} BASS_DTS_MEMORY_ACCOUNT;
+
+typedef struct {
+	BASS_DTS_MEMORY_ACCOUNT accounts[BASS_DTS_MEM_COUNT]; //Indexed by DCADEC_MEM_* and BASS_DTS_MEM_*.
+	QWORD size; //Bytes currently allocated by the stream, the decoder and the file.
+} BASS_DTS_MEMORY;
+
 BOOL BASSDTSDEF(DllMain)(HANDLE dll, DWORD reason, LPVOID reserved);
 
 const VOID* BASSDTSDEF(BASSplugin)(DWORD face);
@@ -79,4 +171,20 @@ QWORD BASSDTSDEF(BASS_DTS_SetPosition)(void* inst, QWORD position, DWORD mode);
 
 VOID BASSDTSDEF(BASS_DTS_Free)(void* inst);
 
+BOOL BASSDTSDEF(BASS_DTS_Probe)(BOOL mem, const void* file, QWORD offset, QWORD length, DWORD flags, BASS_DTS_PROBEINFO* info);
+
+DWORD BASSDTSDEF(BASS_DTS_GetAllocations)(HSTREAM handle);
+
+BOOL BASSDTSDEF(BASS_DTS_GetStats)(HSTREAM handle, BASS_DTS_STATS* stats);
+
+BOOL BASSDTSDEF(BASS_DTS_GetMemory)(HSTREAM handle, BASS_DTS_MEMORY* memory);
+
+BOOL BASSDTSDEF(BASS_DTS_Trim)(HSTREAM handle);
+
+BOOL BASSDTSDEF(BASS_DTS_TraceStart)(DWORD events);
+
+BOOL BASSDTSDEF(BASS_DTS_TraceStop)();
+
+DWORD BASSDTSDEF(BASS_DTS_TraceGet)(char* buffer, DWORD length);
+
 #endif
\ No newline at end of file
@@ -0,0 +1,166 @@
+#include "context_pool.h"
+
+typedef struct {
+	struct dcadec_context* context;
+	int flags;
+	size_t size;
+	DWORD release_time;
+	BOOL trimmed;
+} CONTEXT_POOL_ENTRY;
+
+//Decoder contexts keep their sub-decoders, buffers and tables between streams so
+//opening a stream after another one was closed does not have to allocate them again.
+//The frame buffers are only given back when the memory cap would be exceeded otherwise.
+static CRITICAL_SECTION lock;
+static CONTEXT_POOL_ENTRY entries[CONTEXT_POOL_SIZE];
+static size_t memory_usage;
+
+static void context_pool_remove(const int index) {
+	memory_usage -= entries[index].size;
+	entries[index].context = NULL;
+}
+
+static void context_pool_trim_locked(const DWORD idle_timeout) {
+	DWORD time = GetTickCount();
+	int index;
+	for (index = 0; index < CONTEXT_POOL_SIZE; index++) {
+		if (entries[index].context && time - entries[index].release_time >= idle_timeout) {
+			dcadec_context_destroy(entries[index].context);
+			context_pool_remove(index);
+		}
+	}
+}
+
+static int context_pool_oldest(const BOOL untrimmed) {
+	int result = -1;
+	int index;
+	for (index = 0; index < CONTEXT_POOL_SIZE; index++) {
+		if (!entries[index].context || (untrimmed && entries[index].trimmed)) {
+			continue;
+		}
+		if (result < 0 || (LONG)(entries[index].release_time - entries[result].release_time) < 0) {
+			result = index;
+		}
+	}
+	return result;
+}
+
+static void context_pool_shrink(struct dcadec_context* const context, size_t* const size) {
+	//Release the frame buffers but keep the sub-decoders and tables. An arena gives back the large buffers, they have slabs of their own.
+	dcadec_context_trim(context);
+	*size = dcadec_context_get_memory_usage(context);
+}
+
+static void context_pool_shrink_locked(const size_t size) {
+	//Shrink the contexts that were idle the longest until size more bytes fit under the cap.
+	size_t entry_size;
+	int index;
+	while (memory_usage + size > CONTEXT_POOL_MEMORY_CAP && (index = context_pool_oldest(TRUE)) >= 0) {
+		entries[index].trimmed = TRUE;
+		context_pool_shrink(entries[index].context, &entry_size);
+		memory_usage -= entries[index].size - entry_size;
+		entries[index].size = entry_size;
+	}
+}
+
+BOOL context_pool_init() {
+	InitializeCriticalSection(&lock);
+	ZeroMemory(entries, sizeof(entries));
+	memory_usage = 0;
+	return TRUE;
+}
+
+BOOL context_pool_acquire(const int flags, struct dcadec_context** const context) {
+	int result = -1;
+	int index;
+
+	EnterCriticalSection(&lock);
+	context_pool_trim_locked(CONTEXT_POOL_IDLE_TIMEOUT);
+	for (index = 0; index < CONTEXT_POOL_SIZE; index++) {
+		if (!entries[index].context || entries[index].flags != flags) {
+			continue;
+		}
+		//Prefer the most recently used context, it is most likely still in cache.
+		if (result < 0 || (LONG)(entries[index].release_time - entries[result].release_time) > 0) {
+			result = index;
+		}
+	}
+	if (result >= 0) {
+		*context = entries[result].context;
+		context_pool_remove(result);
+		//The counters belong to the stream that used the context before.
+		dcadec_context_reset_stats(*context);
+	}
+	LeaveCriticalSection(&lock);
+
+	if (result < 0 && !(*context = dcadec_context_create(flags))) {
+		//Context creation failed.
+		return FALSE;
+	}
+	return TRUE;
+}
+
+BOOL context_pool_release(const int flags, struct dcadec_context* const context) {
+	size_t size;
+	BOOL trimmed = FALSE;
+	int index;
+
+	if (!context) {
+		return FALSE;
+	}
+
+	//Forget any history of the previous stream, allocations are kept.
+	dcadec_context_clear(context);
+	size = dcadec_context_get_memory_usage(context);
+	if (size > CONTEXT_POOL_MEMORY_CAP) {
+		trimmed = TRUE;
+		context_pool_shrink(context, &size);
+		if (size > CONTEXT_POOL_MEMORY_CAP) {
+			dcadec_context_destroy(context);
+			return FALSE;
+		}
+	}
+
+	EnterCriticalSection(&lock);
+	context_pool_trim_locked(CONTEXT_POOL_IDLE_TIMEOUT);
+	if (memory_usage + size > CONTEXT_POOL_MEMORY_CAP) {
+		//Over the cap, buffers of the pooled contexts go first, then those of this one.
+		context_pool_shrink_locked(size);
+		if (memory_usage + size > CONTEXT_POOL_MEMORY_CAP && !trimmed) {
+			trimmed = TRUE;
+			context_pool_shrink(context, &size);
+		}
+	}
+	//Make room by evicting the contexts that were idle the longest.
+	while (TRUE) {
+		for (index = 0; index < CONTEXT_POOL_SIZE && entries[index].context; index++);
+		if (index < CONTEXT_POOL_SIZE && memory_usage + size <= CONTEXT_POOL_MEMORY_CAP) {
+			break;
+		}
+		index = context_pool_oldest(FALSE);
+		dcadec_context_destroy(entries[index].context);
+		context_pool_remove(index);
+	}
+	entries[index].context = context;
+	entries[index].flags = flags;
+	entries[index].size = size;
+	entries[index].release_time = GetTickCount();
+	entries[index].trimmed = trimmed;
+	memory_usage += size;
+	LeaveCriticalSection(&lock);
+
+	return TRUE;
+}
+
+BOOL context_pool_trim(const DWORD idle_timeout) {
+	EnterCriticalSection(&lock);
+	context_pool_trim_locked(idle_timeout);
+	LeaveCriticalSection(&lock);
+	return TRUE;
+}
+
+BOOL context_pool_free() {
+	context_pool_trim(0);
+	DeleteCriticalSection(&lock);
+	return TRUE;
+}
\ No newline at end of file
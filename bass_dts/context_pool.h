@@ -0,0 +1,19 @@
+#include "bass_dts.h"
+
+//Upper bound for the memory held by idle contexts.
+#define CONTEXT_POOL_MEMORY_CAP (16 * 1024 * 1024)
+
+//Idle contexts are destroyed after this many milliseconds.
+#define CONTEXT_POOL_IDLE_TIMEOUT 60000
+
+#define CONTEXT_POOL_SIZE 16
+
+BOOL context_pool_init();
+
+BOOL context_pool_acquire(const int flags, struct dcadec_context** const context);
+
+BOOL context_pool_release(const int flags, struct dcadec_context* const context);
+
+BOOL context_pool_trim(const DWORD idle_timeout);
+
+BOOL context_pool_free();
\ No newline at end of file
@@ -1,13 +1,17 @@
 #include <stdio.h>
 
 #include "dts_file.h"
+#include "file_map.h"
 #include "../libdcadec/common.h"
 #include "../libdcadec/ta.h"
 #include "../libdcadec/dca_frame.h"
+#include "../libdcadec/stats.h"
 
 #define BUFFER_ALIGN 4096
 
 #define DTSHDHDR UINT64_C(0x4454534844484452)
+#define AUPR_HDR UINT64_C(0x415550522D484452)
+#define STRMDATA UINT64_C(0x5354524D44415441)
 
 static BOOL dts_file_core_sync_word(const uint32_t value) {
 	//Is the value a valid core sync word.
@@ -33,6 +37,11 @@ static BOOL dts_file_ext_sync_word(const uint32_t value) {
 		value == SYNC_WORD_EXSS_LE;
 }
 
+static BOOL dts_file_14bit_sync_word(const uint32_t value) {
+	//Is the value the sync word of a core packed in 14 of every 16 bits.
+	return value == SYNC_WORD_CORE_LE14 || value == SYNC_WORD_CORE_BE14;
+}
+
 static BOOL dts_file_sync_word(const uint32_t value) {
 	//Is the value a valid core or extension sync word.
 	return dts_file_core_sync_word(value) || dts_file_ext_sync_word(value);
@@ -54,6 +63,8 @@ BOOL dts_file_create(const BASSFILE bass_file, DTS_FILE** const dts_file) {
 		//Allocation failed.
 		return FALSE;
 	}
+	//Charge the file and everything allocated with it (the frame buffer) to its own account.
+	ta_set_account(*dts_file, &(*dts_file)->account);
 
 	(*dts_file)->bass_file = bass_file;
 	(*dts_file)->info.length = bassfunc->file.GetPos(bass_file, BASS_FILEPOS_END);
@@ -67,11 +78,58 @@ BOOL dts_file_create(const BASSFILE bass_file, DTS_FILE** const dts_file) {
 	return TRUE;
 }
 
+BOOL dts_file_map(DTS_FILE* const dts_file, const void* const memory, const QWORD length) {
+	//Use a mapping of the file (or the memory the stream was created from) to parse frames in place.
+	//File positions are used as offsets into the mapping so the stream must span all of it.
+	if (bassfunc->file.GetPos(dts_file->bass_file, BASS_FILEPOS_START) != 0) {
+		return FALSE;
+	}
+
+	if (memory) {
+		dts_file->map_data = (BYTE*)memory;
+		dts_file->map_size = length;
+		dts_file->map_length = length;
+	}
+	else if (file_map_acquire(dts_file->bass_file, &dts_file->map)) {
+		//The first window is mapped by the first frame read.
+		dts_file->map_length = dts_file->map->length;
+	}
+	else {
+		return FALSE;
+	}
+
+	if (dts_file->map_length != dts_file->info.length) {
+		//The mapping doesn't match what BASS is reading.
+		file_map_release(dts_file->map);
+		dts_file->map = NULL;
+		dts_file->map_data = NULL;
+		dts_file->map_size = 0;
+		dts_file->map_length = 0;
+		return FALSE;
+	}
+
+	return TRUE;
+}
+
+static BYTE* dts_file_map_range(DTS_FILE* const dts_file, const QWORD position, const QWORD size) {
+	//Get the bytes of the file at position in the mapping, moving the window of a mapped file if they are outside of it.
+	if (position < dts_file->map_offset || position + size > dts_file->map_offset + dts_file->map_size) {
+		if (!dts_file->map || !file_map_window(dts_file->map, position, size, &dts_file->map_data, &dts_file->map_offset, &dts_file->map_size)) {
+			return NULL;
+		}
+	}
+	return dts_file->map_data + (position - dts_file->map_offset);
+}
+
 static BYTE* dts_file_get_buffer(DTS_FILE* const dts_file, const size_t size) {
 	//Ensure that the buffer associated with this file is large enough.
 
 	const size_t old_size = ta_get_size(dts_file->frame.buffer);
-	const size_t new_size = DCA_ALIGN(dts_file->frame.size + size, BUFFER_ALIGN);
+	size_t new_size = DCA_ALIGN(dts_file->frame.size + size, BUFFER_ALIGN);
+	if (!new_size) {
+		//A trimmed buffer is allocated again even if nothing is read into it yet.
+		new_size = BUFFER_ALIGN;
+	}
 
 	if (old_size < new_size) {
 		//We need to expand.
@@ -80,6 +138,7 @@ static BYTE* dts_file_get_buffer(DTS_FILE* const dts_file, const size_t size) {
 			//Zero the newly allocated memory (for no reason).
 			memset(buffer + old_size, 0, new_size - old_size);
 			dts_file->frame.buffer = buffer;
+			dts_file->allocations++;
 		}
 		else {
 			//Allocation failed.
@@ -90,10 +149,37 @@ static BYTE* dts_file_get_buffer(DTS_FILE* const dts_file, const size_t size) {
 	return dts_file->frame.buffer + dts_file->frame.size;
 }
 
+BOOL dts_file_trim(DTS_FILE* const dts_file) {
+	//Release the frame buffer, the frame was already decoded. The next read allocates it again.
+	if (!dts_file->frame.direct) {
+		dts_file->frame.data = NULL;
+		dts_file->frame.size = 0;
+	}
+	ta_free(dts_file->frame.buffer);
+	dts_file->frame.buffer = NULL;
+	return TRUE;
+}
+
+BOOL dts_file_reserve(DTS_FILE* const dts_file, size_t size) {
+	//Grow the buffer up front so frames up to the specified size (once converted) can be read without allocating.
+	const size_t frame_size = dts_file->frame.size;
+	const uint32_t sync_word = ((uint32_t)dts_file->frame.header[0] << 24) | (dts_file->frame.header[1] << 16) | (dts_file->frame.header[2] << 8) | dts_file->frame.header[3];
+	BYTE* buffer;
+	if (dts_file_14bit_sync_word(sync_word)) {
+		//The frame is read as it is in the file, 16 bits for every 14.
+		size = size * 8 / 7 + 2;
+	}
+	dts_file->frame.size = 0;
+	buffer = dts_file_get_buffer(dts_file, size);
+	dts_file->frame.size = frame_size;
+	return buffer != NULL;
+}
+
 static BOOL dts_file_read_sync_word(DTS_FILE* const dts_file, UINT* const sync_word) {
 	//Read the next sync word from the file.
 	//This function attempts to "append" to the current sync word if one is available.
 	//Nothing is done if the current sync word is valid.
+	int count = 0;
 	*sync_word = dts_file->frame.sync_word;
 	while (!dts_file_sync_word(*sync_word)) {
 		//Attempt to read the next byte and rotate it into the current sync word.
@@ -103,6 +189,11 @@ static BOOL dts_file_read_sync_word(DTS_FILE* const dts_file, UINT* const sync_w
 			return FALSE;
 		}
 		*sync_word = (*sync_word << 8) | data;
+		count++;
+	}
+	if (count > 4 && dts_file->info.initialized) {
+		//More than a sync word was read after the first frame, some data was skipped to find this one.
+		dca_stats_count(dts_file->resyncs);
 	}
 	return TRUE;
 }
@@ -137,11 +228,59 @@ static int dts_file_read_frame_header(DTS_FILE* const dts_file, size_t* const si
 	return TRUE;
 }
 
+static BOOL dts_file_direct_sync_word(const uint32_t value) {
+	//Frames with these sync words are 16 bit big endian, the format the decoder parses.
+	return value == SYNC_WORD_CORE || value == SYNC_WORD_EXSS;
+}
+
+static BOOL dts_file_copy_direct(DTS_FILE* const dts_file) {
+	//Copy the frame parts used in place so far into the buffer and continue reading normally.
+	BYTE* buffer;
+	BYTE* data;
+	size_t size = dts_file->frame.size;
+	size_t available = (size_t)(dts_file->map_length - dts_file->frame.position);
+
+	dts_file->frame.direct = FALSE;
+	dts_file->frame.size = 0;
+	if (size < available) {
+		available = size;
+	}
+	if (!(data = dts_file_map_range(dts_file, dts_file->frame.position, available)) ||
+		!(buffer = dts_file_get_buffer(dts_file, size))) {
+		return FALSE;
+	}
+	memcpy(buffer, data, available);
+	dts_file->frame.size = size;
+	return TRUE;
+}
+
 static int dts_file_read_frame_data(DTS_FILE* const dts_file, size_t* const size) {
 	//Read and convert the next frame data from the file.
 	BYTE* buffer;
+	uint64_t start;
 	int result;
 
+	if (dts_file->frame.direct) {
+		QWORD position = dts_file_position(dts_file) - DCADEC_FRAME_HEADER_SIZE;
+		BYTE* data;
+		if (!dts_file->frame.size) {
+			dts_file->frame.position = position;
+		}
+		//The part can stay in the mapping if it needs no conversion and directly follows the previous one.
+		if (dts_file_direct_sync_word(dts_file->frame.sync_word) &&
+			position == dts_file->frame.position + dts_file->frame.size &&
+			(data = dts_file_map_range(dts_file, dts_file->frame.position, position + *size - dts_file->frame.position)) &&
+			!((uintptr_t)data & 3)) {
+			if (!bassfunc->file.Seek(dts_file->bass_file, position + *size)) {
+				return FALSE;
+			}
+			return TRUE;
+		}
+		if (!dts_file_copy_direct(dts_file)) {
+			return FALSE;
+		}
+	}
+
 	//Get the current buffer, it is expanded if required.
 	if (!(buffer = dts_file_get_buffer(dts_file, *size))) {
 		return FALSE;
@@ -156,7 +295,10 @@ static int dts_file_read_frame_data(DTS_FILE* const dts_file, size_t* const size
 	}
 
 	//Convert the frame to a format that can be parsed.
-	if ((result = dcadec_frame_convert_bitstream(buffer, size, buffer, *size)) < 0) {
+	start = dca_stats_time();
+	result = dcadec_frame_convert_bitstream(buffer, size, buffer, *size);
+	dca_stats_add(&dts_file->convert_stats, &start, "dcadec_frame_convert_bitstream");
+	if (result < 0) {
 		//Negative return code means something went wrong.
 		return result;
 	}
@@ -199,6 +341,36 @@ static int dts_file_read_frame(DTS_FILE* const dts_file, const BOOL ext) {
 	return TRUE;
 }
 
+static int dts_file_skip_frame(DTS_FILE* const dts_file, const BOOL ext) {
+	//Skip over the next frame using only its header.
+
+	size_t size;
+	int result;
+
+	//Read the next sync word from the file.
+	if (!dts_file_read_sync_word(dts_file, &dts_file->frame.sync_word)) {
+		//No more data, probably the end of the file.
+		return FALSE;
+	}
+
+	//Same as dts_file_read_frame, the sync word decides whether this is the expected frame.
+	if (ext && !dts_file_ext_sync_word(dts_file->frame.sync_word)) {
+		return -DCADEC_ENOSYNC;
+	}
+
+	//Read the next frame header from the file.
+	if ((result = dts_file_read_frame_header(dts_file, &size)) <= 0) {
+		return result;
+	}
+
+	//Seek past the frame data instead of reading it.
+	if (!bassfunc->file.Seek(dts_file->bass_file, dts_file_position(dts_file) + size - DCADEC_FRAME_HEADER_SIZE)) {
+		return FALSE;
+	}
+
+	return TRUE;
+}
+
 static size_t dts_file_align(const size_t value) {
 	//Align a value to closest power of 2 (limited to 32 bits).
 	size_t result = value;
@@ -215,9 +387,12 @@ static size_t dts_file_align(const size_t value) {
 BOOL dts_file_read(DTS_FILE* const dts_file) {
 	//Attempt to read a new frame (including extended info) from the file.
 
+	uint64_t start = dca_stats_time();
+	BYTE* data = NULL;
 	int result;
 
 	dts_file->frame.size = 0;
+	dts_file->frame.direct = dts_file->map_length != 0;
 
 	//Read the next core frame from the file.
 	while (TRUE) {
@@ -246,6 +421,17 @@ BOOL dts_file_read(DTS_FILE* const dts_file) {
 		dts_file->frame.sync_word = 0;
 	}
 
+	if (dts_file->frame.direct) {
+		//The decoder reads a little past the end of the frame, near the end of the file it needs the buffer.
+		if (!(data = dts_file_map_range(dts_file, dts_file->frame.position, dts_file->frame.size + DCADEC_BUFFER_PADDING)) &&
+			!dts_file_copy_direct(dts_file)) {
+			return FALSE;
+		}
+	}
+	dts_file->frame.data = dts_file->frame.direct ?
+		data :
+		dts_file->frame.buffer;
+
 	if (!dts_file->info.initialized) {
 		//This is not 100% accurate.
 		//There appears to be some additional data in the file after the first frame which isn't actual frame data.
@@ -254,9 +440,84 @@ BOOL dts_file_read(DTS_FILE* const dts_file) {
 		dts_file->info.initialized = TRUE;
 	}
 
+	dca_stats_add(&dts_file->read_stats, &start, "dts_file_read");
 	return TRUE;
 }
 
+BOOL dts_file_skip(DTS_FILE* const dts_file) {
+	//Skip the next frame (including extended info) without reading its data.
+
+	int result;
+
+	if (dts_file_skip_frame(dts_file, FALSE) != TRUE) {
+		return FALSE;
+	}
+
+	if (dts_file_core_sync_word(dts_file->frame.sync_word)) {
+		dts_file->frame.sync_word = 0;
+		result = dts_file_skip_frame(dts_file, TRUE);
+		if (result != TRUE && result != -DCADEC_ENOSYNC) {
+			return FALSE;
+		}
+	}
+	else {
+		dts_file->frame.sync_word = 0;
+	}
+
+	return TRUE;
+}
+
+BOOL dts_file_read_hd_header(DTS_FILE* const dts_file, DTS_HD_HEADER* const header) {
+	//Walk the DTS-HD container chunks up to the stream data, the file is left positioned at the first frame.
+	//Raw DTS files are left at the start.
+
+	BYTE data[21];
+	uint64_t chunk[2];
+	QWORD position = dts_file_position(dts_file);
+	int count;
+
+	ZeroMemory(header, sizeof(DTS_HD_HEADER));
+
+	if (!dts_file_read_required(dts_file, chunk, sizeof(chunk)) || chunk[0] != DCA_64BE_C(DTSHDHDR)) {
+		//Not a container.
+		return bassfunc->file.Seek(dts_file->bass_file, position);
+	}
+
+	header->present = TRUE;
+
+	for (count = 0; count < DTS_HD_MAX_CHUNKS; count++) {
+		uint64_t size = DCA_64BE(chunk[1]);
+		position = dts_file_position(dts_file);
+
+		switch (chunk[0]) {
+		case DCA_64BE_C(STRMDATA):
+			header->stream_start = position;
+			header->stream_end = position + size;
+			return TRUE;
+
+		case DCA_64BE_C(AUPR_HDR):
+			if (size < sizeof(data) || !dts_file_read_required(dts_file, data, sizeof(data))) {
+				return FALSE;
+			}
+			header->aupr_present = TRUE;
+			header->sample_rate = DCA_MEM24BE(&data[3]);
+			header->frame_samples = DCA_MEM16BE(&data[10]);
+			header->sample_count = DCA_MEM40BE(&data[12]);
+			break;
+		}
+
+		if (!bassfunc->file.Seek(dts_file->bass_file, position + size)) {
+			return FALSE;
+		}
+		if (!dts_file_read_required(dts_file, chunk, sizeof(chunk))) {
+			return FALSE;
+		}
+	}
+
+	//Too many chunks, give up.
+	return FALSE;
+}
+
 static BOOL dts_file_synchronize(DTS_FILE* const dts_file) {
 	//Attempt to resynchronize the stream after manual seeking.
 retry:
@@ -323,12 +584,25 @@ QWORD dts_file_position(const DTS_FILE* const dts_file) {
 	return bassfunc->file.GetPos(dts_file->bass_file, BASS_FILEPOS_CURRENT);
 }
 
+QWORD dts_file_frame_position(const DTS_FILE* const dts_file) {
+	//Get the position of the next frame in bytes, the sync word may already have been consumed.
+	QWORD position = dts_file_position(dts_file);
+	if (dts_file_sync_word(dts_file->frame.sync_word)) {
+		position -= sizeof(UINT);
+	}
+	return position;
+}
+
 QWORD dts_file_length(const DTS_FILE* const dts_file) {
 	//Get the file length in bytes.
 	return bassfunc->file.GetPos(dts_file->bass_file, BASS_FILEPOS_END);
 }
 
 BOOL dts_file_free(DTS_FILE* const dts_file) {
+	if (dts_file->map) {
+		file_map_unmap(dts_file->map_data);
+		file_map_release(dts_file->map);
+	}
 	ta_free(dts_file);
 	return TRUE;
 }
\ No newline at end of file
@@ -1,5 +1,18 @@
 #include "bass_dts.h"
 
+//Upper bound for the number of DTS-HD container chunks examined before the stream data.
+#define DTS_HD_MAX_CHUNKS 32
+
+typedef struct {
+	BOOL present;
+	BOOL aupr_present;
+	DWORD sample_rate;
+	DWORD frame_samples;
+	QWORD sample_count;
+	QWORD stream_start;
+	QWORD stream_end;
+} DTS_HD_HEADER;
+
 typedef enum {
 	DTS_FILE_SEEK_BEGIN,
 	DTS_FILE_SEEK_POSITION,
@@ -8,12 +21,24 @@ typedef enum {
 
 BOOL dts_file_create(const BASSFILE bass_file, DTS_FILE** const dts_file);
 
+BOOL dts_file_map(DTS_FILE* const dts_file, const void* const memory, const QWORD length);
+
+BOOL dts_file_reserve(DTS_FILE* const dts_file, size_t size);
+
+BOOL dts_file_trim(DTS_FILE* const dts_file);
+
 BOOL dts_file_read(DTS_FILE* const dts_file);
 
+BOOL dts_file_skip(DTS_FILE* const dts_file);
+
+BOOL dts_file_read_hd_header(DTS_FILE* const dts_file, DTS_HD_HEADER* const header);
+
 BOOL dts_file_seek(DTS_FILE* const dts_file, const QWORD position, const DTS_FILE_SEEK mode);
 
 QWORD dts_file_position(const DTS_FILE* const dts_file);
 
+QWORD dts_file_frame_position(const DTS_FILE* const dts_file);
+
 QWORD dts_file_length(const DTS_FILE* const dts_file);
 
 BOOL dts_file_free(DTS_FILE* const dts_file);
\ No newline at end of file
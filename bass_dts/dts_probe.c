@@ -0,0 +1,84 @@
+#include "dts_probe.h"
+#include "dts_file.h"
+
+static BOOL dts_probe_length(DTS_FILE* const dts_file, const DTS_HD_HEADER* const header, BASS_DTS_PROBEINFO* const info) {
+	//Estimate the length from the average size of the first few frames.
+	QWORD start = dts_file->info.start;
+	QWORD end = header->present ? header->stream_end : dts_file_length(dts_file);
+	QWORD position;
+	int frames;
+
+	//The first frame has already been read.
+	for (frames = 1; frames < DTS_PROBE_FRAMES; frames++) {
+		if (!dts_file_skip(dts_file)) {
+			break;
+		}
+	}
+
+	position = dts_file_frame_position(dts_file);
+	if (position <= start || end <= start) {
+		return FALSE;
+	}
+
+	info->length = (end - start) * frames / (position - start) * info->frame_samples;
+	info->exact = FALSE;
+	return TRUE;
+}
+
+BOOL dts_probe(const BASSFILE file, BASS_DTS_PROBEINFO* const info) {
+	//Fill the info from the first frame headers, nothing is decoded.
+	DTS_FILE* dts_file;
+	DTS_HD_HEADER header;
+	struct dcadec_frame_info frame_info;
+	BOOL result = FALSE;
+
+	ZeroMemory(info, sizeof(BASS_DTS_PROBEINFO));
+
+	if (!dts_file_create(file, &dts_file)) {
+		//Allocation failed.
+		return FALSE;
+	}
+
+	if (!dts_file_read_hd_header(dts_file, &header)) {
+		//Broken container.
+		goto done;
+	}
+
+	if (!dts_file_read(dts_file)) {
+		//No frames.
+		goto done;
+	}
+
+	if (dcadec_frame_probe(dts_file->frame.data, dts_file->frame.size, &frame_info) < 0) {
+		//Not something we can decode.
+		goto done;
+	}
+
+	info->freq = frame_info.exss.sample_rate;
+	info->chans = frame_info.exss.nchannels;
+	info->speakers = frame_info.exss.spkr_mask;
+	info->origres = frame_info.exss.bits_per_sample;
+	info->profile = frame_info.exss.profile;
+	info->matrix = frame_info.exss.matrix_encoding;
+	info->embedded_stereo = frame_info.exss.embedded_stereo;
+	info->embedded_6ch = frame_info.exss.embedded_6ch;
+	info->core = frame_info.core_present;
+	info->extensions = frame_info.exss_present;
+	info->frame_samples = frame_info.nframesamples;
+
+	if (header.aupr_present && header.sample_count && header.sample_rate) {
+		//The container knows the exact length, it may be specified at a different sample rate.
+		info->length = header.sample_count * info->freq / header.sample_rate;
+		info->exact = TRUE;
+	}
+	else if (!dts_probe_length(dts_file, &header, info)) {
+		//The length is unknown but the rest of the info is still valid.
+		info->length = 0;
+	}
+
+	result = TRUE;
+
+done:
+	dts_file_free(dts_file);
+	return result;
+}
\ No newline at end of file
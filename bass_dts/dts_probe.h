@@ -0,0 +1,6 @@
+#include "bass_dts.h"
+
+//Number of frames examined (by header only) to estimate the length of streams without a DTS-HD container.
+#define DTS_PROBE_FRAMES 16
+
+BOOL dts_probe(const BASSFILE file, BASS_DTS_PROBEINFO* const info);
\ No newline at end of file
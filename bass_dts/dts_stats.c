@@ -0,0 +1,217 @@
+#include "dts_stats.h"
+
+//Streams being decoded and the totals of the ones already freed.
+//Counters of live streams are read while they are being written by the decoding thread,
+//so the process wide figures are a close snapshot rather than exact.
+static CRITICAL_SECTION lock;
+static DTS_STREAM** streams;
+static int stream_count;
+static int stream_capacity;
+static BASS_DTS_STATS retired;
+
+//Timer and performance counter values when the plugin was loaded, used to measure the timer frequency.
+static QWORD timer_start;
+static LARGE_INTEGER counter_start;
+
+QWORD dts_stats_frequency() {
+	//Compare the timer against the performance counter over the time since the plugin was loaded.
+	LARGE_INTEGER counter;
+	LARGE_INTEGER frequency;
+	QWORD ticks = dcadec_stats_timer() - timer_start;
+	QueryPerformanceCounter(&counter);
+	QueryPerformanceFrequency(&frequency);
+	if (counter.QuadPart <= counter_start.QuadPart) {
+		return 0;
+	}
+	return (QWORD)((double)ticks * frequency.QuadPart / (counter.QuadPart - counter_start.QuadPart));
+}
+
+static void dts_stats_stage(BASS_DTS_STAGE* const stage, const struct dcadec_stage_stats* const stats) {
+	stage->time = stats->ticks;
+	stage->calls = stats->calls;
+}
+
+static void dts_stats_collect(const DTS_STREAM* const stream, BASS_DTS_STATS* const stats) {
+	//Combine the decoder counters with the ones of the file and stream.
+	struct dcadec_stats dcadec_stats;
+	int index;
+
+	ZeroMemory(stats, sizeof(BASS_DTS_STATS));
+	if (dcadec_context_get_stats(stream->dcadec_context, &dcadec_stats) == 0) {
+		for (index = 0; index < DCADEC_STAGE_COUNT; index++) {
+			dts_stats_stage(&stats->stages[index], &dcadec_stats.stages[index]);
+		}
+		for (index = 0; index < 10; index++) {
+			stats->warnings[index] = dcadec_stats.nwarnings[index];
+		}
+		stats->frames = dcadec_stats.nframes;
+		stats->errors = dcadec_stats.nerrors;
+		stats->pbr_copied = dcadec_stats.pbr_copied;
+	}
+	dts_stats_stage(&stats->stages[BASS_DTS_STAGE_FILE_READ], &stream->dts_file->read_stats);
+	dts_stats_stage(&stats->stages[BASS_DTS_STAGE_CONVERT], &stream->dts_file->convert_stats);
+	dts_stats_stage(&stats->stages[BASS_DTS_STAGE_PCM], &stream->pcm_stats);
+	stats->resyncs = stream->dts_file->resyncs;
+	stats->underruns = stream->underruns;
+}
+
+static void dts_stats_add(BASS_DTS_STATS* const total, const BASS_DTS_STATS* const stats) {
+	int index;
+	for (index = 0; index < BASS_DTS_STAGE_COUNT; index++) {
+		total->stages[index].time += stats->stages[index].time;
+		total->stages[index].calls += stats->stages[index].calls;
+	}
+	for (index = 0; index < 10; index++) {
+		total->warnings[index] += stats->warnings[index];
+	}
+	total->frames += stats->frames;
+	total->errors += stats->errors;
+	total->resyncs += stats->resyncs;
+	total->underruns += stats->underruns;
+	total->pbr_copied += stats->pbr_copied;
+}
+
+static void dts_stats_account(BASS_DTS_MEMORY_ACCOUNT* const account, const struct ta_account* const stats) {
+	account->live = stats->live;
+	account->peak = stats->peak;
+	account->allocs = stats->nallocs;
+	account->reallocs = stats->nreallocs;
+	account->frees = stats->nfrees;
+}
+
+static void dts_stats_collect_memory(const DTS_STREAM* const stream, BASS_DTS_MEMORY* const memory) {
+	//Same as dts_stats_collect, for the memory accounts.
+	struct dcadec_memory_stats dcadec_memory_stats;
+	int index;
+
+	ZeroMemory(memory, sizeof(BASS_DTS_MEMORY));
+	for (index = 0; index < DCADEC_MEM_COUNT; index++) {
+		if (dcadec_context_get_memory_stats(stream->dcadec_context, index, &dcadec_memory_stats) == 0) {
+			memory->accounts[index].live = dcadec_memory_stats.live;
+			memory->accounts[index].peak = dcadec_memory_stats.peak;
+			memory->accounts[index].allocs = dcadec_memory_stats.nallocs;
+			memory->accounts[index].reallocs = dcadec_memory_stats.nreallocs;
+			memory->accounts[index].frees = dcadec_memory_stats.nfrees;
+		}
+	}
+	dts_stats_account(&memory->accounts[BASS_DTS_MEM_FILE], &stream->dts_file->account);
+	memory->size = sizeof(DTS_STREAM) +
+		memory->accounts[DCADEC_MEM_TOTAL].live +
+		memory->accounts[BASS_DTS_MEM_FILE].live;
+}
+
+BOOL dts_stats_init() {
+	InitializeCriticalSection(&lock);
+	streams = NULL;
+	stream_count = 0;
+	stream_capacity = 0;
+	ZeroMemory(&retired, sizeof(retired));
+	timer_start = dcadec_stats_timer();
+	QueryPerformanceCounter(&counter_start);
+	return TRUE;
+}
+
+BOOL dts_stats_register(DTS_STREAM* const stream) {
+	DTS_STREAM** buffer;
+	BOOL result = TRUE;
+
+	EnterCriticalSection(&lock);
+	if (stream_count == stream_capacity) {
+		buffer = realloc(streams, (stream_capacity + 16) * sizeof(DTS_STREAM*));
+		if (buffer) {
+			streams = buffer;
+			stream_capacity += 16;
+		}
+		else {
+			//The stream still works, it's just missing from the process wide figures.
+			result = FALSE;
+		}
+	}
+	if (result) {
+		streams[stream_count++] = stream;
+	}
+	LeaveCriticalSection(&lock);
+
+	return result;
+}
+
+BOOL dts_stats_unregister(DTS_STREAM* const stream) {
+	//Move the counters of the stream into the totals, it is about to be freed.
+	BASS_DTS_STATS stats;
+	BOOL result = FALSE;
+	int index;
+
+	EnterCriticalSection(&lock);
+	for (index = 0; index < stream_count; index++) {
+		if (streams[index] == stream) {
+			dts_stats_collect(stream, &stats);
+			dts_stats_add(&retired, &stats);
+			streams[index] = streams[--stream_count];
+			result = TRUE;
+			break;
+		}
+	}
+	LeaveCriticalSection(&lock);
+
+	return result;
+}
+
+BOOL dts_stats_get(const DTS_STREAM* const stream, BASS_DTS_STATS* const stats) {
+	dts_stats_collect(stream, stats);
+	stats->frequency = dts_stats_frequency();
+	return TRUE;
+}
+
+BOOL dts_stats_get_all(BASS_DTS_STATS* const stats) {
+	BASS_DTS_STATS stream_stats;
+	int index;
+
+	EnterCriticalSection(&lock);
+	*stats = retired;
+	for (index = 0; index < stream_count; index++) {
+		dts_stats_collect(streams[index], &stream_stats);
+		dts_stats_add(stats, &stream_stats);
+	}
+	LeaveCriticalSection(&lock);
+
+	stats->frequency = dts_stats_frequency();
+	return TRUE;
+}
+
+BOOL dts_stats_memory(const DTS_STREAM* const stream, BASS_DTS_MEMORY* const memory) {
+	dts_stats_collect_memory(stream, memory);
+	return TRUE;
+}
+
+BOOL dts_stats_memory_all(BASS_DTS_MEMORY* const memory) {
+	//Sum of the streams that are currently open, so peaks are the sum of each stream's peak.
+	BASS_DTS_MEMORY stream_memory;
+	int index;
+	int account;
+
+	ZeroMemory(memory, sizeof(BASS_DTS_MEMORY));
+	EnterCriticalSection(&lock);
+	for (index = 0; index < stream_count; index++) {
+		dts_stats_collect_memory(streams[index], &stream_memory);
+		for (account = 0; account < BASS_DTS_MEM_COUNT; account++) {
+			memory->accounts[account].live += stream_memory.accounts[account].live;
+			memory->accounts[account].peak += stream_memory.accounts[account].peak;
+			memory->accounts[account].allocs += stream_memory.accounts[account].allocs;
+			memory->accounts[account].reallocs += stream_memory.accounts[account].reallocs;
+			memory->accounts[account].frees += stream_memory.accounts[account].frees;
+		}
+		memory->size += stream_memory.size;
+	}
+	LeaveCriticalSection(&lock);
+
+	return TRUE;
+}
+
+BOOL dts_stats_free() {
+	free(streams);
+	streams = NULL;
+	stream_count = 0;
+	stream_capacity = 0;
+	DeleteCriticalSection(&lock);
+	return TRUE;
+}
\ No newline at end of file
@@ -0,0 +1,19 @@
+#include "bass_dts.h"
+
+BOOL dts_stats_init();
+
+BOOL dts_stats_register(DTS_STREAM* const stream);
+
+BOOL dts_stats_unregister(DTS_STREAM* const stream);
+
+BOOL dts_stats_get(const DTS_STREAM* const stream, BASS_DTS_STATS* const stats);
+
+BOOL dts_stats_get_all(BASS_DTS_STATS* const stats);
+
+BOOL dts_stats_memory(const DTS_STREAM* const stream, BASS_DTS_MEMORY* const memory);
+
+BOOL dts_stats_memory_all(BASS_DTS_MEMORY* const memory);
+
+QWORD dts_stats_frequency();
+
+BOOL dts_stats_free();
\ No newline at end of file
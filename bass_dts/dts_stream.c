@@ -1,8 +1,34 @@
 #include "dts_stream.h"
 #include "dts_file.h"
 #include "pcm.h"
+#include "context_pool.h"
+#include "dts_stats.h"
+#include "../libdcadec/common.h"
+#include "../libdcadec/stats.h"
 
-BOOL dts_stream_create(const BASSFILE file, const int flags, DTS_STREAM** const stream) {
+static BOOL dts_stream_reserve(DTS_STREAM* const stream) {
+	//Decode the first frame now so the decoder allocates its buffers for this stream's configuration.
+	if (!dts_stream_filter(stream)) {
+		return FALSE;
+	}
+	stream->parsed = FALSE;
+
+	//Set aside what the buffers can still grow by for the largest configuration the headers allow (X96, channel sets, frequency bands).
+	//The paths that can allocate anyway are listed at dcadec_context_get_reserve_size.
+	if (dcadec_context_reserve(stream->dcadec_context, dcadec_context_get_reserve_size(stream->dcadec_context)) < 0) {
+		return FALSE;
+	}
+	if (!dts_file_reserve(stream->dts_file, dcadec_context_get_max_frame_size(stream->dcadec_context))) {
+		return FALSE;
+	}
+
+	//Anything allocated from here on is counted.
+	stream->heap_allocs = dcadec_context_get_heap_allocs(stream->dcadec_context);
+	stream->dts_file->allocations = 0;
+	return TRUE;
+}
+
+BOOL dts_stream_create(const BASSFILE file, const void* const memory, const QWORD length, const int flags, const BOOL realtime, const BOOL compact, DTS_STREAM** const stream) {
 	*stream = calloc(sizeof(DTS_STREAM), 1);
 	if (!*stream) {
 		//Allocation failed.
@@ -16,17 +42,25 @@ BOOL dts_stream_create(const BASSFILE file, const int flags, DTS_STREAM** const
 		return FALSE;
 	}
 
-	if (!((*stream)->dcadec_context = dcadec_context_create(flags))) {
+	//Not being able to map the file isn't fatal, frames are read through BASS instead.
+	dts_file_map((*stream)->dts_file, memory, length);
+
+	(*stream)->decoder_flags = flags;
+	(*stream)->realtime = realtime;
+	(*stream)->compact = compact;
+	if (!context_pool_acquire(flags, &(*stream)->dcadec_context)) {
 		//Context creation failed.
 		dts_stream_free(*stream);
 		return FALSE;
 	}
 
-	if (!dts_stream_update(*stream)) {
+	//Only parse the first frame, it is converted to PCM by the first call to dts_stream_update.
+	if (!dts_stream_parse(*stream)) {
 		//Could not determine enough information to create a stream.
 		dts_stream_free(*stream);
 		return FALSE;
 	}
+	(*stream)->parsed = TRUE;
 
 	if (!dts_stream_update_info(*stream)) {
 		//Could not determine enough information to create a stream.
@@ -34,15 +68,20 @@ BOOL dts_stream_create(const BASSFILE file, const int flags, DTS_STREAM** const
 		return FALSE;
 	}
 
+	if (realtime && !dts_stream_reserve(*stream)) {
+		//Could not decode the first frame or reserve memory.
+		dts_stream_free(*stream);
+		return FALSE;
+	}
+
+	//Not being able to register the stream only leaves it out of the process wide stats.
+	dts_stats_register(*stream);
+
 	return TRUE;
 }
 
-BOOL dts_stream_update(DTS_STREAM* const stream) {
-	//Attempt to read a new frame (including extended info) from the file and convert it to PCM.
-	int channel_mask;
-	int sample_rate;
-	int bits_per_sample;
-	int profile;
+BOOL dts_stream_parse(DTS_STREAM* const stream) {
+	//Attempt to read a new frame (including extended info) from the file and parse it.
 	int result;
 
 	//Attempt to read a new frame (including extended info) from the file.
@@ -51,11 +90,21 @@ BOOL dts_stream_update(DTS_STREAM* const stream) {
 	}
 
 	//Attempt to parse the frame.
-	if ((result = dcadec_context_parse(stream->dcadec_context, stream->dts_file->frame.buffer, stream->dts_file->frame.size)) < 0) {
+	if ((result = dcadec_context_parse(stream->dcadec_context, stream->dts_file->frame.data, stream->dts_file->frame.size)) < 0) {
 		return FALSE;
 	}
 
-	//Attempt to convert the frame to PCM.
+	return TRUE;
+}
+
+BOOL dts_stream_filter(DTS_STREAM* const stream) {
+	//Attempt to convert the parsed frame to PCM.
+	int channel_mask;
+	int sample_rate;
+	int bits_per_sample;
+	int profile;
+	int result;
+
 	if ((result = dcadec_context_filter(stream->dcadec_context, &stream->samples, &stream->sample_count, &channel_mask, &sample_rate, &bits_per_sample, &profile)) < 0) {
 		return FALSE;
 	}
@@ -68,16 +117,43 @@ BOOL dts_stream_update(DTS_STREAM* const stream) {
 	return TRUE;
 }
 
+BOOL dts_stream_update(DTS_STREAM* const stream) {
+	//Attempt to read a new frame from the file and convert it to PCM.
+	if (stream->parsed) {
+		//The frame parsed when the stream was created has not been converted yet.
+		stream->parsed = FALSE;
+	}
+	else if (!dts_stream_parse(stream)) {
+		return FALSE;
+	}
+	return dts_stream_filter(stream);
+}
+
 BOOL dts_stream_update_info(DTS_STREAM* const stream) {
 	//Attempt to fetch the core and extended frame information.
 	struct dcadec_core_info* dcadec_core_info = dcadec_context_get_core_info(stream->dcadec_context);
 	struct dcadec_exss_info* dcadec_exss_info = dcadec_context_get_exss_info(stream->dcadec_context);
 
+	int samples_per_frame;
+	int bits_per_sample;
+
 	//If there's no core info something is wrong.
 	if (!dcadec_core_info) {
+		dcadec_context_free_exss_info(dcadec_exss_info);
 		return FALSE;
 	}
 
+	//The output format is known from the parsed frame, no need to convert it to PCM.
+	if (dcadec_context_get_format(stream->dcadec_context, &samples_per_frame, NULL, &bits_per_sample, NULL) < 0) {
+		dcadec_context_free_exss_info(dcadec_exss_info);
+		dcadec_context_free_core_info(dcadec_core_info);
+		return FALSE;
+	}
+
+	stream->input_format.bits_per_sample = bits_per_sample;
+	stream->input_format.bytes_per_sample = bits_per_sample / 8;
+	stream->input_format.samples_per_frame = samples_per_frame;
+
 	stream->channel_count = dcadec_core_info->nchannels;
 	stream->sample_rate = dcadec_core_info->sample_rate;
 
@@ -103,6 +179,7 @@ DWORD dts_stream_read(DTS_STREAM* const stream, void* buffer, const DWORD length
 	DWORD position = 0;
 	DWORD remaining = length;
 	DWORD size = stream->output_format.bytes_per_sample * stream->channel_count;
+	uint64_t start = dca_stats_time();
 	int channel;
 
 	while (TRUE) {
@@ -122,23 +199,82 @@ DWORD dts_stream_read(DTS_STREAM* const stream, void* buffer, const DWORD length
 		remaining -= size;
 	}
 
+	dca_stats_add(&stream->pcm_stats, &start, "dts_stream_read");
 	return length - remaining;
 }
 
 BOOL dts_stream_reset(DTS_STREAM* const stream, BOOL clear_context) {
+	//Samples kept by dts_stream_trim are released once read (or thrown away).
+	ta_free(stream->pending);
+	stream->pending = NULL;
 	stream->samples = NULL;
 	stream->sample_count = 0;
 	stream->sample_position = 0;
 	if (clear_context) {
+		//The pending frame (if any) belongs to the old position.
+		stream->parsed = FALSE;
 		dcadec_context_clear(stream->dcadec_context);
 	}
 	return TRUE;
 }
 
+DWORD dts_stream_allocations(const DTS_STREAM* const stream) {
+	//Count the allocations made after a real-time stream was created.
+	if (!stream->realtime) {
+		return 0;
+	}
+	return stream->dts_file->allocations + (DWORD)(dcadec_context_get_heap_allocs(stream->dcadec_context) - stream->heap_allocs);
+}
+
+static BOOL dts_stream_keep_pending(DTS_STREAM* const stream) {
+	//Copy the samples not read yet out of the decoder, they are the only part of the frame still needed.
+	const int remaining = stream->sample_count - stream->sample_position;
+	int** pending;
+	int channel;
+
+	if (!stream->samples || remaining <= 0 || stream->pending) {
+		return TRUE;
+	}
+	pending = ta_alloc_size(stream->dts_file, stream->channel_count * (sizeof(int*) + remaining * sizeof(int)));
+	if (!pending) {
+		return FALSE;
+	}
+	for (channel = 0; channel < stream->channel_count; channel++) {
+		pending[channel] = (int*)(pending + stream->channel_count) + channel * remaining;
+		memcpy(pending[channel], stream->samples[channel] + stream->sample_position, remaining * sizeof(int));
+	}
+	stream->pending = pending;
+	stream->samples = pending;
+	stream->sample_count = remaining;
+	stream->sample_position = 0;
+	return TRUE;
+}
+
+BOOL dts_stream_trim(DTS_STREAM* const stream) {
+	//Release the buffers of an idle stream, decoding continues where it left off.
+	if (stream->realtime || (stream->decoder_flags & DCADEC_FLAG_ARENA)) {
+		//Everything was reserved up front, releasing it would make decoding allocate again. An arena only gets the memory back into its slabs anyway.
+		return FALSE;
+	}
+	if (stream->parsed) {
+		//The first frame has not been decoded yet, nothing to release.
+		return TRUE;
+	}
+	if (!dts_stream_keep_pending(stream)) {
+		return FALSE;
+	}
+	dcadec_context_trim(stream->dcadec_context);
+	dts_file_trim(stream->dts_file);
+	return TRUE;
+}
+
 BOOL dts_stream_free(DTS_STREAM* const stream) {
+	//The counters are added to the process wide totals before the file and context go away.
+	dts_stats_unregister(stream);
 	dts_file_free(stream->dts_file);
 	if (stream->dcadec_context) {
-		dcadec_context_destroy(stream->dcadec_context);
+		//Hand the context back for reuse by the next stream.
+		context_pool_release(stream->decoder_flags, stream->dcadec_context);
 	}
 	free(stream);
 	return TRUE;
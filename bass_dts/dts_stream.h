@@ -1,6 +1,10 @@
 #include "bass_dts.h"
 
-BOOL dts_stream_create(const BASSFILE file, const int flags, DTS_STREAM** const stream);
+BOOL dts_stream_create(const BASSFILE file, const void* const memory, const QWORD length, const int flags, const BOOL realtime, const BOOL compact, DTS_STREAM** const stream);
+
+BOOL dts_stream_parse(DTS_STREAM* const stream);
+
+BOOL dts_stream_filter(DTS_STREAM* const stream);
 
 BOOL dts_stream_update(DTS_STREAM* const stream);
 
@@ -10,4 +14,8 @@ DWORD dts_stream_read(DTS_STREAM* const stream, void* buffer, const DWORD length
 
 BOOL dts_stream_reset(DTS_STREAM* const stream, BOOL clear_context);
 
+DWORD dts_stream_allocations(const DTS_STREAM* const stream);
+
+BOOL dts_stream_trim(DTS_STREAM* const stream);
+
 BOOL dts_stream_free(DTS_STREAM* const stream);
\ No newline at end of file
@@ -0,0 +1,114 @@
+#include "dts_trace.h"
+#include "dts_stats.h"
+
+//Size of the span ring, the first size it was started with is kept until it is freed.
+static DWORD trace_size;
+
+typedef struct {
+	char* buffer;
+	DWORD length;
+	DWORD position;
+} TRACE_WRITER;
+
+static void dts_trace_write(TRACE_WRITER* const writer, const char* const text) {
+	//Append the text, what doesn't fit in the buffer is only counted.
+	const char* c;
+	for (c = text; *c; c++) {
+		if (writer->position < writer->length) {
+			writer->buffer[writer->position] = *c;
+		}
+		writer->position++;
+	}
+}
+
+static void dts_trace_write_number(TRACE_WRITER* const writer, QWORD value, const int decimals) {
+	//Append a number with the specified count of decimals, value is scaled accordingly.
+	char text[32];
+	int position = sizeof(text) - 1;
+	int digits = 0;
+	text[position] = 0;
+	do {
+		text[--position] = '0' + (char)(value % 10);
+		value /= 10;
+		if (++digits == decimals) {
+			text[--position] = '.';
+		}
+	} while (value || digits <= decimals);
+	dts_trace_write(writer, text + position);
+}
+
+static QWORD dts_trace_nanoseconds(const QWORD ticks, const QWORD frequency) {
+	return (QWORD)((double)ticks * 1000000000 / frequency);
+}
+
+BOOL dts_trace_start(const DWORD size) {
+	if (dcadec_trace_start(size) < 0) {
+		return FALSE;
+	}
+	if (!trace_size) {
+		for (trace_size = 1; trace_size < size; trace_size <<= 1);
+	}
+	return TRUE;
+}
+
+BOOL dts_trace_stop() {
+	dcadec_trace_stop();
+	return TRUE;
+}
+
+BOOL dts_trace_json(char* const buffer, const DWORD length, DWORD* const result) {
+	//Write the recorded spans in the Chrome trace event format, times are in microseconds since the first span.
+	TRACE_WRITER writer = { buffer, buffer ? length : 0, 0 };
+	struct dcadec_trace_event* events;
+	QWORD frequency = dts_stats_frequency();
+	QWORD origin;
+	DWORD pid = GetCurrentProcessId();
+	size_t count;
+	size_t index;
+
+	if (!trace_size || !frequency) {
+		//Not started or built without timers.
+		return FALSE;
+	}
+	if (!(events = malloc(trace_size * sizeof(struct dcadec_trace_event)))) {
+		return FALSE;
+	}
+	count = dcadec_trace_read(events, trace_size);
+
+	origin = count ? events[0].start : 0;
+	for (index = 1; index < count; index++) {
+		if (events[index].start < origin) {
+			origin = events[index].start;
+		}
+	}
+
+	dts_trace_write(&writer, "{\"traceEvents\":[");
+	for (index = 0; index < count; index++) {
+		dts_trace_write(&writer, index ? ",\n{\"name\":\"" : "\n{\"name\":\"");
+		dts_trace_write(&writer, events[index].name);
+		dts_trace_write(&writer, "\",\"ph\":\"X\",\"pid\":");
+		dts_trace_write_number(&writer, pid, 0);
+		dts_trace_write(&writer, ",\"tid\":");
+		dts_trace_write_number(&writer, events[index].thread, 0);
+		dts_trace_write(&writer, ",\"ts\":");
+		dts_trace_write_number(&writer, dts_trace_nanoseconds(events[index].start - origin, frequency), 3);
+		dts_trace_write(&writer, ",\"dur\":");
+		dts_trace_write_number(&writer, dts_trace_nanoseconds(events[index].end - events[index].start, frequency), 3);
+		dts_trace_write(&writer, "}");
+	}
+	dts_trace_write(&writer, "\n],\"displayTimeUnit\":\"ns\"}");
+	free(events);
+
+	//Terminate the text if there is room for it.
+	if (writer.position < writer.length) {
+		writer.buffer[writer.position] = 0;
+	}
+	*result = writer.position;
+	return TRUE;
+}
+
+BOOL dts_trace_free() {
+	dcadec_trace_free();
+	trace_size = 0;
+	return TRUE;
+}
\ No newline at end of file
@@ -0,0 +1,9 @@
+#include "bass_dts.h"
+
+BOOL dts_trace_start(const DWORD size);
+
+BOOL dts_trace_stop();
+
+BOOL dts_trace_json(char* const buffer, const DWORD length, DWORD* const result);
+
+BOOL dts_trace_free();
\ No newline at end of file
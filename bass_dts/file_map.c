@@ -0,0 +1,208 @@
+#include "file_map.h"
+
+//Read only mappings of files being played, streams of the same file share one mapping and each maps its own window of it.
+static CRITICAL_SECTION lock;
+static FILE_MAP* entries[FILE_MAP_SIZE];
+static DWORD granularity;
+
+static WCHAR* file_map_name(const BASSFILE file) {
+	//Get a copy of the file name as a wide string, NULL for memory and user files.
+	BOOL unicode;
+	const void* name = bassfunc->file.GetFileName(file, &unicode);
+	WCHAR* result;
+	int length;
+	if (!name) {
+		return NULL;
+	}
+	if (unicode) {
+		length = lstrlenW(name) + 1;
+		if (!(result = calloc(length, sizeof(WCHAR)))) {
+			return NULL;
+		}
+		CopyMemory(result, name, length * sizeof(WCHAR));
+	}
+	else {
+		if (!(length = MultiByteToWideChar(CP_ACP, 0, name, -1, NULL, 0))) {
+			return NULL;
+		}
+		if (!(result = calloc(length, sizeof(WCHAR)))) {
+			return NULL;
+		}
+		MultiByteToWideChar(CP_ACP, 0, name, -1, result, length);
+	}
+	return result;
+}
+
+static void file_map_destroy(FILE_MAP* const map) {
+	if (map->mapping) {
+		CloseHandle(map->mapping);
+	}
+	if (map->file != INVALID_HANDLE_VALUE) {
+		CloseHandle(map->file);
+	}
+	free(map->name);
+	free(map);
+}
+
+static FILE_MAP* file_map_create(WCHAR* const name) {
+	LARGE_INTEGER size;
+	FILE_MAP* map = calloc(1, sizeof(FILE_MAP));
+	if (!map) {
+		free(name);
+		return NULL;
+	}
+	map->name = name;
+	//Shared like BASS opens the files it reads, the file can't be truncated while a view of it is mapped.
+	map->file = CreateFileW(name, GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (map->file == INVALID_HANDLE_VALUE || !GetFileSizeEx(map->file, &size) || !size.QuadPart) {
+		//Can't open (or map an empty) file.
+		file_map_destroy(map);
+		return NULL;
+	}
+	map->length = size.QuadPart;
+	//Only the mapping object, views of it are mapped by file_map_window.
+	if (!(map->mapping = CreateFileMappingW(map->file, NULL, PAGE_READONLY, 0, 0, NULL))) {
+		file_map_destroy(map);
+		return NULL;
+	}
+	return map;
+}
+
+static FILE_MAP* file_map_find(const WCHAR* const name, int* const free_index) {
+	//Find the entry of a file, and the first free slot if it has none. Must be called with the lock held.
+	int index;
+	*free_index = -1;
+	for (index = 0; index < FILE_MAP_SIZE; index++) {
+		if (!entries[index]) {
+			if (*free_index < 0) {
+				*free_index = index;
+			}
+			continue;
+		}
+		if (!lstrcmpiW(entries[index]->name, name)) {
+			return entries[index];
+		}
+	}
+	return NULL;
+}
+
+BOOL file_map_init() {
+	SYSTEM_INFO info;
+	InitializeCriticalSection(&lock);
+	ZeroMemory(entries, sizeof(entries));
+	//Views must start on a multiple of this (64 KiB on every Windows so far).
+	GetSystemInfo(&info);
+	granularity = info.dwAllocationGranularity;
+	return TRUE;
+}
+
+BOOL file_map_acquire(const BASSFILE file, FILE_MAP** const map) {
+	WCHAR* name = file_map_name(file);
+	FILE_MAP* created;
+	int index;
+
+	*map = NULL;
+	if (!name) {
+		return FALSE;
+	}
+
+	EnterCriticalSection(&lock);
+	if ((*map = file_map_find(name, &index))) {
+		(*map)->references++;
+	}
+	LeaveCriticalSection(&lock);
+	if (*map || index < 0) {
+		//Already mapped, or all slots are taken.
+		free(name);
+		return *map != NULL;
+	}
+
+	//Opening can block on slow or network drives, other streams shouldn't wait for it.
+	if (!(created = file_map_create(name))) {
+		return FALSE;
+	}
+
+	EnterCriticalSection(&lock);
+	if ((*map = file_map_find(created->name, &index))) {
+		//Another stream mapped the same file in the meantime.
+		(*map)->references++;
+	}
+	else if (index >= 0) {
+		created->references = 1;
+		entries[index] = *map = created;
+		created = NULL;
+	}
+	LeaveCriticalSection(&lock);
+	if (created) {
+		file_map_destroy(created);
+	}
+
+	return *map != NULL;
+}
+
+BOOL file_map_window(const FILE_MAP* const map, const QWORD position, const QWORD size, BYTE** const data, QWORD* const offset, QWORD* const length) {
+	//Replace the view in data with one of up to FILE_MAP_WINDOW bytes which contains position to position + size.
+	QWORD start = position - position % granularity;
+	QWORD end = start + FILE_MAP_WINDOW;
+
+	if (position + size > map->length) {
+		//Past the end of the file, the current view stays.
+		return FALSE;
+	}
+	file_map_unmap(*data);
+	*data = NULL;
+	*offset = 0;
+	*length = 0;
+	if (end < position + size) {
+		end = position + size;
+	}
+	if (end > map->length) {
+		end = map->length;
+	}
+	if (!(*data = MapViewOfFile(map->mapping, FILE_MAP_READ, (DWORD)(start >> 32), (DWORD)start, (SIZE_T)(end - start)))) {
+		return FALSE;
+	}
+	*offset = start;
+	*length = end - start;
+	return TRUE;
+}
+
+BOOL file_map_unmap(BYTE* const data) {
+	if (!data) {
+		return FALSE;
+	}
+	return UnmapViewOfFile(data);
+}
+
+BOOL file_map_release(FILE_MAP* const map) {
+	int index;
+
+	if (!map) {
+		return FALSE;
+	}
+
+	EnterCriticalSection(&lock);
+	if (!--map->references) {
+		for (index = 0; index < FILE_MAP_SIZE; index++) {
+			if (entries[index] == map) {
+				entries[index] = NULL;
+			}
+		}
+		file_map_destroy(map);
+	}
+	LeaveCriticalSection(&lock);
+
+	return TRUE;
+}
+
+BOOL file_map_free() {
+	int index;
+	for (index = 0; index < FILE_MAP_SIZE; index++) {
+		if (entries[index]) {
+			file_map_destroy(entries[index]);
+			entries[index] = NULL;
+		}
+	}
+	DeleteCriticalSection(&lock);
+	return TRUE;
+}
\ No newline at end of file
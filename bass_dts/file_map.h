@@ -0,0 +1,19 @@
+#include "bass_dts.h"
+
+//Maximum number of files mapped at once, streams of further files read through BASS.
+#define FILE_MAP_SIZE 16
+
+//Size of the view every stream maps of its file, a whole file doesn't fit in the address space of a 32 bit process.
+#define FILE_MAP_WINDOW (64 * 1024 * 1024)
+
+BOOL file_map_init();
+
+BOOL file_map_acquire(const BASSFILE file, FILE_MAP** const map);
+
+BOOL file_map_release(FILE_MAP* const map);
+
+BOOL file_map_window(const FILE_MAP* const map, const QWORD position, const QWORD size, BYTE** const data, QWORD* const offset, QWORD* const length);
+
+BOOL file_map_unmap(BYTE* const data);
+
+BOOL file_map_free();
\ No newline at end of file
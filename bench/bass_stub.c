@@ -0,0 +1,99 @@
+#include "bass_stub.h"
+#include "../bass_dts/file_map.h"
+
+static DWORD WINAPI bench_file_read(BASSFILE handle, void* buffer, DWORD length) {
+	BENCH_FILE* file = handle;
+	if (file->position >= file->length) {
+		return 0;
+	}
+	if (length > file->length - file->position) {
+		length = (DWORD)(file->length - file->position);
+	}
+	if (file->stream) {
+		length = (DWORD)fread(buffer, 1, length, file->stream);
+	}
+	else {
+		memcpy(buffer, file->data + file->position, length);
+	}
+	file->position += length;
+	return length;
+}
+
+static BOOL WINAPI bench_file_seek(BASSFILE handle, QWORD position) {
+	BENCH_FILE* file = handle;
+	if (position > file->length || (file->stream && fseeko(file->stream, (off_t)position, SEEK_SET))) {
+		return FALSE;
+	}
+	file->position = position;
+	return TRUE;
+}
+
+static QWORD WINAPI bench_file_get_pos(BASSFILE handle, DWORD mode) {
+	BENCH_FILE* file = handle;
+	switch (mode) {
+	case BASS_FILEPOS_CURRENT:
+		return file->position;
+	case BASS_FILEPOS_END:
+		return file->length;
+	case BASS_FILEPOS_START:
+		return 0;
+	}
+	return (QWORD)-1;
+}
+
+static void WINAPI bench_set_error(int error) {
+}
+
+static const BASS_FUNCTIONS bench_functions = {
+	.SetError = &bench_set_error,
+	.file = {
+		.Read = &bench_file_read,
+		.Seek = &bench_file_seek,
+		.GetPos = &bench_file_get_pos,
+	},
+};
+
+const BASS_FUNCTIONS* bassfunc = &bench_functions;
+
+BASSFILE bench_file_open(BENCH_FILE* const file, const void* const data, const QWORD length) {
+	file->data = data;
+	file->stream = NULL;
+	file->length = length;
+	file->position = 0;
+	return file;
+}
+
+BASSFILE bench_file_open_stream(BENCH_FILE* const file, FILE* const stream) {
+	off_t length;
+	if (fseeko(stream, 0, SEEK_END) || (length = ftello(stream)) < 0 || fseeko(stream, 0, SEEK_SET)) {
+		return NULL;
+	}
+	bench_file_open(file, NULL, (QWORD)length);
+	file->stream = stream;
+	return file;
+}
+
+//Files are never mapped, streams either parse the memory they were created from or read through the stub.
+BOOL file_map_init() {
+	return TRUE;
+}
+
+BOOL file_map_acquire(const BASSFILE file, FILE_MAP** const map) {
+	return FALSE;
+}
+
+BOOL file_map_release(FILE_MAP* const map) {
+	return FALSE;
+}
+
+BOOL file_map_window(const FILE_MAP* const map, const QWORD position, const QWORD size, BYTE** const data, QWORD* const offset, QWORD* const length) {
+	return FALSE;
+}
+
+BOOL file_map_unmap(BYTE* const data) {
+	return FALSE;
+}
+
+BOOL file_map_free() {
+	return TRUE;
+}
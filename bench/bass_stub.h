@@ -0,0 +1,14 @@
+#include <stdio.h>
+
+#include "../bass_dts/bass_dts.h"
+
+//A file in memory or on disk standing in for the BASS file layer.
+typedef struct {
+	const BYTE* data;
+	FILE* stream; //Read instead of data when set.
+	QWORD length;
+	QWORD position;
+} BENCH_FILE;
+
+BASSFILE bench_file_open(BENCH_FILE* const file, const void* const data, const QWORD length);
+BASSFILE bench_file_open_stream(BENCH_FILE* const file, FILE* const stream);
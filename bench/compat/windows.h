@@ -0,0 +1,72 @@
+#ifndef BENCH_WINDOWS_H
+#define BENCH_WINDOWS_H
+
+//Just enough of the Win32 API for the bass_dts stream logic to build outside Windows.
+
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <unistd.h>
+
+typedef void VOID;
+typedef void* LPVOID;
+typedef void* HANDLE;
+typedef void* HMODULE;
+typedef uint16_t WCHAR;
+typedef int32_t LONG;
+typedef uint32_t UINT;
+
+typedef union {
+	struct {
+		uint32_t LowPart;
+		int32_t HighPart;
+	};
+	int64_t QuadPart;
+} LARGE_INTEGER;
+
+typedef pthread_mutex_t CRITICAL_SECTION;
+
+#define ZeroMemory(destination, length) memset((destination), 0, (length))
+#define CopyMemory(destination, source, length) memcpy((destination), (source), (length))
+
+static inline void InitializeCriticalSection(CRITICAL_SECTION* const section) {
+	pthread_mutex_init(section, NULL);
+}
+
+static inline void DeleteCriticalSection(CRITICAL_SECTION* const section) {
+	pthread_mutex_destroy(section);
+}
+
+static inline void EnterCriticalSection(CRITICAL_SECTION* const section) {
+	pthread_mutex_lock(section);
+}
+
+static inline void LeaveCriticalSection(CRITICAL_SECTION* const section) {
+	pthread_mutex_unlock(section);
+}
+
+static inline int QueryPerformanceCounter(LARGE_INTEGER* const counter) {
+	//Nanoseconds of the monotonic clock.
+	struct timespec time;
+	clock_gettime(CLOCK_MONOTONIC, &time);
+	counter->QuadPart = (int64_t)time.tv_sec * 1000000000 + time.tv_nsec;
+	return 1;
+}
+
+static inline int QueryPerformanceFrequency(LARGE_INTEGER* const frequency) {
+	frequency->QuadPart = 1000000000;
+	return 1;
+}
+
+static inline uint32_t GetTickCount(void) {
+	struct timespec time;
+	clock_gettime(CLOCK_MONOTONIC, &time);
+	return (uint32_t)(time.tv_sec * 1000 + time.tv_nsec / 1000000);
+}
+
+static inline uint32_t GetCurrentProcessId(void) {
+	return (uint32_t)getpid();
+}
+
+#endif
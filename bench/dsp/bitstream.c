@@ -0,0 +1,6 @@
+#include "../../libdcadec/bitstream.c"
+#include "dsp_kernels.h"
+
+unsigned short dsp_crc16(const unsigned char* data, int size) {
+	return crc16(data, size);
+}
@@ -0,0 +1,6 @@
+#include "../../libdcadec/dca_context.c"
+#include "dsp_kernels.h"
+
+int dsp_shift_and_clip(int* samples, int count, int shift, int bits) {
+	return shift_and_clip__(samples, count, shift, bits);
+}
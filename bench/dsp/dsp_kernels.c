@@ -0,0 +1,807 @@
+#include "../../libdcadec/common.h"
+#include "../../libdcadec/bitstream.h"
+#include "../../libdcadec/core_huffman.h"
+#include "../../libdcadec/dca_frame.h"
+#include "../../libdcadec/idct.h"
+#include "../../libdcadec/interpolator.h"
+#include "../../libdcadec/core_decoder.h"
+#include "../../libdcadec/xll_decoder.h"
+#include "../../libdcadec/lbr_decoder.h"
+#include "dsp_kernels.h"
+#include "reference.h"
+
+//Inputs are read past their end by the bitstream reader and the 14 bit conversion.
+#define DSP_PADDING 64
+#define DSP_PAGE 4096
+
+#define DSP_SYMBOLS 4096
+#define DSP_RICE_PARAMETER 5
+#define DSP_CRC_BYTES 16384
+#define DSP_CONVERT_BYTES 16384
+#define DSP_TRANSFORMS 64
+#define DSP_SUBBAND_SAMPLES 64
+#define DSP_PCMBLOCKS 64
+#define DSP_XLL_CHANNELS 6
+#define DSP_XLL_SAMPLES 1024
+#define DSP_CLIP_SAMPLES (8 * 2048)
+#define DSP_LBR_LFE_FRAMES 16
+//The reference runs the LBR LFE cascade in single precision, its rounding error with poles this close to the unit circle reaches about 1e-3 of full scale.
+//The kernel is within 1 of the exact cascade, so that is the tolerance, in 23 bit samples.
+#define DSP_LBR_LFE_TOLERANCE ((1 << 23) / 1000)
+
+unsigned int dsp_random(unsigned int* seed) {
+	//Xorshift.
+	unsigned int value = *seed;
+	value ^= value << 13;
+	value ^= value >> 17;
+	value ^= value << 5;
+	return *seed = value;
+}
+
+static int dsp_random_signed(unsigned int* seed, const int bits) {
+	return (int)dsp_random(seed) >> (32 - bits);
+}
+
+static void* dsp_buffer_create(DSP_STATE* state, size_t size, size_t offset) {
+	//At the same offset within a page for the kernel and the reference, wherever the heap puts the allocation, so cache set and store forwarding conflicts between input and output don't favour either side.
+	uint8_t* buffer = ta_zalloc_size(state, size + DSP_PADDING + DSP_PAGE);
+	if (!buffer) {
+		return NULL;
+	}
+	return buffer + ((offset - (uintptr_t)buffer) & (DSP_PAGE - 1));
+}
+
+DSP_STATE* dsp_state_create(size_t input_size, int count, size_t output_size) {
+	DSP_STATE* state = ta_znew(NULL, DSP_STATE);
+	if (!state) {
+		return NULL;
+	}
+	state->input_size = input_size;
+	state->count = count;
+	if (input_size && !(state->input = dsp_buffer_create(state, input_size, 0))) {
+		ta_free(state);
+		return NULL;
+	}
+	if (output_size && !(state->output = dsp_buffer_create(state, output_size, DSP_PAGE / 2))) {
+		ta_free(state);
+		return NULL;
+	}
+	return state;
+}
+
+static DSP_STATE* dsp_state_save(DSP_STATE* state) {
+	//Only for kernels which modify their input.
+	if (!(state->saved = ta_alloc_size(state, state->input_size))) {
+		ta_free(state);
+		return NULL;
+	}
+	memcpy(state->saved, state->input, state->input_size);
+	return state;
+}
+
+static void dsp_prepare(const DSP_KERNEL* kernel, DSP_STATE* state) {
+	if (state->saved) {
+		memcpy(state->input, state->saved, state->input_size);
+	}
+	if (kernel->reset) {
+		kernel->reset(state);
+	}
+}
+
+static void dsp_free(DSP_STATE* state) {
+	ta_free(state);
+}
+
+typedef struct {
+	uint8_t* data;
+	int position;
+} DSP_WRITER;
+
+static void dsp_put_bits(DSP_WRITER* writer, uint32_t value, int bits) {
+	while (bits--) {
+		if ((value >> bits) & 1) {
+			writer->data[writer->position >> 3] |= 0x80 >> (writer->position & 7);
+		}
+		writer->position++;
+	}
+}
+
+static DSP_STATE* dsp_vlc_create(const struct huffman* h) {
+	//Symbols are drawn with the probability the code assigns them, 2 ^ -length.
+	DSP_STATE* state = dsp_state_create(DSP_SYMBOLS * 4, DSP_SYMBOLS, DSP_SYMBOLS * sizeof(int));
+	DSP_WRITER writer;
+	unsigned int seed = 1;
+	int symbol;
+	int index;
+	if (!state) {
+		return NULL;
+	}
+	writer.data = state->input;
+	writer.position = 0;
+	for (symbol = 0; symbol < DSP_SYMBOLS; ) {
+		uint32_t value = dsp_random(&seed);
+		for (index = 0; index < h->size; index++) {
+			if (value >> (32 - h->len[index]) == h->code[index]) {
+				dsp_put_bits(&writer, h->code[index], h->len[index]);
+				symbol++;
+				break;
+			}
+		}
+	}
+	state->input_size = (writer.position + 7) >> 3;
+	state->units = DSP_SYMBOLS;
+	state->context = (void*)h;
+	return state;
+}
+
+static DSP_STATE* dsp_vlc_create_17(void) {
+	return dsp_vlc_create(&quant_index_huff_5[0]);
+}
+
+static DSP_STATE* dsp_vlc_create_129(void) {
+	return dsp_vlc_create(&quant_index_huff_9[0]);
+}
+
+static void dsp_vlc_run(DSP_STATE* state) {
+	const struct huffman* h = state->context;
+	int* output = state->output;
+	struct bitstream bits;
+	int symbol;
+	bits_init(&bits, state->input, (int)state->input_size);
+	for (symbol = 0; symbol < DSP_SYMBOLS; symbol++) {
+		output[symbol] = bits_get_unsigned_vlc(&bits, h);
+	}
+}
+
+static void dsp_vlc_reference(DSP_STATE* state) {
+	reference_get_unsigned_vlc_array(state->input, (int)state->input_size, state->output, DSP_SYMBOLS, state->context);
+}
+
+static DSP_STATE* dsp_rice_create(void) {
+	//Mostly small residuals with the occasional large one, as XLL sees them.
+	DSP_STATE* state = dsp_state_create(DSP_SYMBOLS * 8, DSP_SYMBOLS, DSP_SYMBOLS * sizeof(int));
+	DSP_WRITER writer;
+	unsigned int seed = 1;
+	int symbol;
+	if (!state) {
+		return NULL;
+	}
+	writer.data = state->input;
+	writer.position = 0;
+	for (symbol = 0; symbol < DSP_SYMBOLS; symbol++) {
+		int value = dsp_random_signed(&seed, (dsp_random(&seed) & 15) ? DSP_RICE_PARAMETER + 1 : DSP_RICE_PARAMETER + 4);
+		uint32_t code = ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+		dsp_put_bits(&writer, 1, (code >> DSP_RICE_PARAMETER) + 1);
+		dsp_put_bits(&writer, code, DSP_RICE_PARAMETER);
+	}
+	state->input_size = (writer.position + 7) >> 3;
+	state->units = DSP_SYMBOLS;
+	return state;
+}
+
+static void dsp_rice_run(DSP_STATE* state) {
+	struct bitstream bits;
+	bits_init(&bits, state->input, (int)state->input_size);
+	bits_get_signed_rice_array(&bits, state->output, DSP_SYMBOLS, DSP_RICE_PARAMETER);
+}
+
+static void dsp_rice_reference(DSP_STATE* state) {
+	reference_get_signed_rice_array(state->input, (int)state->input_size, state->output, DSP_SYMBOLS, DSP_RICE_PARAMETER);
+}
+
+static DSP_STATE* dsp_crc16_create(void) {
+	DSP_STATE* state = dsp_state_create(DSP_CRC_BYTES, 1, sizeof(uint16_t));
+	unsigned int seed = 1;
+	int position;
+	if (!state) {
+		return NULL;
+	}
+	for (position = 0; position < DSP_CRC_BYTES; position++) {
+		((uint8_t*)state->input)[position] = dsp_random(&seed) >> 24;
+	}
+	state->units = DSP_CRC_BYTES;
+	return state;
+}
+
+static void dsp_crc16_run(DSP_STATE* state) {
+	*(uint16_t*)state->output = dsp_crc16(state->input, DSP_CRC_BYTES);
+}
+
+static void dsp_crc16_reference(DSP_STATE* state) {
+	*(uint16_t*)state->output = reference_crc16(state->input, DSP_CRC_BYTES);
+}
+
+static DSP_STATE* dsp_convert_create(const uint32_t sync_word, const bool words14, const bool little_endian) {
+	//A frame of random words in the stream format, 14 bit words are sign extended as encoders write them.
+	DSP_STATE* state = dsp_state_create(DSP_CONVERT_BYTES, words14 ? DSP_CONVERT_BYTES - DSP_CONVERT_BYTES / 8 : DSP_CONVERT_BYTES, DSP_CONVERT_BYTES);
+	uint8_t* data;
+	unsigned int seed = 1;
+	int position;
+	if (!state) {
+		return NULL;
+	}
+	data = state->input;
+	for (position = 0; position < DSP_CONVERT_BYTES; position += 2) {
+		uint16_t word = words14 ? (uint16_t)dsp_random_signed(&seed, 14) : (uint16_t)(dsp_random(&seed) >> 16);
+		if (position < 4) {
+			word = (uint16_t)(sync_word >> (16 - position * 8));
+		}
+		data[position + (little_endian ? 1 : 0)] = word >> 8;
+		data[position + (little_endian ? 0 : 1)] = word & 0xff;
+	}
+	state->units = DSP_CONVERT_BYTES;
+	return state;
+}
+
+static DSP_STATE* dsp_convert_create_be16(void) {
+	return dsp_convert_create(SYNC_WORD_CORE, false, false);
+}
+
+static DSP_STATE* dsp_convert_create_le16(void) {
+	return dsp_convert_create(SYNC_WORD_CORE, false, true);
+}
+
+static DSP_STATE* dsp_convert_create_be14(void) {
+	return dsp_convert_create(SYNC_WORD_CORE_BE14, true, false);
+}
+
+static DSP_STATE* dsp_convert_create_le14(void) {
+	return dsp_convert_create(SYNC_WORD_CORE_BE14, true, true);
+}
+
+static void dsp_convert_run(DSP_STATE* state) {
+	size_t size;
+	dcadec_frame_convert_bitstream(state->output, &size, state->input, DSP_CONVERT_BYTES);
+}
+
+static void dsp_convert_reference(DSP_STATE* state) {
+	size_t size;
+	reference_convert_bitstream(state->output, &size, state->input, DSP_CONVERT_BYTES);
+}
+
+static DSP_STATE* dsp_idct_create(const int nbits, const int type) {
+	//Blocks of subband samples at the amplitude of dequantized 24 bit audio.
+	int length = DSP_TRANSFORMS << nbits;
+	size_t size = type == DSP_DOUBLE ? sizeof(double) : type == DSP_FLOAT ? sizeof(float) : sizeof(int);
+	DSP_STATE* state = dsp_state_create(length * size, length, length * size);
+	unsigned int seed = 1;
+	int position;
+	if (!state) {
+		return NULL;
+	}
+	for (position = 0; position < length; position++) {
+		int value = dsp_random_signed(&seed, 21);
+		if (type == DSP_DOUBLE) {
+			((double*)state->input)[position] = value;
+		}
+		else if (type == DSP_FLOAT) {
+			((float*)state->input)[position] = (float)value;
+		}
+		else {
+			((int*)state->input)[position] = value;
+		}
+	}
+	state->units = length;
+	state->parameter = nbits;
+	if (type != DSP_INT32 && (!(state->context = idct_init(state, nbits, 0.25)) || !(state->reference = ta_znew(state, struct reference_idct)))) {
+		ta_free(state);
+		return NULL;
+	}
+	if (type != DSP_INT32) {
+		reference_idct_init(state->reference, nbits, 0.25);
+	}
+	return type == DSP_INT32 ? dsp_state_save(state) : state;
+}
+
+static DSP_STATE* dsp_idct_create_32(void) {
+	return dsp_idct_create(5, DSP_DOUBLE);
+}
+
+static DSP_STATE* dsp_idct_create_64(void) {
+	return dsp_idct_create(6, DSP_DOUBLE);
+}
+
+static DSP_STATE* dsp_idct_create_32_float32(void) {
+	return dsp_idct_create(5, DSP_FLOAT);
+}
+
+static DSP_STATE* dsp_idct_create_64_float32(void) {
+	return dsp_idct_create(6, DSP_FLOAT);
+}
+
+static DSP_STATE* dsp_idct_create_fixed32(void) {
+	return dsp_idct_create(5, DSP_INT32);
+}
+
+static DSP_STATE* dsp_idct_create_fixed64(void) {
+	return dsp_idct_create(6, DSP_INT32);
+}
+
+static void dsp_idct_run(DSP_STATE* state) {
+	int length = 1 << state->parameter;
+	int transform;
+	for (transform = 0; transform < DSP_TRANSFORMS; transform++) {
+		idct_fast(state->context, (const double*)state->input + transform * length, (double*)state->output + transform * length);
+	}
+}
+
+static void dsp_idct_run_float32(DSP_STATE* state) {
+	int length = 1 << state->parameter;
+	int transform;
+	for (transform = 0; transform < DSP_TRANSFORMS; transform++) {
+		idct_fast_float32(state->context, (const float*)state->input + transform * length, (float*)state->output + transform * length);
+	}
+}
+
+static void dsp_idct_run_fixed(DSP_STATE* state) {
+	int length = 1 << state->parameter;
+	int transform;
+	for (transform = 0; transform < DSP_TRANSFORMS; transform++) {
+		if (length == 32) {
+			idct_fixed32((int*)state->input + transform * length, (int*)state->output + transform * length);
+		}
+		else {
+			idct_fixed64((int*)state->input + transform * length, (int*)state->output + transform * length);
+		}
+	}
+}
+
+static void dsp_idct_reference(DSP_STATE* state) {
+	int length = 1 << state->parameter;
+	int transform;
+	for (transform = 0; transform < DSP_TRANSFORMS; transform++) {
+		reference_idct_fast(state->reference, (const double*)state->input + transform * length, (double*)state->output + transform * length);
+	}
+}
+
+static void dsp_idct_reference_float32(DSP_STATE* state) {
+	//The reference predates the single precision transforms, they are checked against the double precision one.
+	double input[IDCT_SIZE];
+	double output[IDCT_SIZE];
+	int length = 1 << state->parameter;
+	int transform;
+	int position;
+	for (transform = 0; transform < DSP_TRANSFORMS; transform++) {
+		for (position = 0; position < length; position++) {
+			input[position] = ((const float*)state->input)[transform * length + position];
+		}
+		reference_idct_fast(state->reference, input, output);
+		for (position = 0; position < length; position++) {
+			((float*)state->output)[transform * length + position] = (float)output[position];
+		}
+	}
+}
+
+static void dsp_idct_reference_fixed(DSP_STATE* state) {
+	int length = 1 << state->parameter;
+	int transform;
+	for (transform = 0; transform < DSP_TRANSFORMS; transform++) {
+		if (length == 32) {
+			reference_idct_fixed32((int*)state->input + transform * length, (int*)state->output + transform * length);
+		}
+		else {
+			reference_idct_fixed64((int*)state->input + transform * length, (int*)state->output + transform * length);
+		}
+	}
+}
+
+static DSP_STATE* dsp_interpolate_create(const int flags) {
+	//Low subbands, and for X96 synthesis the full 64 subbands of the extension.
+	bool x96 = flags & DCADEC_FLAG_CORE_SYNTH_X96;
+	int lo = DSP_SUBBAND_SAMPLES * 32;
+	int hi = x96 ? DSP_SUBBAND_SAMPLES * 64 : 0;
+	int length = DSP_SUBBAND_SAMPLES * (x96 ? 64 : 32);
+	DSP_STATE* state = dsp_state_create((lo + hi) * sizeof(int), length, length * sizeof(int));
+	struct idct_context* idct;
+	unsigned int seed = 1;
+	int position;
+	if (!state) {
+		return NULL;
+	}
+	for (position = 0; position < lo + hi; position++) {
+		((int*)state->input)[position] = dsp_random_signed(&seed, 17);
+	}
+	state->units = length;
+	state->parameter = flags;
+	state->extra = hi ? (int*)state->input + lo : NULL;
+	if (!(idct = idct_init(state, x96 ? 6 : 5, 0.25)) || !(state->context = interpolator_create(idct, flags)) || !(state->reference = ta_znew(state, struct reference_history))) {
+		ta_free(state);
+		return NULL;
+	}
+	return state;
+}
+
+static DSP_STATE* dsp_interpolate_create_sub32_float(void) {
+	return dsp_interpolate_create(0);
+}
+
+static DSP_STATE* dsp_interpolate_create_sub64_float(void) {
+	return dsp_interpolate_create(DCADEC_FLAG_CORE_SYNTH_X96);
+}
+
+static DSP_STATE* dsp_interpolate_create_sub32_float32(void) {
+	return dsp_interpolate_create(DCADEC_FLAG_CORE_FLOAT32);
+}
+
+static DSP_STATE* dsp_interpolate_create_sub64_float32(void) {
+	return dsp_interpolate_create(DCADEC_FLAG_CORE_FLOAT32 | DCADEC_FLAG_CORE_SYNTH_X96);
+}
+
+static DSP_STATE* dsp_interpolate_create_sub32_fixed(void) {
+	return dsp_interpolate_create(DCADEC_FLAG_CORE_BIT_EXACT);
+}
+
+static DSP_STATE* dsp_interpolate_create_sub64_fixed(void) {
+	return dsp_interpolate_create(DCADEC_FLAG_CORE_BIT_EXACT | DCADEC_FLAG_CORE_SYNTH_X96);
+}
+
+static void dsp_interpolate_reset(DSP_STATE* state) {
+	interpolator_clear(state->context);
+	memset(state->reference, 0, sizeof(struct reference_history));
+}
+
+static void dsp_interpolate_run(DSP_STATE* state) {
+	struct interpolator* dsp = state->context;
+	dsp->interpolate(dsp, state->output, state->input, state->extra, DSP_SUBBAND_SAMPLES, false);
+}
+
+static void dsp_interpolate_reference(DSP_STATE* state) {
+	//The reference predates the single precision synthesis, it is checked against the double precision one.
+	if (state->parameter & DCADEC_FLAG_CORE_BIT_EXACT) {
+		if (state->parameter & DCADEC_FLAG_CORE_SYNTH_X96) {
+			reference_interpolate_sub64_fixed(state->reference, state->output, state->input, state->extra, DSP_SUBBAND_SAMPLES);
+		}
+		else {
+			reference_interpolate_sub32_fixed(state->reference, state->output, state->input, DSP_SUBBAND_SAMPLES, false);
+		}
+	}
+	else {
+		if (state->parameter & DCADEC_FLAG_CORE_SYNTH_X96) {
+			reference_interpolate_sub64_float(state->reference, state->output, state->input, state->extra, DSP_SUBBAND_SAMPLES);
+		}
+		else {
+			reference_interpolate_sub32_float(state->reference, state->output, state->input, DSP_SUBBAND_SAMPLES, false);
+		}
+	}
+}
+
+static DSP_STATE* dsp_lfe_create(interpolate_lfe_cb interpolate, const bool dec_select) {
+	//Decimated samples after a cleared history, the history doubles as IIR state so it starts at zero.
+	int length = DSP_PCMBLOCKS * NUM_PCMBLOCK_SAMPLES;
+	int count = MAX_LFE_HISTORY + DSP_PCMBLOCKS / 2;
+	DSP_STATE* state = dsp_state_create(count * sizeof(int), length, length * sizeof(int));
+	unsigned int seed = 1;
+	int position;
+	if (!state) {
+		return NULL;
+	}
+	for (position = MAX_LFE_HISTORY; position < count; position++) {
+		((int*)state->input)[position] = dsp_random_signed(&seed, 21);
+	}
+	state->units = length;
+	state->parameter = dec_select;
+	state->context = (void*)interpolate;
+	return dsp_state_save(state);
+}
+
+static DSP_STATE* dsp_lfe_create_float_fir(void) {
+	return dsp_lfe_create(interpolate_lfe_float_fir, false);
+}
+
+static DSP_STATE* dsp_lfe_create_float_fir_2x(void) {
+	return dsp_lfe_create(interpolate_lfe_float_fir_2x, true);
+}
+
+static DSP_STATE* dsp_lfe_create_float_iir(void) {
+	return dsp_lfe_create(interpolate_lfe_float_iir, false);
+}
+
+static DSP_STATE* dsp_lfe_create_float32_fir(void) {
+	return dsp_lfe_create(interpolate_lfe_float32_fir, false);
+}
+
+static DSP_STATE* dsp_lfe_create_float32_fir_2x(void) {
+	return dsp_lfe_create(interpolate_lfe_float32_fir_2x, true);
+}
+
+static DSP_STATE* dsp_lfe_create_fixed_fir(void) {
+	return dsp_lfe_create(interpolate_lfe_fixed_fir, false);
+}
+
+static void dsp_lfe_run(DSP_STATE* state) {
+	interpolate_lfe_cb interpolate = (interpolate_lfe_cb)state->context;
+	interpolate(state->output, state->input, DSP_PCMBLOCKS, state->parameter);
+}
+
+static void dsp_lfe_reference_float_fir(DSP_STATE* state) {
+	//Also the reference of the single precision FIR.
+	reference_interpolate_lfe_float_fir(state->output, state->input, DSP_PCMBLOCKS, state->parameter);
+}
+
+static void dsp_lfe_reference_float_iir(DSP_STATE* state) {
+	reference_interpolate_lfe_float_iir(state->output, state->input, DSP_PCMBLOCKS, state->parameter);
+}
+
+static void dsp_lfe_reference_fixed_fir(DSP_STATE* state) {
+	reference_interpolate_lfe_fixed_fir(state->output, state->input, DSP_PCMBLOCKS);
+}
+
+static DSP_STATE* dsp_xll_create(const int nfreqbands) {
+	//A 5.1 channel set, adaptive prediction on most channels, fixed on one and pairwise decorrelation.
+	//Band 0 buffers keep room for the decimator history in front of them.
+	static const int orig_order[DSP_XLL_CHANNELS] = { 1, 0, 2, 3, 5, 4 };
+	int stride = DSP_XLL_SAMPLES + XLL_DECI_HISTORY;
+	int count = DSP_XLL_CHANNELS * nfreqbands * stride;
+	DSP_STATE* state = dsp_state_create(count * sizeof(int), DSP_XLL_CHANNELS * DSP_XLL_SAMPLES * nfreqbands, 0);
+	struct xll_decoder* xll;
+	struct xll_chset* chs;
+	unsigned int seed = 1;
+	int position;
+	int band;
+	int ch;
+	int i;
+	if (!state) {
+		return NULL;
+	}
+	if (!(xll = ta_znew(state, struct xll_decoder)) || !(xll->chset = chs = ta_znew_array(xll, struct xll_chset, 1))) {
+		ta_free(state);
+		return NULL;
+	}
+	xll->nframesamples = DSP_XLL_SAMPLES;
+	chs->decoder = xll;
+	chs->nchannels = DSP_XLL_CHANNELS;
+	chs->nfreqbands = nfreqbands;
+	for (position = 0; position < count; position++) {
+		((int*)state->input)[position] = dsp_random_signed(&seed, nfreqbands > 1 ? 21 : 17);
+	}
+	for (ch = 0; ch < DSP_XLL_CHANNELS; ch++) {
+		for (i = 0; i < XLL_DECI_HISTORY; i++) {
+			chs->deci_history[ch][i] = dsp_random_signed(&seed, 21);
+		}
+	}
+	for (band = 0; band < nfreqbands; band++) {
+		struct xll_band* b = &chs->bands[band];
+		b->decor_enabled = true;
+		for (ch = 0; ch < DSP_XLL_CHANNELS; ch++) {
+			b->orig_order[ch] = orig_order[ch];
+			if (ch == 3) {
+				b->fixed_pred_order[ch] = 1;
+			}
+			else {
+				b->adapt_pred_order[ch] = ch == 0 ? XLL_MAX_ADAPT_PRED_ORDER : 8;
+				for (i = 0; i < b->adapt_pred_order[ch]; i++) {
+					b->adapt_refl_coeff[ch][i] = dsp_random_signed(&seed, 15);
+				}
+			}
+		}
+		for (ch = 0; ch < DSP_XLL_CHANNELS / 2; ch++) {
+			b->decor_coeff[ch] = dsp_random_signed(&seed, 6);
+		}
+	}
+	state->units = state->count;
+	state->context = chs;
+	return dsp_state_save(state);
+}
+
+static void dsp_xll_reset(DSP_STATE* state) {
+	//Channel pointers are reordered by the filter.
+	struct xll_chset* chs = state->context;
+	int stride = DSP_XLL_SAMPLES + XLL_DECI_HISTORY;
+	int band;
+	int ch;
+	for (band = 0; band < chs->nfreqbands; band++) {
+		for (ch = 0; ch < DSP_XLL_CHANNELS; ch++) {
+			chs->bands[band].msb_sample_buffer[ch] = (int*)state->input + (ch * chs->nfreqbands + band) * stride + XLL_DECI_HISTORY;
+		}
+	}
+}
+
+static DSP_STATE* dsp_xll_create_filter(void) {
+	DSP_STATE* state = dsp_xll_create(1);
+	if (state) {
+		//The filter works in place.
+		state->output = state->input;
+		state->count = (int)(state->input_size / sizeof(int));
+	}
+	return state;
+}
+
+static void dsp_xll_run_filter(DSP_STATE* state) {
+	xll_filter_band_data(state->context, XLL_BAND_0);
+}
+
+static void dsp_xll_reference_filter(DSP_STATE* state) {
+	reference_xll_filter_band_data(state->context, XLL_BAND_0);
+}
+
+static DSP_STATE* dsp_xll_create_assemble(void) {
+	//The assembly buffer is allocated by the first run.
+	DSP_STATE* state = dsp_xll_create(2);
+	struct xll_chset* chs;
+	if (!state) {
+		return NULL;
+	}
+	chs = state->context;
+	dsp_xll_reset(state);
+	if (dsp_chs_assemble_freq_bands(chs) < 0) {
+		ta_free(state);
+		return NULL;
+	}
+	state->output = chs->sample_buffer3;
+	return state;
+}
+
+static void dsp_xll_run_assemble(DSP_STATE* state) {
+	dsp_chs_assemble_freq_bands(state->context);
+}
+
+static void dsp_xll_reference_assemble(DSP_STATE* state) {
+	reference_xll_assemble_freq_bands(state->context, state->output);
+}
+
+static DSP_STATE* dsp_lbr_create(void) {
+	//One channel at 48 kHz without tones, the time samples of the frame are the input.
+	DSP_STATE* state = dsp_state_create(0, LBR_TIME_SAMPLES * LBR_SUBBANDS, 0);
+	struct lbr_decoder* lbr;
+	unsigned int seed = 1;
+	int sb;
+	int position;
+	if (!state) {
+		return NULL;
+	}
+	if (!(lbr = ta_znew(state, struct lbr_decoder))) {
+		ta_free(state);
+		return NULL;
+	}
+	lbr->nchannels = 1;
+	lbr->freq_range = 2;
+	lbr->limited_range = 2;
+	lbr->nsubbands = 8 << lbr->limited_range;
+	lbr->bit_rate_scaled = 64000;
+	if (dsp_lbr_init(lbr) < 0 || !(lbr->output_buffer = ta_znew_array(lbr, int, LBR_TIME_SAMPLES * LBR_SUBBANDS))) {
+		ta_free(state);
+		return NULL;
+	}
+	lbr->channel_buffer[0] = lbr->output_buffer;
+	for (sb = 0; sb < lbr->nsubbands; sb++) {
+		for (position = 0; position < LBR_TIME_HISTORY + LBR_TIME_SAMPLES; position++) {
+			lbr->time_samples[0][sb][position] = dsp_random_signed(&seed, 16) * (1.0f / 8);
+		}
+	}
+	state->input = lbr->time_samples[0];
+	state->input_size = sizeof(lbr->time_samples[0]);
+	state->output = lbr->channel_buffer[0];
+	state->units = state->count;
+	state->context = lbr;
+	return dsp_state_save(state);
+}
+
+static void dsp_lbr_reset(DSP_STATE* state) {
+	struct lbr_decoder* lbr = state->context;
+	memset(lbr->imdct_history[0], 0, sizeof(lbr->imdct_history[0]));
+}
+
+static void dsp_lbr_run(DSP_STATE* state) {
+	dsp_lbr_transform_channel(state->context, 0);
+}
+
+static void dsp_lbr_reference(DSP_STATE* state) {
+	reference_lbr_transform_channel(state->context, 0);
+}
+
+static DSP_STATE* dsp_lbr_lfe_create(void) {
+	//Frames of decimated samples as the delta coding of parse_lfe_24 produces them, a random walk within +-1, which is about full scale at the output.
+	DSP_STATE* state = dsp_state_create(DSP_LBR_LFE_FRAMES * 64 * sizeof(float), DSP_LBR_LFE_FRAMES * 64 * 64, DSP_LBR_LFE_FRAMES * 64 * 64 * sizeof(int));
+	float* data;
+	float value = 0;
+	unsigned int seed = 1;
+	int position;
+	if (!state) {
+		return NULL;
+	}
+	if (!(state->context = ta_znew(state, struct lbr_decoder)) || !(state->reference = ta_znew_array(state, float, 10))) {
+		ta_free(state);
+		return NULL;
+	}
+	data = state->input;
+	for (position = 0; position < DSP_LBR_LFE_FRAMES * 64; position++) {
+		value += dsp_random_signed(&seed, 8) * (1.0f / 512);
+		data[position] = value = value > 1 ? 1 : value < -1 ? -1 : value;
+	}
+	state->units = state->count;
+	return state;
+}
+
+static void dsp_lbr_lfe_reset(DSP_STATE* state) {
+	struct lbr_decoder* lbr = state->context;
+	memset(lbr->lfe_history, 0, sizeof(lbr->lfe_history));
+	memset(state->reference, 0, 10 * sizeof(float));
+}
+
+static void dsp_lbr_lfe_run(DSP_STATE* state) {
+	struct lbr_decoder* lbr = state->context;
+	int frame;
+	for (frame = 0; frame < DSP_LBR_LFE_FRAMES; frame++) {
+		memcpy(lbr->lfe_data, (const float*)state->input + frame * 64, sizeof(lbr->lfe_data));
+		lbr->output_samples[SPEAKER_LFE1] = (int*)state->output + frame * 64 * 64;
+		dsp_lbr_interpolate_lfe(lbr);
+	}
+}
+
+static void dsp_lbr_lfe_reference(DSP_STATE* state) {
+	int frame;
+	for (frame = 0; frame < DSP_LBR_LFE_FRAMES; frame++) {
+		reference_lbr_interpolate_lfe(state->reference, (int*)state->output + frame * 64 * 64, (const float*)state->input + frame * 64);
+	}
+}
+
+static DSP_STATE* dsp_clip_create(void) {
+	//24 bit storage of 23 bit samples, one in 16 of them overflows.
+	DSP_STATE* state = dsp_state_create(DSP_CLIP_SAMPLES * sizeof(int), DSP_CLIP_SAMPLES, 0);
+	unsigned int seed = 1;
+	int position;
+	if (!state) {
+		return NULL;
+	}
+	for (position = 0; position < DSP_CLIP_SAMPLES; position++) {
+		((int*)state->input)[position] = dsp_random_signed(&seed, (dsp_random(&seed) & 15) ? 23 : 25);
+	}
+	state->output = state->input;
+	state->units = DSP_CLIP_SAMPLES;
+	return dsp_state_save(state);
+}
+
+static void dsp_clip_run(DSP_STATE* state) {
+	dsp_shift_and_clip(state->input, DSP_CLIP_SAMPLES, 1, 23);
+}
+
+static void dsp_clip_reference(DSP_STATE* state) {
+	reference_shift_and_clip(state->input, DSP_CLIP_SAMPLES, 1, 23);
+}
+
+static const DSP_KERNEL dsp_kernels[] = {
+	{ "bits_get_unsigned_vlc/17", "symbol", DSP_INT32, 0, &dsp_vlc_create_17, NULL, &dsp_vlc_run, &dsp_vlc_reference },
+	{ "bits_get_unsigned_vlc/129", "symbol", DSP_INT32, 0, &dsp_vlc_create_129, NULL, &dsp_vlc_run, &dsp_vlc_reference },
+	{ "bits_get_signed_rice_array", "symbol", DSP_INT32, 0, &dsp_rice_create, NULL, &dsp_rice_run, &dsp_rice_reference },
+	{ "crc16", "byte", DSP_INT16, 0, &dsp_crc16_create, NULL, &dsp_crc16_run, &dsp_crc16_reference },
+	{ "convert_bitstream/be16", "byte", DSP_UINT8, 0, &dsp_convert_create_be16, NULL, &dsp_convert_run, &dsp_convert_reference },
+	{ "convert_bitstream/le16", "byte", DSP_UINT8, 0, &dsp_convert_create_le16, NULL, &dsp_convert_run, &dsp_convert_reference },
+	{ "convert_bitstream/be14", "byte", DSP_UINT8, 0, &dsp_convert_create_be14, NULL, &dsp_convert_run, &dsp_convert_reference },
+	{ "convert_bitstream/le14", "byte", DSP_UINT8, 0, &dsp_convert_create_le14, NULL, &dsp_convert_run, &dsp_convert_reference },
+	{ "idct_fast/32", "sample", DSP_DOUBLE, 1e-12, &dsp_idct_create_32, NULL, &dsp_idct_run, &dsp_idct_reference },
+	{ "idct_fast/64", "sample", DSP_DOUBLE, 1e-12, &dsp_idct_create_64, NULL, &dsp_idct_run, &dsp_idct_reference },
+	{ "idct_fast_float32/32", "sample", DSP_FLOAT, 1e-5, &dsp_idct_create_32_float32, NULL, &dsp_idct_run_float32, &dsp_idct_reference_float32 },
+	{ "idct_fast_float32/64", "sample", DSP_FLOAT, 1e-5, &dsp_idct_create_64_float32, NULL, &dsp_idct_run_float32, &dsp_idct_reference_float32 },
+	{ "idct_fixed32", "sample", DSP_INT32, 0, &dsp_idct_create_fixed32, NULL, &dsp_idct_run_fixed, &dsp_idct_reference_fixed },
+	{ "idct_fixed64", "sample", DSP_INT32, 0, &dsp_idct_create_fixed64, NULL, &dsp_idct_run_fixed, &dsp_idct_reference_fixed },
+	{ "interpolate_sub32_float", "sample", DSP_INT32, 1, &dsp_interpolate_create_sub32_float, &dsp_interpolate_reset, &dsp_interpolate_run, &dsp_interpolate_reference },
+	{ "interpolate_sub64_float", "sample", DSP_INT32, 1, &dsp_interpolate_create_sub64_float, &dsp_interpolate_reset, &dsp_interpolate_run, &dsp_interpolate_reference },
+	{ "interpolate_sub32_float32", "sample", DSP_INT32, 1, &dsp_interpolate_create_sub32_float32, &dsp_interpolate_reset, &dsp_interpolate_run, &dsp_interpolate_reference },
+	{ "interpolate_sub64_float32", "sample", DSP_INT32, 1, &dsp_interpolate_create_sub64_float32, &dsp_interpolate_reset, &dsp_interpolate_run, &dsp_interpolate_reference },
+	{ "interpolate_sub32_fixed", "sample", DSP_INT32, 0, &dsp_interpolate_create_sub32_fixed, &dsp_interpolate_reset, &dsp_interpolate_run, &dsp_interpolate_reference },
+	{ "interpolate_sub64_fixed", "sample", DSP_INT32, 0, &dsp_interpolate_create_sub64_fixed, &dsp_interpolate_reset, &dsp_interpolate_run, &dsp_interpolate_reference },
+	{ "interpolate_lfe_float_fir", "sample", DSP_INT32, 1, &dsp_lfe_create_float_fir, NULL, &dsp_lfe_run, &dsp_lfe_reference_float_fir },
+	{ "interpolate_lfe_float_fir_2x", "sample", DSP_INT32, 1, &dsp_lfe_create_float_fir_2x, NULL, &dsp_lfe_run, &dsp_lfe_reference_float_fir },
+	{ "interpolate_lfe_float_iir", "sample", DSP_INT32, 1, &dsp_lfe_create_float_iir, NULL, &dsp_lfe_run, &dsp_lfe_reference_float_iir },
+	{ "interpolate_lfe_float32_fir", "sample", DSP_INT32, 1, &dsp_lfe_create_float32_fir, NULL, &dsp_lfe_run, &dsp_lfe_reference_float_fir },
+	{ "interpolate_lfe_float32_fir_2x", "sample", DSP_INT32, 1, &dsp_lfe_create_float32_fir_2x, NULL, &dsp_lfe_run, &dsp_lfe_reference_float_fir },
+	{ "interpolate_lfe_fixed_fir", "sample", DSP_INT32, 0, &dsp_lfe_create_fixed_fir, NULL, &dsp_lfe_run, &dsp_lfe_reference_fixed_fir },
+	{ "xll_filter_band_data", "sample", DSP_INT32, 0, &dsp_xll_create_filter, &dsp_xll_reset, &dsp_xll_run_filter, &dsp_xll_reference_filter },
+	{ "chs_assemble_freq_bands", "sample", DSP_INT32, 0, &dsp_xll_create_assemble, &dsp_xll_reset, &dsp_xll_run_assemble, &dsp_xll_reference_assemble },
+	{ "transform_channel", "sample", DSP_INT32, 1, &dsp_lbr_create, &dsp_lbr_reset, &dsp_lbr_run, &dsp_lbr_reference },
+	{ "lbr_interpolate_lfe", "sample", DSP_INT32, DSP_LBR_LFE_TOLERANCE, &dsp_lbr_lfe_create, &dsp_lbr_lfe_reset, &dsp_lbr_lfe_run, &dsp_lbr_lfe_reference },
+	{ "shift_and_clip", "sample", DSP_INT32, 0, &dsp_clip_create, NULL, &dsp_clip_run, &dsp_clip_reference },
+	{ "pcm_write_sample_16_short", "sample", DSP_INT16, 0, &dsp_pcm_create_16_short, NULL, &dsp_pcm_run, &dsp_pcm_reference },
+	{ "pcm_write_sample_16_float", "sample", DSP_FLOAT, 0, &dsp_pcm_create_16_float, NULL, &dsp_pcm_run, &dsp_pcm_reference },
+	{ "pcm_write_sample_24_short", "sample", DSP_INT16, 0, &dsp_pcm_create_24_short, NULL, &dsp_pcm_run, &dsp_pcm_reference },
+	{ "pcm_write_sample_24_float", "sample", DSP_FLOAT, 0, &dsp_pcm_create_24_float, NULL, &dsp_pcm_run, &dsp_pcm_reference },
+	{ "pcm_write_sample_32_short", "sample", DSP_INT16, 0, &dsp_pcm_create_32_short, NULL, &dsp_pcm_run, &dsp_pcm_reference },
+	{ "pcm_write_sample_32_float", "sample", DSP_FLOAT, 0, &dsp_pcm_create_32_float, NULL, &dsp_pcm_run, &dsp_pcm_reference }
+};
+
+const DSP_SET dsp_set = {
+	dsp_kernels,
+	sizeof(dsp_kernels) / sizeof(dsp_kernels[0]),
+	&dsp_prepare,
+	&dsp_free
+};
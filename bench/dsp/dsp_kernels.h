@@ -0,0 +1,70 @@
+#ifndef DSP_KERNELS_H
+#define DSP_KERNELS_H
+
+#include <stddef.h>
+
+//Every kernel has a reference, the scalar code it was rewritten from kept in reference_*.c, which is run on a second state created the same way.
+
+#define DSP_INT32 0
+#define DSP_INT16 1
+#define DSP_UINT8 2
+#define DSP_FLOAT 3
+#define DSP_DOUBLE 4
+
+typedef struct {
+	void* input; //Consumed or modified in place by the kernel, restored before every run.
+	void* saved;
+	size_t input_size;
+	void* output;
+	int count; //Values of output.
+	int units; //Units processed by one run.
+	int parameter;
+	void* context; //Kernel specific, a table, transform or decoder.
+	void* extra;
+	void* reference; //State of the reference, a transform, history or writer.
+} DSP_STATE;
+
+typedef struct {
+	const char* name;
+	const char* unit;
+	int type; //Of output.
+	double tolerance; //Largest difference from the reference, relative to the peak of the reference output for floating point.
+	DSP_STATE* (*create)(void);
+	void (*reset)(DSP_STATE* state); //Optional, restores kernel state other than input.
+	void (*run)(DSP_STATE* state);
+	void (*reference)(DSP_STATE* state);
+} DSP_KERNEL;
+
+typedef struct {
+	const DSP_KERNEL* kernels;
+	int count;
+	void (*prepare)(const DSP_KERNEL* kernel, DSP_STATE* state);
+	void (*free)(DSP_STATE* state);
+} DSP_SET;
+
+extern const DSP_SET dsp_set;
+
+DSP_STATE* dsp_state_create(size_t input_size, int count, size_t output_size);
+unsigned int dsp_random(unsigned int* seed);
+
+//Kernels of bass_dts, which does not share headers with the libdcadec internals.
+DSP_STATE* dsp_pcm_create_16_short(void);
+DSP_STATE* dsp_pcm_create_16_float(void);
+DSP_STATE* dsp_pcm_create_24_short(void);
+DSP_STATE* dsp_pcm_create_24_float(void);
+DSP_STATE* dsp_pcm_create_32_short(void);
+DSP_STATE* dsp_pcm_create_32_float(void);
+void dsp_pcm_run(DSP_STATE* state);
+void dsp_pcm_reference(DSP_STATE* state);
+
+//Static functions of libdcadec, exported by the files in this directory which include their source.
+struct xll_chset;
+struct lbr_decoder;
+unsigned short dsp_crc16(const unsigned char* data, int size);
+int dsp_shift_and_clip(int* samples, int count, int shift, int bits);
+int dsp_chs_assemble_freq_bands(struct xll_chset* chs);
+int dsp_lbr_init(struct lbr_decoder* lbr);
+void dsp_lbr_transform_channel(struct lbr_decoder* lbr, int ch);
+void dsp_lbr_interpolate_lfe(struct lbr_decoder* lbr);
+
+#endif
@@ -0,0 +1,69 @@
+#include "../../bass_dts/pcm.h"
+#include "dsp_kernels.h"
+#include "reference.h"
+
+//One frame of 8 channels at 2048 samples, written one sample at a time as dts_stream_read does.
+#define DSP_PCM_SAMPLES (8 * 2048)
+
+static DSP_STATE* dsp_pcm_create(const int input_bits, const int output_bits, PCM_WRITE_SAMPLE reference) {
+	AUDIO_FORMAT input_format = { input_bits, input_bits / 8 };
+	AUDIO_FORMAT output_format = { output_bits, output_bits / 8 };
+	unsigned int seed = 1;
+	DSP_STATE* state = dsp_state_create(DSP_PCM_SAMPLES * sizeof(int), DSP_PCM_SAMPLES, DSP_PCM_SAMPLES * (output_bits / 8));
+	int* samples;
+	int position;
+	if (!state) {
+		return NULL;
+	}
+	//Full scale samples of the input resolution.
+	samples = state->input;
+	for (position = 0; position < DSP_PCM_SAMPLES; position++) {
+		samples[position] = (int)dsp_random(&seed) >> (32 - input_bits);
+	}
+	state->units = DSP_PCM_SAMPLES;
+	state->context = (void*)pcm_write_sample(input_format, output_format);
+	state->reference = (void*)reference;
+	return state;
+}
+
+DSP_STATE* dsp_pcm_create_16_short(void) {
+	return dsp_pcm_create(16, 16, &reference_pcm_write_sample_16_short);
+}
+
+DSP_STATE* dsp_pcm_create_16_float(void) {
+	return dsp_pcm_create(16, 32, &reference_pcm_write_sample_16_float);
+}
+
+DSP_STATE* dsp_pcm_create_24_short(void) {
+	return dsp_pcm_create(24, 16, &reference_pcm_write_sample_24_short);
+}
+
+DSP_STATE* dsp_pcm_create_24_float(void) {
+	return dsp_pcm_create(24, 32, &reference_pcm_write_sample_24_float);
+}
+
+DSP_STATE* dsp_pcm_create_32_short(void) {
+	return dsp_pcm_create(32, 16, &reference_pcm_write_sample_32_short);
+}
+
+DSP_STATE* dsp_pcm_create_32_float(void) {
+	return dsp_pcm_create(32, 32, &reference_pcm_write_sample_32_float);
+}
+
+void dsp_pcm_run(DSP_STATE* state) {
+	PCM_WRITE_SAMPLE write_sample = (PCM_WRITE_SAMPLE)state->context;
+	const int* samples = state->input;
+	int position;
+	for (position = 0; position < DSP_PCM_SAMPLES; position++) {
+		write_sample(state->output, position, samples[position]);
+	}
+}
+
+void dsp_pcm_reference(DSP_STATE* state) {
+	PCM_WRITE_SAMPLE write_sample = (PCM_WRITE_SAMPLE)state->reference;
+	const int* samples = state->input;
+	int position;
+	for (position = 0; position < DSP_PCM_SAMPLES; position++) {
+		write_sample(state->output, position, samples[position]);
+	}
+}
@@ -0,0 +1,14 @@
+#include "../../libdcadec/lbr_decoder.c"
+#include "dsp_kernels.h"
+
+int dsp_lbr_init(struct lbr_decoder* lbr) {
+	return init_tables(lbr);
+}
+
+void dsp_lbr_transform_channel(struct lbr_decoder* lbr, int ch) {
+	transform_channel(lbr, ch);
+}
+
+void dsp_lbr_interpolate_lfe(struct lbr_decoder* lbr) {
+	interpolate_lfe(lbr);
+}
@@ -0,0 +1,65 @@
+#ifndef DSP_REFERENCE_H
+#define DSP_REFERENCE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+//Scalar kernels of libdcadec and bass_dts as of commit 1814968, before the SIMD and table rewrites, which the current ones are checked against.
+//They read the same inputs as the current kernels, subband samples in blocks of 32 or 64 per subband sample period.
+
+struct huffman;
+struct xll_chset;
+struct lbr_decoder;
+
+#define REFERENCE_IDCT_SIZE 128
+
+struct reference_idct {
+	double cs[REFERENCE_IDCT_SIZE / 2];
+	double ac[REFERENCE_IDCT_SIZE / 2];
+	double as[REFERENCE_IDCT_SIZE / 2];
+	uint8_t permute[REFERENCE_IDCT_SIZE / 2];
+	int nbits;
+};
+
+//Interpolator history, large enough for the 64 subband filters.
+struct reference_history {
+	double history[1024];
+	int history_fixed[1024];
+};
+
+int reference_get_unsigned_vlc_array(const uint8_t* data, int size, int* array, int count, const struct huffman* h);
+void reference_get_signed_rice_array(const uint8_t* data, int size, int* array, int count, int k);
+uint16_t reference_crc16(const uint8_t* data, int size);
+int reference_convert_bitstream(uint8_t* dst, size_t* dst_size, const uint8_t* src, size_t src_size);
+
+void reference_idct_init(struct reference_idct* s, int nbits, double scale);
+void reference_idct_fast(const struct reference_idct* s, const double* input, double* output);
+void reference_imdct_fast(const struct reference_idct* s, const float* input, float* output);
+void reference_idct_fixed32(int* input, int* output);
+void reference_idct_fixed64(int* input, int* output);
+
+void reference_interpolate_sub32_float(struct reference_history* history, int* pcm_samples, const int* subband_samples_lo, int nsamples, bool perfect);
+void reference_interpolate_sub64_float(struct reference_history* history, int* pcm_samples, const int* subband_samples_lo, const int* subband_samples_hi, int nsamples);
+void reference_interpolate_sub32_fixed(struct reference_history* history, int* pcm_samples, const int* subband_samples_lo, int nsamples, bool perfect);
+void reference_interpolate_sub64_fixed(struct reference_history* history, int* pcm_samples, const int* subband_samples_lo, const int* subband_samples_hi, int nsamples);
+void reference_interpolate_lfe_float_fir(int* pcm_samples, int* lfe_samples, int npcmblocks, bool dec_select);
+void reference_interpolate_lfe_float_iir(int* pcm_samples, int* lfe_samples, int npcmblocks, bool dec_select);
+void reference_interpolate_lfe_fixed_fir(int* pcm_samples, int* lfe_samples, int npcmblocks);
+
+void reference_xll_filter_band_data(struct xll_chset* chs, int band_i);
+void reference_xll_assemble_freq_bands(struct xll_chset* chs, int* output);
+
+void reference_lbr_transform_channel(struct lbr_decoder* lbr, int ch);
+void reference_lbr_interpolate_lfe(float history[5][2], int* output, const float* lfe_data);
+
+bool reference_shift_and_clip(int* samples, int nsamples, int shift, int bits);
+
+void reference_pcm_write_sample_16_short(void* buffer, const int position, const int sample);
+void reference_pcm_write_sample_16_float(void* buffer, const int position, const int sample);
+void reference_pcm_write_sample_24_short(void* buffer, const int position, const int sample);
+void reference_pcm_write_sample_24_float(void* buffer, const int position, const int sample);
+void reference_pcm_write_sample_32_short(void* buffer, const int position, const int sample);
+void reference_pcm_write_sample_32_float(void* buffer, const int position, const int sample);
+
+#endif
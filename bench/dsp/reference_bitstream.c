@@ -0,0 +1,209 @@
+/*
+ * This file is part of libdcadec.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation; either version 2.1 of the License, or (at your
+ * option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+// Bitstream reader, CRC and bitstream conversion of libdcadec at commit 1814968
+
+#include "../../libdcadec/common.h"
+#include "../../libdcadec/huffman.h"
+#include "../../libdcadec/dca_frame.h"
+#include "reference.h"
+
+struct reference_bits {
+    const uint32_t  *data;
+    int             total;
+    int             index;
+};
+
+static void bits_init(struct reference_bits *bits, const uint8_t *data, int size)
+{
+    bits->data = (const uint32_t *)data;
+    bits->total = size * 8;
+    bits->index = 0;
+}
+
+static inline uint32_t bits_peek(struct reference_bits *bits)
+{
+    if (bits->index >= bits->total)
+        return 0;
+
+    int pos = bits->index >> 5;
+    int shift = bits->index & 31;
+
+    uint32_t v = DCA_32BE(bits->data[pos]);
+    if (shift) {
+        v <<= shift;
+        v |= DCA_32BE(bits->data[pos + 1]) >> (32 - shift);
+    }
+
+    return v;
+}
+
+static int bits_get(struct reference_bits *bits, int n)
+{
+    uint32_t v = bits_peek(bits);
+    v >>= 32 - n;
+
+    bits->index += n;
+    return v;
+}
+
+static int bits_get_unsigned_rice(struct reference_bits *bits, int k)
+{
+    unsigned int unary = 0;
+
+    while (bits->index < bits->total) {
+        uint32_t v = bits_peek(bits);
+        if (v) {
+            int z = dca_clz(v);
+            bits->index += z + 1;
+            unary += z;
+            break;
+        }
+        bits->index += 32;
+        unary += 32;
+    }
+
+    return k > 0 ? (unary << k) | bits_get(bits, k) : unary;
+}
+
+static int bits_get_signed_rice(struct reference_bits *bits, int k)
+{
+    unsigned int v = bits_get_unsigned_rice(bits, k);
+    return (v >> 1) ^ -(v & 1);
+}
+
+static int bits_get_unsigned_vlc(struct reference_bits *bits, const struct huffman *h)
+{
+    uint32_t v = bits_peek(bits);
+
+    for (int i = 0; i < h->size; i++) {
+        if (v >> (32 - h->len[i]) == h->code[i]) {
+            bits->index += h->len[i];
+            return i;
+        }
+    }
+
+    return 32768;
+}
+
+int reference_get_unsigned_vlc_array(const uint8_t *data, int size, int *array, int count, const struct huffman *h)
+{
+    struct reference_bits bits;
+    bits_init(&bits, data, size);
+    for (int i = 0; i < count; i++)
+        array[i] = bits_get_unsigned_vlc(&bits, h);
+    return 0;
+}
+
+void reference_get_signed_rice_array(const uint8_t *data, int size, int *array, int count, int k)
+{
+    struct reference_bits bits;
+    bits_init(&bits, data, size);
+    for (int i = 0; i < count; i++)
+        array[i] = bits_get_signed_rice(&bits, k);
+}
+
+uint16_t reference_crc16(const uint8_t *data, int size)
+{
+    static const uint16_t crctab[16] = {
+        0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50a5, 0x60c6, 0x70e7,
+        0x8108, 0x9129, 0xa14a, 0xb16b, 0xc18c, 0xd1ad, 0xe1ce, 0xf1ef
+    };
+
+    uint16_t res = 0xffff;
+    for (int i = 0; i < size; i++) {
+        res = (res << 4) ^ crctab[(data[i] >> 4) ^ (res >> 12)];
+        res = (res << 4) ^ crctab[(data[i] & 15) ^ (res >> 12)];
+    }
+
+    return res;
+}
+
+#define SRC_OP(E) \
+    uint16_t src_0 = DCA_16##E(_src[0]); \
+    uint16_t src_1 = DCA_16##E(_src[1]); \
+    uint16_t src_2 = DCA_16##E(_src[2]); \
+    uint16_t src_3 = DCA_16##E(_src[3]); \
+    uint16_t src_4 = DCA_16##E(_src[4]); \
+    uint16_t src_5 = DCA_16##E(_src[5]); \
+    uint16_t src_6 = DCA_16##E(_src[6]); \
+    uint16_t src_7 = DCA_16##E(_src[7]);
+
+#define DST_OP \
+    _dst[0] = DCA_16BE((src_0 <<  2) | ((src_1 & 0x3fff) >> 12)); \
+    _dst[1] = DCA_16BE((src_1 <<  4) | ((src_2 & 0x3fff) >> 10)); \
+    _dst[2] = DCA_16BE((src_2 <<  6) | ((src_3 & 0x3fff) >>  8)); \
+    _dst[3] = DCA_16BE((src_3 <<  8) | ((src_4 & 0x3fff) >>  6)); \
+    _dst[4] = DCA_16BE((src_4 << 10) | ((src_5 & 0x3fff) >>  4)); \
+    _dst[5] = DCA_16BE((src_5 << 12) | ((src_6 & 0x3fff) >>  2)); \
+    _dst[6] = DCA_16BE((src_6 << 14) | ((src_7 & 0x3fff) >>  0));
+
+int reference_convert_bitstream(uint8_t *dst, size_t *dst_size, const uint8_t *src, size_t src_size)
+{
+    const uint16_t *_src = (const uint16_t *)src;
+    uint16_t *_dst = (uint16_t *)dst;
+    size_t count;
+
+    if (!dst || !dst_size || !src || src_size < 4 || ((uintptr_t)_dst & 3))
+        return -DCADEC_EINVAL;
+
+    if ((uintptr_t)_src & 1)
+        _src = memcpy(_dst, _src, src_size);
+
+    switch (DCA_MEM32NE(_src)) {
+    case DCA_32BE_C(SYNC_WORD_CORE):
+    case DCA_32BE_C(SYNC_WORD_EXSS):
+        if (_src != _dst)
+            memcpy(_dst, _src, src_size);
+        *dst_size = src_size;
+        return DCADEC_BITSTREAM_BE16;
+
+    case DCA_32BE_C(SYNC_WORD_CORE_LE):
+    case DCA_32BE_C(SYNC_WORD_EXSS_LE):
+        count = (src_size + 1) / 2;
+        while (count--)
+            *_dst++ = dca_bswap16(*_src++);
+        *dst_size = src_size;
+        return DCADEC_BITSTREAM_LE16;
+
+    case DCA_32BE_C(SYNC_WORD_CORE_BE14):
+        count = (src_size + 15) / 16;
+        while (count--) {
+            SRC_OP(BE)
+            DST_OP
+            _src += 8;
+            _dst += 7;
+        }
+        *dst_size = src_size - src_size / 8;
+        return DCADEC_BITSTREAM_BE14;
+
+    case DCA_32BE_C(SYNC_WORD_CORE_LE14):
+        count = (src_size + 15) / 16;
+        while (count--) {
+            SRC_OP(LE)
+            DST_OP
+            _src += 8;
+            _dst += 7;
+        }
+        *dst_size = src_size - src_size / 8;
+        return DCADEC_BITSTREAM_LE14;
+
+    default:
+        return -DCADEC_ENOSYNC;
+    }
+}
@@ -0,0 +1,43 @@
+/*
+ * This file is part of libdcadec.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation; either version 2.1 of the License, or (at your
+ * option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+// Output clipping of libdcadec at commit 1814968
+
+#include "../../libdcadec/common.h"
+#include "../../libdcadec/fixed_math.h"
+#include "reference.h"
+
+bool reference_shift_and_clip(int *samples, int nsamples, int shift, int bits)
+{
+    bool clipped = false;
+
+    for (int n = 0; n < nsamples; n++) {
+        int s = samples[n] * (1 << shift);
+#ifdef __ARM_FEATURE_SAT
+        s = clip__(s, bits);
+#else
+        if ((s + (1 << bits)) & ~((1 << (bits + 1)) - 1)) {
+            s = (s >> 31) ^ ((1 << bits) - 1);
+            clipped = true;
+        }
+#endif
+        samples[n] = s;
+    }
+
+    return clipped;
+}
@@ -0,0 +1,181 @@
+/*
+ * This file is part of libdcadec.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation; either version 2.1 of the License, or (at your
+ * option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+// LBR synthesis of libdcadec at commit 1814968, without tonal components, and
+// its LFE interpolation
+
+#include "../../libdcadec/common.h"
+#include "../../libdcadec/lbr_decoder.h"
+#include "reference.h"
+
+static const float long_window[128] = {
+    0.0, 0.0000074288241, 0.000052802097, 0.00017100701, 0.00039665322,
+    0.0007639461, 0.0013065579, 0.0020575011, 0.0030490046, 0.0043123914,
+    0.0058779628, 0.0077748829, 0.010031069, 0.012673087, 0.015726056, 0.019213546,
+    0.023157494, 0.027578127, 0.032493874, 0.037921317, 0.043875102, 0.05036791,
+    0.0574104, 0.065011166, 0.073176719, 0.081911445, 0.091217607, 0.10109533,
+    0.1115426, 0.12255528, 0.13412713, 0.14624982, 0.15891297, 0.17210421,
+    0.18580918, 0.20001164, 0.21469352, 0.22983496, 0.24541442, 0.26140878,
+    0.27779338, 0.29454213, 0.31162769, 0.32902139, 0.34669363, 0.36461368,
+    0.38275006, 0.40107045, 0.41954198, 0.43813133, 0.45680472, 0.47552827,
+    0.49426794, 0.5129897, 0.53165978, 0.55024469, 0.56871128, 0.58702713,
+    0.60516042, 0.62308013, 0.64075619, 0.65815955, 0.67526239, 0.69203806,
+    0.70846134, 0.72450846, 0.74015719, 0.75538683, 0.77017856, 0.78451514,
+    0.79838127, 0.81176347, 0.82465017, 0.8370316, 0.84890026, 0.86025023,
+    0.87107784, 0.88138127, 0.89116055, 0.90041775, 0.90915662, 0.91738296,
+    0.92510408, 0.932329, 0.93906844, 0.94533449, 0.95114064, 0.95650178,
+    0.96143377, 0.96595365, 0.9700793, 0.97382939, 0.97722322, 0.98028058,
+    0.98302156, 0.98546654, 0.98763585, 0.98954982, 0.9912284, 0.99269134,
+    0.99395788, 0.99504662, 0.99597543, 0.99676138, 0.99742073, 0.99796873,
+    0.99841964, 0.99878657, 0.99908173, 0.99931598, 0.99949932, 0.99964064,
+    0.99974757, 0.99982697, 0.99988467, 0.99992549, 0.99995363, 0.99997234,
+    0.99998432, 0.99999166, 0.99999589, 0.99999815, 0.99999928, 0.99999976,
+    0.99999994, 1.0, 1.0, 1.0
+};
+
+static const struct reference_idct *get_imdct(struct lbr_decoder *lbr)
+{
+    static struct reference_idct imdct;
+    static double imdct_scale;
+
+    float scale = 256.0 * 0.25 * sqrt(1 << (2 - lbr->limited_range));
+    if (imdct.nbits != lbr->freq_range + 5 || imdct_scale != scale) {
+        reference_idct_init(&imdct, lbr->freq_range + 5, scale);
+        imdct_scale = scale;
+    }
+    return &imdct;
+}
+
+#define SW0     0.022810893
+#define SW1     0.41799772
+#define SW2     0.9084481
+#define SW3     0.99973983
+
+#define C1      0.068974845
+#define C2      0.34675997
+#define C3      0.29396889
+#define C4      0.19642374
+
+#define AL1     0.30865827
+#define AL2     0.038060233
+
+void reference_lbr_transform_channel(struct lbr_decoder *lbr, int ch)
+{
+    float values[LBR_SUBBANDS * 2][4];
+    int *output = lbr->channel_buffer[ch];
+    int noutsubbands = 8 << lbr->freq_range;
+    int step = 1 << (2 - lbr->freq_range);
+    int i, sf, nsubbands = lbr->nsubbands;
+
+    for (sf = 0; sf < LBR_TIME_SAMPLES / 4; sf++) {
+        // Short window and 8 point forward MDCT
+        for (i = 0; i < nsubbands; i++) {
+            float *samples = &lbr->time_samples[ch][i][LBR_TIME_HISTORY + sf * 4];
+
+            float a = samples[-4] * SW0 - samples[-1] * SW3;
+            float b = samples[-3] * SW1 - samples[-2] * SW2;
+            float c = samples[ 2] * SW1 + samples[ 1] * SW2;
+            float d = samples[ 3] * SW0 + samples[ 0] * SW3;
+
+            values[i][0] = C1 * b - C2 * c + C4 * a - C3 * d;
+            values[i][1] = C1 * d - C2 * a - C4 * b - C3 * c;
+            values[i][2] = C3 * b + C2 * d - C4 * c + C1 * a;
+            values[i][3] = C3 * a - C2 * b + C4 * d - C1 * c;
+        }
+
+        // Aliasing cancellation for high frequencies
+        for (i = 12; i < nsubbands - 1; i++) {
+            float a = values[i  ][3] * AL1;
+            float b = values[i+1][0] * AL1;
+            values[i  ][3] += b - a;
+            values[i+1][0] -= b + a;
+            a = values[i  ][2] * AL2;
+            b = values[i+1][1] * AL2;
+            values[i  ][2] += b - a;
+            values[i+1][1] -= b + a;
+        }
+
+        // Clear inactive subbands
+        if (nsubbands < noutsubbands)
+            memset(values[nsubbands], 0, (noutsubbands - nsubbands) * sizeof(values[0]));
+
+        reference_imdct_fast(get_imdct(lbr), values[0], values[0]);
+
+        // Long window and overlap-add
+        const float *w1 = &long_window[0];
+        const float *w2 = &long_window[128 - 4 * step];
+        float *history = lbr->imdct_history[ch];
+        for (i = 0; i < noutsubbands; i++) {
+            output[0] = lrintf(w1[0 * step] * values[i][0] + history[0]);
+            output[1] = lrintf(w1[1 * step] * values[i][1] + history[1]);
+            output[2] = lrintf(w1[2 * step] * values[i][2] + history[2]);
+            output[3] = lrintf(w1[3 * step] * values[i][3] + history[3]);
+
+            history[0] = w2[3 * step] * values[noutsubbands + i][0];
+            history[1] = w2[2 * step] * values[noutsubbands + i][1];
+            history[2] = w2[1 * step] * values[noutsubbands + i][2];
+            history[3] = w2[0 * step] * values[noutsubbands + i][3];
+
+            output  += 4;
+            history += 4;
+            w1 += 4 * step;
+            w2 -= 4 * step;
+        }
+    }
+
+    // Update history for LPC and forward MDCT
+    for (i = 0; i < nsubbands; i++) {
+        float *samples = lbr->time_samples[ch][i];
+        memcpy(samples, samples + LBR_TIME_SAMPLES, LBR_TIME_HISTORY * sizeof(*samples));
+    }
+}
+
+static const float lfe_iir[5][4] = {
+    { -0.98618466, 1.9861259, 1.0, -1.9840510 },
+    { -0.98883152, 1.9887193, 1.0, -1.9979848 },
+    { -0.99252087, 1.9923381, 1.0, -1.9990897 },
+    { -0.99591690, 1.9956781, 1.0, -1.9993745 },
+    { -0.99872285, 1.9984550, 1.0, -1.9994639 }
+};
+
+#define LFE_IIR_SCALE   (64 * 0x7fffff * 0.0000078265894)
+
+// Takes the history and the buffers the decoder keeps in its context
+void reference_lbr_interpolate_lfe(float history[5][2], int *output, const float *lfe_data)
+{
+    for (int i = 0; i < 64; i++) {
+        float res1 = lfe_data[i] * LFE_IIR_SCALE;
+        float res2;
+
+        for (int j = 0; j < 64; j++) {
+            for (int k = 0; k < 5; k++) {
+                float tmp1 = history[k][0];
+                float tmp2 = history[k][1];
+
+                res2 = tmp1 * lfe_iir[k][0] + tmp2 * lfe_iir[k][1] + res1;
+                res1 = tmp1 * lfe_iir[k][2] + tmp2 * lfe_iir[k][3] + res2;
+
+                history[k][0] = tmp2;
+                history[k][1] = res2;
+            }
+
+            *output++ = lrintf(res1);
+            res1 = 0.0;
+        }
+    }
+}
@@ -0,0 +1,33 @@
+#include "reference.h"
+
+//Sample writers of bass_dts as of commit 1814968.
+
+void reference_pcm_write_sample_16_short(void* buffer, const int position, const int sample) {
+	//(2 ^ 16) / (2 ^ 16) = 1
+	((short*)buffer)[position] = (short)sample;
+}
+
+void reference_pcm_write_sample_16_float(void* buffer, const int position, const int sample) {
+	//(2 ^ 16) = 65536
+	((float*)buffer)[position] = (float)((sample + .5) / (65536 + .5));
+}
+
+void reference_pcm_write_sample_24_short(void* buffer, const int position, const int sample) {
+	//(2 ^ 16) / (2 ^ 24) = 0.00390625
+	((short*)buffer)[position] = (short)(sample * 0.00390625);
+}
+
+void reference_pcm_write_sample_24_float(void* buffer, const int position, const int sample) {
+	//(2 ^ 24) = 16777216
+	((float*)buffer)[position] = (float)((sample + .5) / (16777216 + .5));
+}
+
+void reference_pcm_write_sample_32_short(void* buffer, const int position, const int sample) {
+	//(2 ^ 16) / (2 ^ 32) = 0.00001525878
+	((short*)buffer)[position] = (short)(sample * 0.00001525878);
+}
+
+void reference_pcm_write_sample_32_float(void* buffer, const int position, const int sample) {
+	//(2 ^ 32) = 4294967296
+	((float*)buffer)[position] = (float)((sample + .5) / (4294967296 + .5));
+}
@@ -0,0 +1,166 @@
+/*
+ * This file is part of libdcadec.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation; either version 2.1 of the License, or (at your
+ * option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+// Lossless frequency band filters of libdcadec at commit 1814968
+
+#include "../../libdcadec/common.h"
+#include "../../libdcadec/fixed_math.h"
+#include "../../libdcadec/xll_decoder.h"
+#include "reference.h"
+
+static const int32_t band_coeff_table0[] = {
+    868669, -5931642, -1228483
+};
+
+static const int32_t band_coeff_table1[] = {
+      -20577,  122631,  -393647,  904476,
+    -1696305, 2825313, -4430736, 6791313
+};
+
+static const int32_t band_coeff_table2[] = {
+      41153,  -245210,  785564, -1788164,
+    3259333, -5074941, 6928550, -8204883
+};
+
+void reference_xll_filter_band_data(struct xll_chset *chs, int band_i)
+{
+    struct xll_decoder *xll = chs->decoder;
+    struct xll_band *band = &chs->bands[band_i];
+    int nsamples = xll->nframesamples;
+    int i, j, k;
+
+    // Inverse adaptive or fixed prediction
+    for (i = 0; i < chs->nchannels; i++) {
+        int *buf = band->msb_sample_buffer[i];
+        int order = band->adapt_pred_order[i];
+        if (order > 0) {
+            int coeff[XLL_MAX_ADAPT_PRED_ORDER];
+            // Conversion from reflection coefficients to direct form coefficients
+            for (j = 0; j < order; j++) {
+                int rc = band->adapt_refl_coeff[i][j];
+                for (k = 0; k < (j + 1) / 2; k++) {
+                    int tmp1 = coeff[    k    ];
+                    int tmp2 = coeff[j - k - 1];
+                    coeff[    k    ] = tmp1 + mul16(rc, tmp2);
+                    coeff[j - k - 1] = tmp2 + mul16(rc, tmp1);
+                }
+                coeff[j] = rc;
+            }
+            for (j = 0; j < nsamples - order; j++) {
+                int64_t err = INT64_C(0);
+                for (k = 0; k < order; k++)
+                    err += (int64_t)buf[j + k] * coeff[order - k - 1];
+                // Round and scale the prediction
+                // Calculate the original sample
+                buf[j + k] -= clip23(norm16(err));
+            }
+        } else {
+            // Inverse fixed coefficient prediction
+            for (j = 0; j < band->fixed_pred_order[i]; j++)
+                for (k = 1; k < nsamples; k++)
+                    buf[k] += buf[k - 1];
+        }
+    }
+
+    // Inverse pairwise channel decorrellation
+    if (band->decor_enabled) {
+        for (i = 0; i < chs->nchannels / 2; i++) {
+            int coeff = band->decor_coeff[i];
+            if (coeff) {
+                int *src = band->msb_sample_buffer[i * 2 + 0];
+                int *dst = band->msb_sample_buffer[i * 2 + 1];
+                for (j = 0; j < nsamples; j++)
+                    dst[j] += mul3(src[j], coeff);
+            }
+        }
+
+        // Reorder channel pointers to the original order
+        int *tmp[XLL_MAX_CHANNELS];
+        for (i = 0; i < chs->nchannels; i++)
+            tmp[i] = band->msb_sample_buffer[i];
+        for (i = 0; i < chs->nchannels; i++)
+            band->msb_sample_buffer[band->orig_order[i]] = tmp[i];
+    }
+
+    // Map output channel pointers for frequency band 0
+    if (band_i == XLL_BAND_0)
+        for (i = 0; i < chs->nchannels; i++)
+            chs->out_sample_buffer[i] = band->msb_sample_buffer[i];
+}
+
+static void filter0(int *dst, const int *src, int nsamples)
+{
+    for (int n = 0; n < nsamples; n++)
+        dst[n] -= src[n];
+}
+
+static void filter1(int *dst, const int *src, int nsamples, int32_t coeff)
+{
+    for (int n = 0; n < nsamples; n++)
+        dst[n] -= mul22(src[n], coeff);
+}
+
+static void filter2(int *dst, const int *src, int nsamples, int32_t coeff)
+{
+    for (int n = 0; n < nsamples; n++)
+        dst[n] -= mul23(src[n], coeff);
+}
+
+// Writes to output instead of the assembly buffer of the channel set, which
+// the caller allocates
+void reference_xll_assemble_freq_bands(struct xll_chset *chs, int *output)
+{
+    struct xll_decoder *xll = chs->decoder;
+    int nsamples = xll->nframesamples;
+
+    assert(chs->nfreqbands > 1);
+
+    // Assemble frequency bands 0 and 1
+    int *ptr = output;
+    for (int ch = 0; ch < chs->nchannels; ch++) {
+        // Remap output channel pointer to assembly buffer
+        chs->out_sample_buffer[ch] = ptr;
+
+        int *band0 = chs->bands[XLL_BAND_0].msb_sample_buffer[ch];
+        int *band1 = chs->bands[XLL_BAND_1].msb_sample_buffer[ch];
+
+        // Copy decimator history
+        for (int i = 1; i < XLL_DECI_HISTORY; i++)
+            band0[i - XLL_DECI_HISTORY] = chs->deci_history[ch][i];
+
+        // Filter
+        filter1(band0, band1, nsamples, band_coeff_table0[0]);
+        filter1(band1, band0, nsamples, band_coeff_table0[1]);
+        filter1(band0, band1, nsamples, band_coeff_table0[2]);
+        filter0(band1, band0, nsamples);
+
+        for (int i = 0; i < XLL_DECI_HISTORY; i++) {
+            filter2(band0, band1, nsamples, band_coeff_table1[i]);
+            filter2(band1, band0, nsamples, band_coeff_table2[i]);
+            filter2(band0, band1, nsamples, band_coeff_table1[i]);
+            band0--;
+        }
+
+        // Assemble
+        for (int i = 0; i < nsamples; i++) {
+            *ptr++ = *band1++;
+            *ptr++ = *++band0;
+        }
+    }
+
+}
@@ -0,0 +1,6 @@
+#include "../../libdcadec/xll_decoder.c"
+#include "dsp_kernels.h"
+
+int dsp_chs_assemble_freq_bands(struct xll_chset* chs) {
+	return chs_assemble_freq_bands(chs);
+}
@@ -0,0 +1,221 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <stdint.h>
+#include <getopt.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "dsp/dsp_kernels.h"
+
+//Times every kernel of dsp/dsp_kernels.c and the scalar reference it was rewritten from, kept in dsp/reference_*.c, on the same fixed seed inputs.
+//Both are warmed up, then run in alternating order and the median of the repetitions is reported, every output is checked against the reference.
+
+//Runs of both sides before the timed ones, to settle caches, branch predictors and the clock.
+#define DSP_WARMUP 8
+
+#if defined(__x86_64__) || defined(__i386__)
+#define DSP_CYCLES "cycles"
+
+static uint64_t dsp_cycles() {
+	//Reference cycles of the time stamp counter.
+	return __rdtsc();
+}
+#else
+#define DSP_CYCLES "ns"
+
+static uint64_t dsp_cycles() {
+	struct timespec time;
+	clock_gettime(CLOCK_MONOTONIC, &time);
+	return (uint64_t)time.tv_sec * 1000000000 + time.tv_nsec;
+}
+#endif
+
+static uint64_t dsp_run(const DSP_KERNEL* const kernel, void (*run)(DSP_STATE* state), DSP_STATE* const state) {
+	uint64_t start;
+	dsp_set.prepare(kernel, state);
+	start = dsp_cycles();
+	run(state);
+	return dsp_cycles() - start;
+}
+
+static int dsp_compare_cycles(const void* a, const void* b) {
+	uint64_t x = *(const uint64_t*)a;
+	uint64_t y = *(const uint64_t*)b;
+	return x < y ? -1 : x > y ? 1 : 0;
+}
+
+static double dsp_median(uint64_t* const times, const int count, const int units) {
+	qsort(times, count, sizeof(uint64_t), &dsp_compare_cycles);
+	if (count % 2) {
+		return (double)times[count / 2] / units;
+	}
+	return (double)(times[count / 2 - 1] + times[count / 2]) / 2 / units;
+}
+
+static void dsp_time(const DSP_KERNEL* const kernel, DSP_STATE* const state, DSP_STATE* const reference, const int repetitions, uint64_t* const times, uint64_t* const reference_times) {
+	int repetition;
+	for (repetition = 0; repetition < DSP_WARMUP; repetition++) {
+		dsp_run(kernel, kernel->run, state);
+		dsp_run(kernel, kernel->reference, reference);
+	}
+	//Alternating which side goes first so neither is favoured by the state the other leaves behind.
+	for (repetition = 0; repetition < repetitions; repetition++) {
+		if (repetition % 2) {
+			reference_times[repetition] = dsp_run(kernel, kernel->reference, reference);
+			times[repetition] = dsp_run(kernel, kernel->run, state);
+		}
+		else {
+			times[repetition] = dsp_run(kernel, kernel->run, state);
+			reference_times[repetition] = dsp_run(kernel, kernel->reference, reference);
+		}
+	}
+}
+
+static double dsp_value(const void* const output, const int type, const int index) {
+	switch (type) {
+	case DSP_INT32:
+		return ((const int32_t*)output)[index];
+	case DSP_INT16:
+		return ((const int16_t*)output)[index];
+	case DSP_UINT8:
+		return ((const uint8_t*)output)[index];
+	case DSP_FLOAT:
+		return ((const float*)output)[index];
+	case DSP_DOUBLE:
+		return ((const double*)output)[index];
+	}
+	return 0;
+}
+
+static double dsp_compare(const DSP_KERNEL* const kernel, const DSP_STATE* const state, const DSP_STATE* const reference) {
+	//Largest difference from the reference output, relative to its peak for floating point.
+	double difference = 0;
+	double peak = 0;
+	int index;
+	if (state->count != reference->count) {
+		return INFINITY;
+	}
+	for (index = 0; index < state->count; index++) {
+		double value = dsp_value(state->output, kernel->type, index);
+		double expected = dsp_value(reference->output, kernel->type, index);
+		if (!(fabs(value - expected) <= difference)) {
+			difference = fabs(value - expected);
+		}
+		if (fabs(expected) > peak) {
+			peak = fabs(expected);
+		}
+	}
+	if ((kernel->type == DSP_FLOAT || kernel->type == DSP_DOUBLE) && peak > 0) {
+		difference /= peak;
+	}
+	return difference;
+}
+
+static void dsp_usage() {
+	fprintf(stderr,
+		"Usage: dsp_bench [options] [kernel...]\n"
+		"  -n count   repetitions of every kernel, the median is reported (default 200)\n"
+		"  -l         list the kernels\n"
+		"Kernels are selected by prefix of their name, all of them by default.\n");
+}
+
+static int dsp_selected(const char* const name, char** const filters, const int count) {
+	int index;
+	if (!count) {
+		return 1;
+	}
+	for (index = 0; index < count; index++) {
+		if (!strncmp(name, filters[index], strlen(filters[index]))) {
+			return 1;
+		}
+	}
+	return 0;
+}
+
+int main(int argc, char** argv) {
+	int repetitions = 200;
+	uint64_t* times;
+	uint64_t* reference_times;
+	int failures = 0;
+	int option;
+	int index;
+
+	while ((option = getopt(argc, argv, "n:l")) != -1) {
+		switch (option) {
+		case 'n':
+			repetitions = atoi(optarg);
+			break;
+		case 'l':
+			for (index = 0; index < dsp_set.count; index++) {
+				printf("%s\n", dsp_set.kernels[index].name);
+			}
+			return 0;
+		default:
+			dsp_usage();
+			return 1;
+		}
+	}
+	if (repetitions < 1) {
+		dsp_usage();
+		return 1;
+	}
+	times = malloc(repetitions * sizeof(uint64_t));
+	reference_times = malloc(repetitions * sizeof(uint64_t));
+	if (!times || !reference_times) {
+		fprintf(stderr, "Out of memory\n");
+		return 1;
+	}
+
+	printf("%-32s %-7s %12s %12s %8s  %s\n", "kernel", "unit", DSP_CYCLES "/unit", "reference", "speedup", "check");
+	for (index = 0; index < dsp_set.count; index++) {
+		const DSP_KERNEL* kernel = &dsp_set.kernels[index];
+		DSP_STATE* state;
+		DSP_STATE* reference;
+		double time;
+		double reference_time;
+		double difference;
+
+		if (!dsp_selected(kernel->name, argv + optind, argc - optind)) {
+			continue;
+		}
+		if (!(state = kernel->create()) || !(reference = kernel->create())) {
+			fprintf(stderr, "Cannot create %s\n", kernel->name);
+			if (state) {
+				dsp_set.free(state);
+			}
+			failures++;
+			continue;
+		}
+
+		dsp_time(kernel, state, reference, repetitions, times, reference_times);
+		time = dsp_median(times, repetitions, state->units);
+		reference_time = dsp_median(reference_times, repetitions, reference->units);
+
+		//Outputs of a single run from the same state.
+		dsp_run(kernel, kernel->run, state);
+		dsp_run(kernel, kernel->reference, reference);
+		difference = dsp_compare(kernel, state, reference);
+
+		if (difference <= kernel->tolerance) {
+			printf("%-32s %-7s %12.3f %12.3f %7.2fx  ok", kernel->name, kernel->unit, time, reference_time, time > 0 ? reference_time / time : 0);
+		}
+		else {
+			printf("%-32s %-7s %12.3f %12.3f %7.2fx  FAILED", kernel->name, kernel->unit, time, reference_time, time > 0 ? reference_time / time : 0);
+			failures++;
+		}
+		if (difference > 0) {
+			printf(" (difference %g)", difference);
+		}
+		printf("\n");
+
+		dsp_set.free(state);
+		dsp_set.free(reference);
+	}
+	free(times);
+	free(reference_times);
+	return failures ? 1 : 0;
+}
@@ -0,0 +1,582 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <getopt.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <sys/resource.h>
+
+#include "bass_stub.h"
+#include "../bass_dts/dts_stream.h"
+#include "../bass_dts/dts_probe.h"
+#include "../bass_dts/pcm.h"
+#include "../bass_dts/context_pool.h"
+#include "../bass_dts/dts_stats.h"
+#include "../bass_dts/dts_trace.h"
+
+//Decodes files the way the plugin does, minus BASS itself, and reports the results as JSON.
+//Each file is decoded in every combination of output format and core synthesis, the fastest of the iterations is kept.
+//Optionally streams are also created and freed in a loop, with and without the decoder context pool, to time opening a stream.
+//In probe mode the files, and every file below directories, are only probed from disk as a player scanning its library does.
+
+#define BENCH_READ_SIZE (64 * 1024)
+
+#define BENCH_TRACE_EVENTS (1024 * 1024)
+
+typedef struct {
+	const char* name;
+	BYTE* data;
+	QWORD length;
+} BENCH_INPUT;
+
+#define BENCH_SYNTHESES 3
+
+//Core synthesis modes, by their -s and JSON name.
+static const char* const bench_synthesis_names[BENCH_SYNTHESES] = { "bitexact", "float", "float32" };
+static const int bench_synthesis_flags[BENCH_SYNTHESES] = { DCADEC_FLAG_CORE_BIT_EXACT, 0, DCADEC_FLAG_CORE_FLOAT32 };
+
+static const char* const bench_format_names[2] = { "s16", "float" };
+
+typedef struct {
+	BOOL output_float;
+	int synthesis;
+} BENCH_MODE;
+
+typedef struct {
+	int sample_rate;
+	int channel_count;
+	int bits_per_sample;
+	QWORD samples;
+	double seconds;
+	double frequency;
+	size_t peak;
+	size_t idle;
+	BASS_DTS_STATS stats;
+} BENCH_RESULT;
+
+static const char* const stage_names[BASS_DTS_STAGE_COUNT] = {
+	"core_parse",
+	"exss_parse",
+	"xll_parse",
+	"lbr_parse",
+	"core_filter",
+	"xll_filter",
+	"lbr_filter",
+	"downmix",
+	"shift_clip",
+	"file_read",
+	"convert",
+	"pcm"
+};
+
+//Files to probe, collected by bench_corpus_add.
+typedef struct {
+	char** names;
+	int count;
+	int capacity;
+} BENCH_CORPUS;
+
+static BENCH_CORPUS corpus;
+
+static BOOL probe = FALSE;
+static BOOL compact = FALSE;
+static BOOL realtime = FALSE;
+static BOOL arena = FALSE;
+static BOOL mapped = TRUE;
+static int cycles = 0;
+
+static double bench_time() {
+	struct timespec time;
+	clock_gettime(CLOCK_MONOTONIC, &time);
+	return time.tv_sec + time.tv_nsec * 1e-9;
+}
+
+static BOOL bench_load(const char* const name, BENCH_INPUT* const input) {
+	FILE* file = fopen(name, "rb");
+	long length;
+	if (!file) {
+		return FALSE;
+	}
+	if (fseek(file, 0, SEEK_END) || (length = ftell(file)) <= 0 || fseek(file, 0, SEEK_SET)) {
+		fclose(file);
+		return FALSE;
+	}
+	//The decoder reads a little past the end of frames parsed in place.
+	input->name = name;
+	input->length = length;
+	input->data = calloc(length + DCADEC_BUFFER_PADDING, 1);
+	if (!input->data || fread(input->data, 1, length, file) != (size_t)length) {
+		free(input->data);
+		fclose(file);
+		return FALSE;
+	}
+	fclose(file);
+	return TRUE;
+}
+
+static BOOL bench_decode(const BENCH_INPUT* const input, const BENCH_MODE* const mode, BENCH_RESULT* const result) {
+	//Same loop as BASS_DTS_StreamProc, with the stream created the way stream_create does.
+	static BYTE buffer[BENCH_READ_SIZE];
+	BENCH_FILE file;
+	DTS_STREAM* stream;
+	BASS_DTS_MEMORY memory;
+	int flags = (arena ? DCADEC_FLAG_ARENA : 0) | bench_synthesis_flags[mode->synthesis];
+	QWORD bytes = 0;
+	DWORD length;
+	double start = bench_time();
+	uint64_t ticks = dcadec_stats_timer();
+
+	if (!dts_stream_create(bench_file_open(&file, input->data, input->length), mapped ? input->data : NULL, input->length, flags, realtime, compact, &stream)) {
+		return FALSE;
+	}
+	stream->output_format.bits_per_sample = mode->output_float ? sizeof(float) * 8 : sizeof(short) * 8;
+	stream->output_format.bytes_per_sample = mode->output_float ? sizeof(float) : sizeof(short);
+	if (!(stream->write_sample = pcm_write_sample(stream->input_format, stream->output_format))) {
+		dts_stream_free(stream);
+		return FALSE;
+	}
+
+	while (dts_stream_update(stream)) {
+		while (stream->samples && stream->sample_count) {
+			if (!(length = dts_stream_read(stream, buffer, sizeof(buffer)))) {
+				break;
+			}
+			bytes += length;
+		}
+	}
+	if (stream->compact) {
+		//Compact streams release their buffers at the end.
+		dts_stream_trim(stream);
+	}
+
+	result->seconds = bench_time() - start;
+	result->frequency = (dcadec_stats_timer() - ticks) / result->seconds;
+	result->sample_rate = stream->sample_rate;
+	result->channel_count = stream->channel_count;
+	result->bits_per_sample = stream->input_format.bits_per_sample;
+	result->samples = bytes / (stream->output_format.bytes_per_sample * stream->channel_count);
+	dts_stats_get(stream, &result->stats);
+	dts_stats_memory(stream, &memory);
+	result->peak = sizeof(DTS_STREAM) +
+		memory.accounts[DCADEC_MEM_TOTAL].peak +
+		memory.accounts[BASS_DTS_MEM_FILE].peak;
+	result->idle = memory.size;
+
+	dts_stream_free(stream);
+	//Every iteration starts with a new decoder context, as if it was the first stream.
+	context_pool_trim(0);
+	return TRUE;
+}
+
+static int bench_compare(const void* const a, const void* const b) {
+	const double x = *(const double*)a;
+	const double y = *(const double*)b;
+	return x < y ? -1 : x > y;
+}
+
+static double bench_median(double* const values, const int count) {
+	qsort(values, count, sizeof(double), bench_compare);
+	return count % 2 ? values[count / 2] : (values[count / 2 - 1] + values[count / 2]) / 2;
+}
+
+static BOOL bench_lifecycle(const BENCH_INPUT* const input, const BOOL pool, double* const create, double* const release) {
+	//Create a stream, decode its first frame and free it again, like a player going from file to file.
+	//Without the pool every context is destroyed on free and the next stream creates a new one.
+	double* create_times = malloc(sizeof(double) * cycles);
+	double* release_times = malloc(sizeof(double) * cycles);
+	BENCH_FILE file;
+	DTS_STREAM* stream;
+	double start;
+	double middle;
+	BOOL result = create_times && release_times;
+	int cycle;
+
+	context_pool_trim(0);
+	//The first cycle is a warm up and isn't counted.
+	for (cycle = -1; result && cycle < cycles; cycle++) {
+		start = bench_time();
+		if (!dts_stream_create(bench_file_open(&file, input->data, input->length), mapped ? input->data : NULL, input->length, arena ? DCADEC_FLAG_ARENA : 0, realtime, compact, &stream)) {
+			result = FALSE;
+			break;
+		}
+		result = dts_stream_update(stream);
+		middle = bench_time();
+		dts_stream_free(stream);
+		if (!pool) {
+			context_pool_trim(0);
+		}
+		if (cycle >= 0) {
+			create_times[cycle] = middle - start;
+			release_times[cycle] = bench_time() - middle;
+		}
+	}
+	context_pool_trim(0);
+
+	if (result) {
+		*create = bench_median(create_times, cycles);
+		*release = bench_median(release_times, cycles);
+	}
+	free(create_times);
+	free(release_times);
+	return result;
+}
+
+static BOOL bench_corpus_add(const char* const name) {
+	//Adds a file, or every regular file below a directory in the order it lists them. Symbolic links to directories aren't followed.
+	struct stat status;
+	if (lstat(name, &status)) {
+		return FALSE;
+	}
+	if (S_ISDIR(status.st_mode)) {
+		DIR* directory;
+		struct dirent* entry;
+		BOOL success = TRUE;
+		if (!(directory = opendir(name))) {
+			return FALSE;
+		}
+		while (success && (entry = readdir(directory))) {
+			char* path;
+			if (!strcmp(entry->d_name, ".") || !strcmp(entry->d_name, "..")) {
+				continue;
+			}
+			if (!(path = malloc(strlen(name) + strlen(entry->d_name) + 2))) {
+				success = FALSE;
+				break;
+			}
+			sprintf(path, "%s/%s", name, entry->d_name);
+			success = bench_corpus_add(path);
+			free(path);
+		}
+		closedir(directory);
+		return success;
+	}
+	if (!S_ISREG(status.st_mode)) {
+		return TRUE;
+	}
+	if (corpus.count == corpus.capacity) {
+		int capacity = corpus.capacity ? corpus.capacity * 2 : 256;
+		char** names = realloc(corpus.names, sizeof(char*) * capacity);
+		if (!names) {
+			return FALSE;
+		}
+		corpus.names = names;
+		corpus.capacity = capacity;
+	}
+	if (!(corpus.names[corpus.count] = strdup(name))) {
+		return FALSE;
+	}
+	corpus.count++;
+	return TRUE;
+}
+
+static void bench_corpus_free() {
+	int index;
+	for (index = 0; index < corpus.count; index++) {
+		free(corpus.names[index]);
+	}
+	free(corpus.names);
+	ZeroMemory(&corpus, sizeof(corpus));
+}
+
+static int bench_probe(double* const seconds) {
+	//One pass over the corpus, each file is opened, probed like BASS_DTS_Probe and closed. Returns how many are DTS.
+	BASS_DTS_PROBEINFO info;
+	BENCH_FILE file;
+	BASSFILE handle;
+	FILE* stream;
+	int probed = 0;
+	int index;
+	double start = bench_time();
+	for (index = 0; index < corpus.count; index++) {
+		if (!(stream = fopen(corpus.names[index], "rb"))) {
+			continue;
+		}
+		if ((handle = bench_file_open_stream(&file, stream)) && dts_probe(handle, &info)) {
+			probed++;
+		}
+		fclose(stream);
+	}
+	*seconds = bench_time() - start;
+	return probed;
+}
+
+static void bench_write_string(FILE* const output, const char* string) {
+	fputc('"', output);
+	for (; *string; string++) {
+		if (*string == '"' || *string == '\\') {
+			fprintf(output, "\\%c", *string);
+		}
+		else if ((unsigned char)*string < 0x20) {
+			fprintf(output, "\\u%04x", *string);
+		}
+		else {
+			fputc(*string, output);
+		}
+	}
+	fputc('"', output);
+}
+
+static void bench_write_result(FILE* const output, const BENCH_INPUT* const input, const BENCH_MODE* const mode, const BENCH_RESULT* const result, const BOOL first) {
+	//Stage times are nanoseconds per sample per channel, so streams of any layout can be compared.
+	double duration = result->sample_rate ? (double)result->samples / result->sample_rate : 0;
+	double samples = (double)result->samples * result->channel_count;
+	int index;
+
+	fprintf(output, "%s\n    {\"file\": ", first ? "" : ",");
+	bench_write_string(output, input->name);
+	fprintf(output, ", \"output\": \"%s\", \"synthesis\": \"%s\",\n", bench_format_names[mode->output_float], bench_synthesis_names[mode->synthesis]);
+	fprintf(output, "     \"sample_rate\": %d, \"channels\": %d, \"bits_per_sample\": %d, \"frames\": %llu, \"errors\": %llu, \"resyncs\": %llu,\n",
+		result->sample_rate, result->channel_count, result->bits_per_sample,
+		(unsigned long long)result->stats.frames, (unsigned long long)result->stats.errors, (unsigned long long)result->stats.resyncs);
+	fprintf(output, "     \"samples\": %llu, \"duration\": %.6f, \"seconds\": %.6f, \"x_realtime\": %.3f, \"ns_per_sample\": %.3f, \"peak_bytes\": %llu, \"idle_bytes\": %llu,\n",
+		(unsigned long long)result->samples, duration, result->seconds,
+		result->seconds > 0 ? duration / result->seconds : 0,
+		samples > 0 ? result->seconds * 1e9 / samples : 0,
+		(unsigned long long)result->peak, (unsigned long long)result->idle);
+	fprintf(output, "     \"stages\": {");
+	for (index = 0; index < BASS_DTS_STAGE_COUNT; index++) {
+		fprintf(output, "%s\"%s\": %.3f", index ? ", " : "", stage_names[index],
+			samples > 0 && result->frequency > 0 ? result->stats.stages[index].time * 1e9 / result->frequency / samples : 0);
+	}
+	fprintf(output, "}}");
+}
+
+static BOOL bench_parse_list(const char* const list, const char* const* const names, const int count, BOOL* const modes) {
+	//Comma separated list of the choices of a mode, modes[i] is set for names[i].
+	char buffer[64];
+	char* token;
+	char* state;
+	BOOL any = FALSE;
+	int index;
+	for (index = 0; index < count; index++) {
+		modes[index] = FALSE;
+	}
+	snprintf(buffer, sizeof(buffer), "%s", list);
+	for (token = strtok_r(buffer, ",", &state); token; token = strtok_r(NULL, ",", &state)) {
+		for (index = 0; index < count && strcmp(token, names[index]); index++);
+		if (index == count) {
+			return FALSE;
+		}
+		modes[index] = any = TRUE;
+	}
+	return any;
+}
+
+static void bench_usage() {
+	fprintf(stderr,
+		"Usage: dts_bench [options] file...\n"
+		"  -n count   decode every file and mode count times, the fastest is reported (default 3)\n"
+		"  -f list    output formats: s16,float (default both)\n"
+		"  -s list    core synthesis: bitexact,float,float32 (default all)\n"
+		"  -c         decode compact streams (buffers released at the end)\n"
+		"  -a         decode real-time streams (arena with memory reserved up front)\n"
+		"  -A         decode from an arena without reserving memory\n"
+		"  -r         read frames through the file layer instead of parsing them in place\n"
+		"  -o file    write the JSON results to file instead of stdout\n"
+		"  -t file    write a Chrome trace of all decoding to file\n"
+		"  -l count   also create and free every stream count times with and without the context pool\n"
+		"  -p         only probe the files and everything below directories, count passes, the fastest is reported\n");
+}
+
+static BOOL bench_write_trace(const char* const name) {
+	FILE* file;
+	char* buffer;
+	DWORD length;
+	BOOL result;
+	if (!dts_trace_json(NULL, 0, &length) || !(buffer = malloc(length + 1))) {
+		return FALSE;
+	}
+	result = dts_trace_json(buffer, length + 1, &length) && (file = fopen(name, "w")) != NULL;
+	if (result) {
+		result = fwrite(buffer, 1, length, file) == length;
+		fclose(file);
+	}
+	free(buffer);
+	return result;
+}
+
+int main(int argc, char** argv) {
+	BOOL formats[2] = { TRUE, TRUE };
+	BOOL syntheses[BENCH_SYNTHESES] = { TRUE, TRUE, TRUE };
+	const char* output_name = NULL;
+	const char* trace_name = NULL;
+	FILE* output = stdout;
+	int iterations = 3;
+	BOOL first = TRUE;
+	int failures = 0;
+	struct rusage usage;
+	int option;
+	int index;
+	int format;
+	int synthesis;
+	int iteration;
+
+	while ((option = getopt(argc, argv, "n:f:s:caAro:t:l:p")) != -1) {
+		switch (option) {
+		case 'n':
+			iterations = atoi(optarg);
+			break;
+		case 'f':
+			if (!bench_parse_list(optarg, bench_format_names, 2, formats)) {
+				bench_usage();
+				return 1;
+			}
+			break;
+		case 's':
+			if (!bench_parse_list(optarg, bench_synthesis_names, BENCH_SYNTHESES, syntheses)) {
+				bench_usage();
+				return 1;
+			}
+			break;
+		case 'c':
+			compact = TRUE;
+			break;
+		case 'a':
+			realtime = TRUE;
+			arena = TRUE;
+			break;
+		case 'A':
+			arena = TRUE;
+			break;
+		case 'r':
+			mapped = FALSE;
+			break;
+		case 'o':
+			output_name = optarg;
+			break;
+		case 't':
+			trace_name = optarg;
+			break;
+		case 'l':
+			cycles = atoi(optarg);
+			break;
+		case 'p':
+			probe = TRUE;
+			break;
+		default:
+			bench_usage();
+			return 1;
+		}
+	}
+	if (optind >= argc || iterations < 1 || cycles < 0 || (compact && arena)) {
+		bench_usage();
+		return 1;
+	}
+	if (output_name && !(output = fopen(output_name, "w"))) {
+		fprintf(stderr, "Cannot write %s\n", output_name);
+		return 1;
+	}
+
+	context_pool_init();
+	dts_stats_init();
+	if (trace_name) {
+		dts_trace_start(BENCH_TRACE_EVENTS);
+	}
+
+	if (probe) {
+		double best = 0;
+		double seconds;
+		int probed = 0;
+		for (index = optind; index < argc; index++) {
+			if (!bench_corpus_add(argv[index])) {
+				fprintf(stderr, "Cannot read %s\n", argv[index]);
+				failures++;
+			}
+		}
+		for (iteration = 0; iteration < iterations && corpus.count; iteration++) {
+			probed = bench_probe(&seconds);
+			if (!iteration || seconds < best) {
+				best = seconds;
+			}
+		}
+		getrusage(RUSAGE_SELF, &usage);
+		fprintf(output, "{\"iterations\": %d,\n \"probe\": {\"files\": %d, \"probed\": %d, \"seconds\": %.6f, \"files_per_second\": %.1f},\n \"max_rss_kb\": %ld}\n",
+			iterations, corpus.count, probed, best, best > 0 ? corpus.count / best : 0, usage.ru_maxrss);
+		fprintf(stderr, "%d files, %d DTS: %.0f files/s\n", corpus.count, probed, best > 0 ? corpus.count / best : 0);
+		bench_corpus_free();
+	}
+	else {
+
+		fprintf(output, "{\"iterations\": %d, \"compact\": %s, \"realtime\": %s, \"arena\": %s, \"mapped\": %s,\n \"runs\": [",
+			iterations, compact ? "true" : "false", realtime ? "true" : "false", arena ? "true" : "false", mapped ? "true" : "false");
+		for (index = optind; index < argc; index++) {
+			BENCH_INPUT input;
+			if (!bench_load(argv[index], &input)) {
+				fprintf(stderr, "Cannot read %s\n", argv[index]);
+				failures++;
+				continue;
+			}
+			for (format = 0; format < 2; format++) {
+				for (synthesis = 0; synthesis < BENCH_SYNTHESES; synthesis++) {
+					BENCH_MODE mode = { format == 1, synthesis };
+					BENCH_RESULT best = { 0 };
+					BENCH_RESULT result;
+					if (!formats[format] || !syntheses[synthesis]) {
+						continue;
+					}
+					for (iteration = 0; iteration < iterations; iteration++) {
+						if (!bench_decode(&input, &mode, &result)) {
+							break;
+						}
+						if (!iteration || result.seconds < best.seconds) {
+							best = result;
+						}
+					}
+					if (iteration < iterations) {
+						fprintf(stderr, "Cannot decode %s\n", input.name);
+						failures++;
+						continue;
+					}
+					bench_write_result(output, &input, &mode, &best, first);
+					first = FALSE;
+					fprintf(stderr, "%s %s/%s: %.1fx realtime\n", input.name,
+						bench_format_names[format], bench_synthesis_names[synthesis],
+						best.seconds > 0 && best.sample_rate ? (double)best.samples / best.sample_rate / best.seconds : 0);
+				}
+			}
+			free(input.data);
+		}
+		fprintf(output, "\n ],\n \"lifecycle\": [");
+		first = TRUE;
+		for (index = optind; cycles && index < argc; index++) {
+			BENCH_INPUT input;
+			int pool;
+			if (!bench_load(argv[index], &input)) {
+				continue;
+			}
+			//Stream creation time includes decoding the first frame, that's when the decoder allocates its buffers.
+			for (pool = 1; pool >= 0; pool--) {
+				double create;
+				double release;
+				if (!bench_lifecycle(&input, pool, &create, &release)) {
+					fprintf(stderr, "Cannot create streams of %s\n", input.name);
+					failures++;
+					break;
+				}
+				fprintf(output, "%s\n    {\"file\": ", first ? "" : ",");
+				bench_write_string(output, input.name);
+				fprintf(output, ", \"pool\": %s, \"cycles\": %d, \"create_us\": %.3f, \"free_us\": %.3f}",
+					pool ? "true" : "false", cycles, create * 1e6, release * 1e6);
+				first = FALSE;
+				fprintf(stderr, "%s pool %s: create %.1f us, free %.1f us\n", input.name, pool ? "on" : "off", create * 1e6, release * 1e6);
+			}
+			free(input.data);
+		}
+		getrusage(RUSAGE_SELF, &usage);
+		fprintf(output, "\n ],\n \"max_rss_kb\": %ld}\n", usage.ru_maxrss);
+	}
+
+	if (trace_name) {
+		dts_trace_stop();
+		if (!bench_write_trace(trace_name)) {
+			fprintf(stderr, "Cannot write %s\n", trace_name);
+			failures++;
+		}
+		dts_trace_free();
+	}
+	context_pool_free();
+	dts_stats_free();
+	if (output != stdout) {
+		fclose(output);
+	}
+	return failures ? 1 : 0;
+}
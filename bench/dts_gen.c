@@ -0,0 +1,723 @@
+#include <getopt.h>
+
+#include "../libdcadec/common.h"
+#include "../libdcadec/bitstream.h"
+#include "../libdcadec/core_decoder.h"
+#include "../libdcadec/core_tables.h"
+#include "../libdcadec/core_huffman.h"
+
+//Writes synthetic DTS core streams (optionally with the X96 extension) that exercise the paths of core_decoder.c.
+//The subband samples are seeded noise shaped by scale factors falling with frequency, not encoded audio.
+//Every choice is drawn from the seed so the same options always give the same file.
+
+#define GEN_MAX_FRAME_SIZE 16384
+#define GEN_MAX_X96_FRAME_SIZE 4096
+#define GEN_MIN_FRAME_SIZE 96
+
+#define GEN_X96_REVISION 8
+
+//Extension audio descriptor of X96, private to core_decoder.c.
+#define GEN_EXT_AUDIO_X96 2
+
+#define GEN_HUFFMAN 1
+#define GEN_BLOCK 2
+#define GEN_LINEAR 4
+#define GEN_MIXED (GEN_HUFFMAN | GEN_BLOCK | GEN_LINEAR)
+
+typedef struct {
+	uint8_t* data;
+	int size;
+	int length;
+	uint64_t cache;
+	int cached;
+	int overflow;
+} GEN_BITS;
+
+typedef struct {
+	int audio_mode;
+	int channels;
+	int lfe;
+	int rate_index;
+	int npcmblocks;
+	int subbands;
+	int vq_start;
+	int quantization;
+	int adpcm;
+	int x96;
+	int frame_size;
+	int frames;
+	unsigned int seed;
+} GEN_OPTIONS;
+
+typedef struct {
+	int nsubframes;
+	int nsubsubframes[MAX_SUBFRAMES];
+	int transition_sel[MAX_CHANNELS];
+	int scale_sel[MAX_CHANNELS];
+	int bit_allocation_sel[MAX_CHANNELS];
+	int quant_sel[MAX_CHANNELS][NUM_CODE_BOOKS];
+	int bit_allocation[MAX_CHANNELS][MAX_SUBBANDS_X96];
+	int transition[MAX_CHANNELS][MAX_SUBBANDS];
+} GEN_FRAME;
+
+//Primary channel count to the audio channel arrangement written for it.
+static const int gen_audio_modes[] = { -1, 0, 2, 5, 8, 9 };
+
+static unsigned int gen_random(unsigned int* const seed) {
+	//Xorshift, the same generator as the kernel benchmarks.
+	unsigned int value = *seed;
+	value ^= value << 13;
+	value ^= value >> 17;
+	value ^= value << 5;
+	return *seed = value;
+}
+
+static int gen_range(unsigned int* const seed, const int minimum, const int maximum) {
+	return minimum + (int)(gen_random(seed) % (unsigned int)(maximum - minimum + 1));
+}
+
+static int gen_sample(unsigned int* const seed, const int maximum) {
+	//Small values are the most likely, as they are in real subbands.
+	int value = gen_range(seed, 0, maximum) * gen_range(seed, 0, maximum) / maximum;
+	return (gen_random(seed) & 1) ? -value : value;
+}
+
+static void gen_put(GEN_BITS* const bits, const uint32_t value, const int count) {
+	if (!count) {
+		return;
+	}
+	bits->cache = (bits->cache << count) | (value & (0xffffffffu >> (32 - count)));
+	bits->cached += count;
+	while (bits->cached >= 8) {
+		bits->cached -= 8;
+		if (bits->length < bits->size) {
+			bits->data[bits->length++] = (uint8_t)(bits->cache >> bits->cached);
+		}
+		else {
+			bits->overflow = 1;
+		}
+	}
+}
+
+static void gen_align(GEN_BITS* const bits, const int bytes) {
+	//Zero pads to the next multiple of bytes.
+	if (bits->cached) {
+		gen_put(bits, 0, 8 - bits->cached);
+	}
+	while (bits->length % bytes) {
+		gen_put(bits, 0, 8);
+	}
+}
+
+static void gen_patch(uint8_t* const data, const int position, const uint32_t value, const int count) {
+	//Rewrites a field of count bits at a bit position already written.
+	int index;
+	for (index = 0; index < count; index++) {
+		const int bit = position + index;
+		const int mask = 0x80 >> (bit & 7);
+		if ((value >> (count - 1 - index)) & 1) {
+			data[bit >> 3] |= mask;
+		}
+		else {
+			data[bit >> 3] &= ~mask;
+		}
+	}
+}
+
+static void gen_put_vlc(GEN_BITS* const bits, const struct huffman* const huffman, const int index) {
+	gen_put(bits, huffman->code[index], huffman->len[index]);
+}
+
+static void gen_put_signed_vlc(GEN_BITS* const bits, const struct huffman* const huffman, const int value) {
+	//Inverse of bits_get_signed_vlc, positive values are odd.
+	gen_put_vlc(bits, huffman, value > 0 ? 2 * value - 1 : -2 * value);
+}
+
+static void gen_put_scale(GEN_BITS* const bits, const int sel, int* const previous, const int level) {
+	//Level is in steps of the 6 bit table, the 7 bit table has twice the resolution.
+	if (sel < 5) {
+		gen_put_signed_vlc(bits, &scale_factor_huff[sel], level - *previous);
+		*previous = level;
+	}
+	else if (sel == 5) {
+		gen_put(bits, level, 6);
+	}
+	else {
+		gen_put(bits, level * 2, 7);
+	}
+}
+
+static int gen_level(unsigned int* const seed, const int band) {
+	//Louder low bands, within the 6 bit table.
+	int level = 44 - band + gen_range(seed, -3, 3);
+	return level < 1 ? 1 : level;
+}
+
+static void gen_put_samples(GEN_BITS* const bits, unsigned int* const seed, const int* const quant_sel, const int abits) {
+	//One block of subband samples coded the way extract_audio reads it back.
+	int samples[NUM_SUBBAND_SAMPLES];
+	int index;
+	if (!abits) {
+		return;
+	}
+	if (abits <= NUM_CODE_BOOKS && quant_sel[abits - 1] < quant_index_group_size[abits - 1]) {
+		const struct huffman* huffman = &quant_index_group_huff[abits - 1][quant_sel[abits - 1]];
+		for (index = 0; index < NUM_SUBBAND_SAMPLES; index++) {
+			gen_put_signed_vlc(bits, huffman, gen_sample(seed, (huffman->size - 1) / 2));
+		}
+	}
+	else if (abits <= 7) {
+		const int levels = quant_levels[abits];
+		const int offset = (levels - 1) / 2;
+		int half;
+		for (index = 0; index < NUM_SUBBAND_SAMPLES; index++) {
+			samples[index] = gen_sample(seed, offset);
+		}
+		for (half = 0; half < 2; half++) {
+			uint32_t code = 0;
+			for (index = NUM_SUBBAND_SAMPLES / 2 - 1; index >= 0; index--) {
+				code = code * levels + samples[half * NUM_SUBBAND_SAMPLES / 2 + index] + offset;
+			}
+			gen_put(bits, code, block_code_nbits[abits]);
+		}
+	}
+	else {
+		const int count = abits - 3;
+		for (index = 0; index < NUM_SUBBAND_SAMPLES; index++) {
+			gen_put(bits, gen_sample(seed, (1 << (count - 1)) - 1), count);
+		}
+	}
+}
+
+static int gen_quant_sel(unsigned int* const seed, const int quantization, const int book) {
+	if (quantization == GEN_HUFFMAN) {
+		return gen_range(seed, 0, quant_index_group_size[book] - 1);
+	}
+	if (quantization == GEN_MIXED) {
+		return gen_range(seed, 0, quant_index_group_size[book]);
+	}
+	//Block codes up to 7 bits, linear above.
+	return quant_index_group_size[book];
+}
+
+static int gen_abits(unsigned int* const seed, const GEN_OPTIONS* const options, const int sel) {
+	//Allocation within what the codebooks of the mode can code and the bit allocation codebook can send.
+	switch (options->quantization) {
+	case GEN_HUFFMAN:
+		return gen_range(seed, 1, NUM_CODE_BOOKS);
+	case GEN_BLOCK:
+		return gen_range(seed, 1, 7);
+	case GEN_LINEAR:
+		return gen_range(seed, 8, 15);
+	}
+	return gen_range(seed, sel < 5 ? 1 : 0, 12);
+}
+
+static void gen_frame_header(GEN_BITS* const bits, const GEN_OPTIONS* const options) {
+	gen_put(bits, SYNC_WORD_CORE, 32);
+	//Normal frame, deficit sample count, no CRC.
+	gen_put(bits, 1, 1);
+	gen_put(bits, NUM_PCMBLOCK_SAMPLES - 1, 5);
+	gen_put(bits, 0, 1);
+	gen_put(bits, options->npcmblocks - 1, 7);
+	//Frame size and bit rate are patched once the frame is complete.
+	gen_put(bits, 0, 14);
+	gen_put(bits, options->audio_mode, 6);
+	gen_put(bits, options->rate_index, 4);
+	gen_put(bits, 0, 5);
+	//Reserved, dynamic range, time stamp, auxiliary data, HDCD.
+	gen_put(bits, 0, 5);
+	gen_put(bits, options->x96 ? GEN_EXT_AUDIO_X96 : 0, 3);
+	gen_put(bits, options->x96, 1);
+	//No audio sync word after every subsubframe.
+	gen_put(bits, 0, 1);
+	gen_put(bits, options->lfe, 2);
+	gen_put(bits, options->adpcm, 1);
+	//Multirate interpolator, encoder revision, copy history.
+	gen_put(bits, 0, 1);
+	gen_put(bits, 7, 4);
+	gen_put(bits, 0, 2);
+	//24 bit source PCM, no sum/difference, dialog normalization.
+	gen_put(bits, 6, 3);
+	gen_put(bits, 0, 2);
+	gen_put(bits, 0, 4);
+}
+
+static void gen_coding_header(GEN_BITS* const bits, unsigned int* const seed, const GEN_OPTIONS* const options, GEN_FRAME* const frame) {
+	int ch;
+	int n;
+
+	gen_put(bits, frame->nsubframes - 1, 4);
+	gen_put(bits, options->channels - 1, 3);
+	for (ch = 0; ch < options->channels; ch++) {
+		gen_put(bits, options->subbands - 2, 5);
+	}
+	for (ch = 0; ch < options->channels; ch++) {
+		gen_put(bits, options->vq_start - 1, 5);
+	}
+	//No joint intensity coding.
+	for (ch = 0; ch < options->channels; ch++) {
+		gen_put(bits, 0, 3);
+	}
+	for (ch = 0; ch < options->channels; ch++) {
+		frame->transition_sel[ch] = gen_range(seed, 0, 3);
+		gen_put(bits, frame->transition_sel[ch], 2);
+	}
+	for (ch = 0; ch < options->channels; ch++) {
+		frame->scale_sel[ch] = options->quantization & GEN_HUFFMAN ? gen_range(seed, 0, options->quantization == GEN_HUFFMAN ? 4 : 6) : gen_range(seed, 5, 6);
+		gen_put(bits, frame->scale_sel[ch], 3);
+	}
+	for (ch = 0; ch < options->channels; ch++) {
+		switch (options->quantization) {
+		case GEN_HUFFMAN:
+			frame->bit_allocation_sel[ch] = gen_range(seed, 0, 4);
+			break;
+		case GEN_LINEAR:
+			frame->bit_allocation_sel[ch] = 6;
+			break;
+		default:
+			frame->bit_allocation_sel[ch] = gen_range(seed, 0, 6);
+			break;
+		}
+		gen_put(bits, frame->bit_allocation_sel[ch], 3);
+	}
+	for (n = 0; n < NUM_CODE_BOOKS; n++) {
+		for (ch = 0; ch < options->channels; ch++) {
+			frame->quant_sel[ch][n] = gen_quant_sel(seed, options->quantization, n);
+			gen_put(bits, frame->quant_sel[ch][n], quant_index_sel_nbits[n]);
+		}
+	}
+	for (n = 0; n < NUM_CODE_BOOKS; n++) {
+		for (ch = 0; ch < options->channels; ch++) {
+			if (frame->quant_sel[ch][n] < quant_index_group_size[n]) {
+				gen_put(bits, gen_range(seed, 0, 3), 2);
+			}
+		}
+	}
+}
+
+static void gen_subframe(GEN_BITS* const bits, unsigned int* const seed, const GEN_OPTIONS* const options, GEN_FRAME* const frame, const int sf) {
+	const int nsubsubframes = frame->nsubsubframes[sf];
+	int prediction[MAX_CHANNELS][MAX_SUBBANDS];
+	int ch;
+	int band;
+	int ssf;
+	int n;
+
+	gen_put(bits, nsubsubframes - 1, 2);
+	gen_put(bits, 0, 3);
+
+	//Prediction mode and coefficients VQ address.
+	for (ch = 0; ch < options->channels; ch++) {
+		for (band = 0; band < options->subbands; band++) {
+			prediction[ch][band] = options->adpcm && (gen_random(seed) & 1);
+			gen_put(bits, prediction[ch][band], 1);
+		}
+	}
+	for (ch = 0; ch < options->channels; ch++) {
+		for (band = 0; band < options->subbands; band++) {
+			if (prediction[ch][band]) {
+				gen_put(bits, gen_range(seed, 0, 4095), 12);
+			}
+		}
+	}
+
+	//Bit allocation index.
+	for (ch = 0; ch < options->channels; ch++) {
+		const int sel = frame->bit_allocation_sel[ch];
+		for (band = 0; band < options->vq_start; band++) {
+			const int abits = gen_abits(seed, options, sel);
+			frame->bit_allocation[ch][band] = abits;
+			if (sel < 5) {
+				gen_put_vlc(bits, &bit_allocation_huff[sel], abits - 1);
+			}
+			else {
+				gen_put(bits, abits, sel - 1);
+			}
+		}
+	}
+
+	//Transition mode, only with more than one subsubframe.
+	for (ch = 0; ch < options->channels; ch++) {
+		for (band = 0; band < options->vq_start; band++) {
+			frame->transition[ch][band] = 0;
+			if (nsubsubframes > 1 && frame->bit_allocation[ch][band]) {
+				if (!(gen_random(seed) & 7)) {
+					frame->transition[ch][band] = gen_range(seed, 1, nsubsubframes - 1);
+				}
+				gen_put_vlc(bits, &transition_mode_huff[frame->transition_sel[ch]], frame->transition[ch][band]);
+			}
+		}
+	}
+
+	//Scale factors, for allocated subbands and every VQ subband.
+	for (ch = 0; ch < options->channels; ch++) {
+		int previous = 0;
+		for (band = 0; band < options->subbands; band++) {
+			if (band >= options->vq_start || frame->bit_allocation[ch][band]) {
+				gen_put_scale(bits, frame->scale_sel[ch], &previous, gen_level(seed, band));
+				if (band < options->vq_start && frame->transition[ch][band]) {
+					gen_put_scale(bits, frame->scale_sel[ch], &previous, gen_level(seed, band));
+				}
+			}
+		}
+	}
+
+	//High frequency VQ.
+	for (ch = 0; ch < options->channels; ch++) {
+		for (band = options->vq_start; band < options->subbands; band++) {
+			gen_put(bits, gen_range(seed, 0, 1023), 10);
+		}
+	}
+
+	//LFE samples and their 7 bit table scale factor.
+	if (options->lfe) {
+		for (n = 0; n < 2 * options->lfe * nsubsubframes; n++) {
+			gen_put(bits, gen_sample(seed, 127), 8);
+		}
+		gen_put(bits, gen_range(seed, 80, 100), 8);
+	}
+
+	for (ssf = 0; ssf < nsubsubframes; ssf++) {
+		for (ch = 0; ch < options->channels; ch++) {
+			for (band = 0; band < options->vq_start; band++) {
+				gen_put_samples(bits, seed, frame->quant_sel[ch], frame->bit_allocation[ch][band]);
+			}
+		}
+		if (ssf == nsubsubframes - 1) {
+			gen_put(bits, 0xffff, 16);
+		}
+	}
+}
+
+static void gen_x96_frame(GEN_BITS* const bits, unsigned int* const seed, const GEN_OPTIONS* const options, GEN_FRAME* const frame) {
+	//Revision 8 codes subbands 32 to 63 only, the core keeps the lower half.
+	const int start = MAX_SUBBANDS;
+	const int end = MAX_SUBBANDS_X96;
+	int scale_sel[MAX_CHANNELS];
+	int bit_allocation_sel[MAX_CHANNELS];
+	int quant_sel[MAX_CHANNELS][NUM_CODE_BOOKS];
+	int ch;
+	int band;
+	int sf;
+	int n;
+
+	gen_put(bits, SYNC_WORD_X96, 32);
+	//Frame size is patched along with the core frame size.
+	gen_put(bits, 0, 12);
+	gen_put(bits, GEN_X96_REVISION, 4);
+
+	//Coding header, standard resolution.
+	gen_put(bits, 0, 1);
+	for (ch = 0; ch < options->channels; ch++) {
+		gen_put(bits, end - 1, 6);
+	}
+	for (ch = 0; ch < options->channels; ch++) {
+		gen_put(bits, 0, 3);
+	}
+	for (ch = 0; ch < options->channels; ch++) {
+		scale_sel[ch] = options->quantization & GEN_HUFFMAN ? gen_range(seed, 0, options->quantization == GEN_HUFFMAN ? 4 : 5) : 5;
+		gen_put(bits, scale_sel[ch], 3);
+	}
+	for (ch = 0; ch < options->channels; ch++) {
+		bit_allocation_sel[ch] = options->quantization & GEN_HUFFMAN ? gen_range(seed, 0, options->quantization == GEN_HUFFMAN ? 6 : 7) : 7;
+		gen_put(bits, bit_allocation_sel[ch], 3);
+	}
+	for (n = 0; n < 6; n++) {
+		for (ch = 0; ch < options->channels; ch++) {
+			quant_sel[ch][n] = gen_quant_sel(seed, options->quantization, n);
+			gen_put(bits, quant_sel[ch][n], quant_index_sel_nbits[n]);
+		}
+	}
+
+	for (sf = 0; sf < frame->nsubframes; sf++) {
+		const int nsubsubframes = frame->nsubsubframes[sf];
+		int prediction[MAX_CHANNELS][MAX_SUBBANDS_X96];
+		int ssf;
+
+		for (ch = 0; ch < options->channels; ch++) {
+			for (band = start; band < end; band++) {
+				prediction[ch][band] = options->adpcm && (gen_random(seed) & 1);
+				gen_put(bits, prediction[ch][band], 1);
+			}
+		}
+		for (ch = 0; ch < options->channels; ch++) {
+			for (band = start; band < end; band++) {
+				if (prediction[ch][band]) {
+					gen_put(bits, gen_range(seed, 0, 4095), 12);
+				}
+			}
+		}
+
+		//Bit allocation: 0 is noise, 1 is VQ, above is one more than the quantizer.
+		for (ch = 0; ch < options->channels; ch++) {
+			const int sel = bit_allocation_sel[ch];
+			int previous = 0;
+			for (band = start; band < end; band++) {
+				const int abits = gen_range(seed, 0, band < start + 8 ? 4 : 2);
+				frame->bit_allocation[ch][band] = abits;
+				if (sel < 7) {
+					gen_put_signed_vlc(bits, &quant_index_huff_5[sel], abits - previous);
+					previous = abits;
+				}
+				else {
+					gen_put(bits, abits, 3);
+				}
+			}
+		}
+
+		//Scale factors, sent even for unallocated subbands.
+		for (ch = 0; ch < options->channels; ch++) {
+			int previous = 0;
+			for (band = start; band < end; band++) {
+				gen_put_scale(bits, scale_sel[ch], &previous, gen_level(seed, band - start / 2));
+			}
+		}
+
+		for (ch = 0; ch < options->channels; ch++) {
+			for (band = start; band < end; band++) {
+				if (frame->bit_allocation[ch][band] == 1) {
+					for (ssf = 0; ssf < (nsubsubframes + 1) / 2; ssf++) {
+						gen_put(bits, gen_range(seed, 0, 1023), 10);
+					}
+				}
+			}
+		}
+
+		for (ssf = 0; ssf < nsubsubframes; ssf++) {
+			for (ch = 0; ch < options->channels; ch++) {
+				for (band = start; band < end; band++) {
+					if (frame->bit_allocation[ch][band] > 1) {
+						gen_put_samples(bits, seed, quant_sel[ch], frame->bit_allocation[ch][band] - 1);
+					}
+				}
+			}
+			if (ssf == nsubsubframes - 1) {
+				gen_put(bits, 0xffff, 16);
+			}
+		}
+	}
+}
+
+static int gen_bit_rate_index(const GEN_OPTIONS* const options, const int frame_size) {
+	//Nearest transmission bit rate at or above the one of the frame, open rate beyond the table.
+	const int64_t rate = (int64_t)frame_size * 8 * sample_rates[options->rate_index] / (options->npcmblocks * NUM_PCMBLOCK_SAMPLES);
+	int index;
+	for (index = 0; index <= 24; index++) {
+		if (bit_rates[index] >= rate) {
+			return index;
+		}
+	}
+	return 29;
+}
+
+static int gen_frame(GEN_BITS* const bits, unsigned int* const seed, const GEN_OPTIONS* const options) {
+	GEN_FRAME frame;
+	int remaining = options->npcmblocks / NUM_SUBBAND_SAMPLES;
+	int x96_position = 0;
+	int frame_size;
+	int sf;
+
+	//Up to 4 subsubframes of 8 subband samples in each subframe.
+	for (frame.nsubframes = 0; remaining; frame.nsubframes++) {
+		frame.nsubsubframes[frame.nsubframes] = remaining < 4 ? remaining : 4;
+		remaining -= frame.nsubsubframes[frame.nsubframes];
+	}
+
+	memset(bits->data, 0, bits->size);
+	bits->length = 0;
+	bits->cache = 0;
+	bits->cached = 0;
+	bits->overflow = 0;
+
+	gen_frame_header(bits, options);
+	gen_coding_header(bits, seed, options, &frame);
+	for (sf = 0; sf < frame.nsubframes; sf++) {
+		gen_subframe(bits, seed, options, &frame, sf);
+	}
+	gen_align(bits, 4);
+
+	//The X96 frame runs from its 4 byte aligned sync word to the end of the core frame.
+	if (options->x96) {
+		x96_position = bits->length;
+		gen_x96_frame(bits, seed, options, &frame);
+		gen_align(bits, 4);
+		while (bits->length - x96_position < GEN_MIN_FRAME_SIZE) {
+			gen_put(bits, 0, 32);
+		}
+	}
+	while (bits->length < GEN_MIN_FRAME_SIZE) {
+		gen_put(bits, 0, 32);
+	}
+	if (options->frame_size) {
+		if (bits->length > options->frame_size) {
+			fprintf(stderr, "A frame needs %d bytes, more than the frame size of %d\n", bits->length, options->frame_size);
+			return 0;
+		}
+		while (bits->length < options->frame_size) {
+			gen_put(bits, 0, 8);
+		}
+	}
+	frame_size = bits->length;
+
+	if (bits->overflow || frame_size > GEN_MAX_FRAME_SIZE) {
+		fprintf(stderr, "A frame needs more than %d bytes, use fewer blocks, subbands or channels\n", GEN_MAX_FRAME_SIZE);
+		return 0;
+	}
+	if (options->x96) {
+		if (frame_size - x96_position > GEN_MAX_X96_FRAME_SIZE) {
+			fprintf(stderr, "An X96 frame needs more than %d bytes, use fewer blocks or channels\n", GEN_MAX_X96_FRAME_SIZE);
+			return 0;
+		}
+		gen_patch(bits->data, x96_position * 8 + 32, frame_size - x96_position - 1, 12);
+	}
+	gen_patch(bits->data, 46, frame_size - 1, 14);
+	gen_patch(bits->data, 70, gen_bit_rate_index(options, frame_size), 5);
+	return frame_size;
+}
+
+static void gen_usage() {
+	fprintf(stderr,
+		"Usage: dts_gen [options] file\n"
+		"  -c count   primary channels, 1 to 5 (default 2)\n"
+		"  -l flag    LFE: 0 none, 1 for 128x (float synthesis only) or 2 for 64x interpolation (default 0)\n"
+		"  -r rate    core sample rate in Hz (default 48000)\n"
+		"  -b blocks  subband samples per frame, a multiple of 8 up to 128 (default 16)\n"
+		"  -a count   active subbands, 2 to 32 (default 32)\n"
+		"  -v band    first high frequency VQ subband, 1 to 32 (default none)\n"
+		"  -q mode    quantization: huffman, block, linear or mixed (default mixed)\n"
+		"  -p         ADPCM prediction in random subbands\n"
+		"  -x         X96 extension, doubles the sample rate\n"
+		"  -f bytes   pad every frame to this size (default as small as possible)\n"
+		"  -n count   frames (default 1000)\n"
+		"  -s seed    random seed, not 0 (default 1)\n");
+}
+
+static int gen_parse_rate(const int rate) {
+	int index;
+	for (index = 0; index < 16; index++) {
+		if (rate && sample_rates[index] == rate) {
+			return index;
+		}
+	}
+	return -1;
+}
+
+int main(int argc, char** argv) {
+	GEN_OPTIONS options = {
+		.channels = 2,
+		.npcmblocks = 16,
+		.subbands = MAX_SUBBANDS,
+		.vq_start = 0,
+		.quantization = GEN_MIXED,
+		.frames = 1000,
+		.seed = 1
+	};
+	GEN_BITS bits = { 0 };
+	unsigned int seed;
+	FILE* file;
+	int option;
+	int index;
+
+	options.rate_index = gen_parse_rate(48000);
+	while ((option = getopt(argc, argv, "c:l:r:b:a:v:q:pxf:n:s:")) != -1) {
+		switch (option) {
+		case 'c':
+			options.channels = atoi(optarg);
+			break;
+		case 'l':
+			options.lfe = atoi(optarg);
+			break;
+		case 'r':
+			options.rate_index = gen_parse_rate(atoi(optarg));
+			break;
+		case 'b':
+			options.npcmblocks = atoi(optarg);
+			break;
+		case 'a':
+			options.subbands = atoi(optarg);
+			break;
+		case 'v':
+			options.vq_start = atoi(optarg);
+			break;
+		case 'q':
+			if (!strcmp(optarg, "huffman")) {
+				options.quantization = GEN_HUFFMAN;
+			}
+			else if (!strcmp(optarg, "block")) {
+				options.quantization = GEN_BLOCK;
+			}
+			else if (!strcmp(optarg, "linear")) {
+				options.quantization = GEN_LINEAR;
+			}
+			else if (!strcmp(optarg, "mixed")) {
+				options.quantization = GEN_MIXED;
+			}
+			else {
+				options.quantization = 0;
+			}
+			break;
+		case 'p':
+			options.adpcm = 1;
+			break;
+		case 'x':
+			options.x96 = 1;
+			break;
+		case 'f':
+			options.frame_size = atoi(optarg);
+			break;
+		case 'n':
+			options.frames = atoi(optarg);
+			break;
+		case 's':
+			options.seed = (unsigned int)strtoul(optarg, NULL, 0);
+			break;
+		default:
+			gen_usage();
+			return 1;
+		}
+	}
+	if (!options.vq_start || options.vq_start > options.subbands) {
+		options.vq_start = options.subbands;
+	}
+	if (optind != argc - 1 ||
+		options.channels < 1 || options.channels >= (int)dca_countof(gen_audio_modes) ||
+		options.lfe < 0 || options.lfe > 2 ||
+		options.rate_index < 0 ||
+		options.npcmblocks < NUM_SUBBAND_SAMPLES || options.npcmblocks > 128 || options.npcmblocks % NUM_SUBBAND_SAMPLES ||
+		options.subbands < 2 || options.subbands > MAX_SUBBANDS ||
+		options.vq_start < 1 ||
+		!options.quantization ||
+		(options.frame_size && (options.frame_size < GEN_MIN_FRAME_SIZE || options.frame_size > GEN_MAX_FRAME_SIZE || options.frame_size % 4)) ||
+		options.frames < 1 ||
+		!options.seed) {
+		gen_usage();
+		return 1;
+	}
+	options.audio_mode = gen_audio_modes[options.channels];
+	if (options.lfe == 1) {
+		//Valid streams, but the fixed point LFE interpolator of libdcadec only does 64x.
+		fprintf(stderr, "Warning: 128x LFE interpolation is only decoded by the float core synthesis, the stream fails in bit exact mode\n");
+	}
+
+	if (!(file = fopen(argv[optind], "wb"))) {
+		fprintf(stderr, "Cannot create %s\n", argv[optind]);
+		return 1;
+	}
+	//Room past the largest frame so an overflow is detected rather than written.
+	bits.size = GEN_MAX_FRAME_SIZE + 4;
+	bits.data = malloc(bits.size);
+	seed = options.seed;
+	for (index = 0; bits.data && index < options.frames; index++) {
+		const int frame_size = gen_frame(&bits, &seed, &options);
+		if (!frame_size || fwrite(bits.data, 1, frame_size, file) != (size_t)frame_size) {
+			break;
+		}
+	}
+	free(bits.data);
+	if (fclose(file) || index < options.frames) {
+		remove(argv[optind]);
+		return 1;
+	}
+	return 0;
+}
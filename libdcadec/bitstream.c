@@ -19,6 +19,9 @@
 #include "common.h"
 #include "bitstream.h"
 
+// Data doesn't have to be 32-bit aligned
+#define BITS_WORD(bits, pos)    DCA_32BE(DCA_MEM32NE((bits)->data + (pos) * 4))
+
 static inline uint32_t bits_peek(struct bitstream *bits)
 {
     if (bits->index >= bits->total)
@@ -27,10 +30,10 @@ static inline uint32_t bits_peek(struct bitstream *bits)
     int pos = bits->index >> 5;
     int shift = bits->index & 31;
 
-    uint32_t v = DCA_32BE(bits->data[pos]);
+    uint32_t v = BITS_WORD(bits, pos);
     if (shift) {
         v <<= shift;
-        v |= DCA_32BE(bits->data[pos + 1]) >> (32 - shift);
+        v |= BITS_WORD(bits, pos + 1) >> (32 - shift);
     }
 
     return v;
@@ -41,7 +44,7 @@ bool bits_get1(struct bitstream *bits)
     if (bits->index >= bits->total)
         return false;
 
-    uint32_t v = DCA_32BE(bits->data[bits->index >> 5]);
+    uint32_t v = BITS_WORD(bits, bits->index >> 5);
     v <<= bits->index & 31;
     v >>= 32 - 1;
 
@@ -141,7 +144,7 @@ int bits_check_crc(struct bitstream *bits, int p1, int p2)
 {
     if (((p1 | p2) & 7) || p1 < 0 || p2 > bits->total || p2 - p1 < 16)
         return -DCADEC_EBADREAD;
-    if (crc16((uint8_t *)bits->data + p1 / 8, (p2 - p1) / 8))
+    if (crc16(bits->data + p1 / 8, (p2 - p1) / 8))
         return -DCADEC_EBADCRC;
     return 0;
 }
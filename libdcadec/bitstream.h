@@ -25,16 +25,16 @@
 #define BITS_INVALID_VLC_SI -16384
 
 struct bitstream {
-    uint32_t    *data;
+    uint8_t     *data;
     int         total;
     int         index;
 };
 
 static inline void bits_init(struct bitstream *bits, uint8_t *data, int size)
 {
-    assert(data && !((uintptr_t)data & 3));
+    assert(data);
     assert(size > 0 && size < INT_MAX / 8);
-    bits->data = (uint32_t *)data;
+    bits->data = data;
     bits->total = size * 8;
     bits->index = 0;
 }
@@ -176,6 +176,8 @@ void dca_format_log(struct dcadec_context *dca, int level,
 
 #define DCADEC_LOG_ONCE     0x80000000
 
+struct ta_account *dca_get_account(struct dcadec_context *dca, int subsystem);
+
 #define dca_log(obj, lvl, ...) \
     dca_format_log((obj)->ctx, DCADEC_LOG_##lvl, __FILE__, __LINE__, __VA_ARGS__)
 
@@ -310,6 +312,13 @@ static inline int count_chs_for_mask(int mask)
     return dca_popcount(mask) + dca_popcount(mask & SPEAKER_PAIR_ALL_2);
 }
 
+// Bytes to reserve for a buffer of the given parent that may grow to size,
+// nothing if it is that large already
+static inline size_t dca_reserve_size(void *parent, void *buffer, size_t size)
+{
+    return ta_get_size(buffer) < size ? ta_get_arena_block_size(parent, size) : 0;
+}
+
 // Table 7-11: Representation type
 enum RepresentationType {
     REPR_TYPE_LtRt  = 2,
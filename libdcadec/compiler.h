@@ -54,4 +54,20 @@ typedef __int64 off_t;
 # endif
 #endif
 
+#ifndef HAVE_SSE
+# if (defined __SSE__) || (defined _M_X64) || (defined _M_IX86_FP && _M_IX86_FP >= 1)
+#  define HAVE_SSE  1
+# else
+#  define HAVE_SSE  0
+# endif
+#endif
+
+#ifndef HAVE_SSE2
+# if (defined __SSE2__) || (defined _M_X64) || (defined _M_IX86_FP && _M_IX86_FP >= 2)
+#  define HAVE_SSE2 1
+# else
+#  define HAVE_SSE2 0
+# endif
+#endif
+
 #endif
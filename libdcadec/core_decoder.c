@@ -21,6 +21,7 @@
 #include "interpolator.h"
 #include "idct.h"
 #include "fixed_math.h"
+#include "fixed_math_sse2.h"
 #include "core_decoder.h"
 #include "exss_parser.h"
 #include "dmix_tables.h"
@@ -591,20 +592,22 @@ static int parse_subframe_header(struct core_decoder *core, int sf,
 static int parse_block_codes(struct core_decoder *core, int *audio, int abits)
 {
     // Extract the block code indices from the bit stream
-    int code1 = bits_get(&core->bits, block_code_nbits[abits]);
-    int code2 = bits_get(&core->bits, block_code_nbits[abits]);
+    uint32_t code1 = bits_get(&core->bits, block_code_nbits[abits]);
+    uint32_t code2 = bits_get(&core->bits, block_code_nbits[abits]);
+    uint32_t mult = block_code_mult[abits];
     int levels = quant_levels[abits];
     int offset = (levels - 1) / 2;
     int n;
 
-    // Look up samples from the block code book
+    // Look up samples from the block code book. Division by the number of
+    // levels is done by multiplying with the precomputed reciprocal.
     for (n = 0; n < NUM_SUBBAND_SAMPLES / 2; n++) {
-        audio[n] = (code1 % levels) - offset;
-        code1 /= levels;
-    }
-    for (; n < NUM_SUBBAND_SAMPLES; n++) {
-        audio[n] = (code2 % levels) - offset;
-        code2 /= levels;
+        uint32_t quot1 = (uint32_t)(((uint64_t)code1 * mult) >> 32);
+        uint32_t quot2 = (uint32_t)(((uint64_t)code2 * mult) >> 32);
+        audio[n                          ] = (int)(code1 - quot1 * levels) - offset;
+        audio[n + NUM_SUBBAND_SAMPLES / 2] = (int)(code2 - quot2 * levels) - offset;
+        code1 = quot1;
+        code2 = quot2;
     }
 
     if (code1 || code2) {
@@ -656,8 +659,8 @@ static inline int extract_audio(struct core_decoder *core, int *audio, int abits
     return 0;
 }
 
-static inline void dequantize(int *output, const int *input, int step_size,
-                              int scale, bool residual)
+// Combine quantizer step size and scale factor into a single multiplier
+static inline int make_step_scale(int step_size, int scale, int *bits)
 {
     // Account for quantizer step size
     int64_t step_scale = (int64_t)step_size * scale;
@@ -669,14 +672,230 @@ static inline void dequantize(int *output, const int *input, int step_size,
         step_scale >>= shift;
     }
 
-    // Scale the samples
-    if (residual) {
-        for (int n = 0; n < NUM_SUBBAND_SAMPLES; n++)
-            output[n] += clip23(norm__(input[n] * step_scale, 22 - shift));
-    } else {
-        for (int n = 0; n < NUM_SUBBAND_SAMPLES; n++)
-            output[n]  = clip23(norm__(input[n] * step_scale, 22 - shift));
+    // Normalization by zero or less bits is a no-op
+    *bits = DCA_MAX(22 - shift, 0);
+    return (int)step_scale;
+}
+
+// Subband samples are stored time-major, with one block of samples from all
+// subbands per subband sample period. Kernels below work on groups of 4
+// adjacent subbands, samples of inactive subbands in a group are preserved.
+
+#if HAVE_SSE2
+static inline void transpose_epi32(__m128i *r0, __m128i *r1, __m128i *r2, __m128i *r3)
+{
+    __m128i t0 = _mm_unpacklo_epi32(*r0, *r1);
+    __m128i t1 = _mm_unpacklo_epi32(*r2, *r3);
+    __m128i t2 = _mm_unpackhi_epi32(*r0, *r1);
+    __m128i t3 = _mm_unpackhi_epi32(*r2, *r3);
+    *r0 = _mm_unpacklo_epi64(t0, t1);
+    *r1 = _mm_unpackhi_epi64(t0, t1);
+    *r2 = _mm_unpacklo_epi64(t2, t3);
+    *r3 = _mm_unpackhi_epi64(t2, t3);
+}
+
+static inline __m128i blend_epi32(__m128i mask, __m128i a, __m128i b)
+{
+    return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+// Load 4 samples from each of 4 subbands, one vector per subband
+static inline void load_bands_x4(const int *src, int stride, __m128i *v)
+{
+    for (int n = 0; n < 4; n++)
+        v[n] = _mm_loadu_si128((const __m128i *)(src + n * stride));
+    transpose_epi32(&v[0], &v[1], &v[2], &v[3]);
+}
+
+// Store 4 samples to each of 4 subbands enabled in mask, one vector per subband
+static inline void store_bands_x4(int *dst, int stride, __m128i *v, __m128i mask, bool residual)
+{
+    transpose_epi32(&v[0], &v[1], &v[2], &v[3]);
+    for (int n = 0; n < 4; n++) {
+        __m128i x = _mm_loadu_si128((const __m128i *)(dst + n * stride));
+        __m128i y = residual ? _mm_add_epi32(x, v[n]) : v[n];
+        _mm_storeu_si128((__m128i *)(dst + n * stride), blend_epi32(mask, y, x));
+    }
+}
+#endif
+
+// Scale one subband sample period of active subbands in [start, end), each
+// with its own multiplier prepared by make_step_scale()
+static void dequantize(int *output, int stride, int (*input)[NUM_SUBBAND_SAMPLES],
+                       const int *step_scale, const int *bits, const bool *active,
+                       int start, int end, bool residual)
+{
+#if HAVE_SSE2
+    for (int band = start & ~3; band < end; band += 4) {
+        __m128i lo[4], hi[4];
+        int mask[4];
+
+        for (int k = 0; k < 4; k++) {
+            int b = band + k;
+            if (b >= start && b < end && active[b]) {
+                struct coeff_sse2 coeff = coeff_sse2_init(step_scale[b], bits[b]);
+                lo[k] = _mm_loadu_si128((const __m128i *)&input[b][0]);
+                hi[k] = _mm_loadu_si128((const __m128i *)&input[b][4]);
+                lo[k] = clip23_sse2(mul__coeff_sse2(lo[k], &coeff, bits[b]));
+                hi[k] = clip23_sse2(mul__coeff_sse2(hi[k], &coeff, bits[b]));
+                mask[k] = -1;
+            } else {
+                lo[k] = hi[k] = _mm_setzero_si128();
+                mask[k] = 0;
+            }
+        }
+
+        __m128i m = _mm_loadu_si128((const __m128i *)mask);
+        if (_mm_movemask_epi8(m)) {
+            store_bands_x4(output +              band, stride, lo, m, residual);
+            store_bands_x4(output + 4 * stride + band, stride, hi, m, residual);
+        }
     }
+#else
+    for (int band = start; band < end; band++) {
+        if (!active[band])
+            continue;
+
+        int *dst = output + band;
+        if (residual) {
+            for (int n = 0; n < NUM_SUBBAND_SAMPLES; n++)
+                dst[n * stride] += clip23(norm__((int64_t)input[band][n] * step_scale[band], bits[band]));
+        } else {
+            for (int n = 0; n < NUM_SUBBAND_SAMPLES; n++)
+                dst[n * stride]  = clip23(norm__((int64_t)input[band][n] * step_scale[band], bits[band]));
+        }
+    }
+#endif
+}
+
+// Scale VQ encoded high frequency subband samples
+static void scale_vq(int *output, int stride, const int8_t *vq_samples, int scale, int nsamples)
+{
+    for (int n = 0; n < nsamples; n++)
+        output[n * stride] = clip23(mul4(scale, vq_samples[n]));
+}
+
+// Reconstruct joint intensity coded subbands in [start, end) from the
+// source channel
+static void scale_joint(int *output, const int *input, int stride, const int32_t *scale,
+                        int start, int end, int nsamples)
+{
+#if HAVE_SSE2
+    for (int band = start & ~3; band < end; band += 4) {
+        struct coeff_sse2 coeff[4];
+        int mask[4];
+
+        for (int k = 0; k < 4; k++) {
+            int b = band + k;
+            mask[k] = b >= start && b < end ? -1 : 0;
+            coeff[k] = coeff_sse2_init(mask[k] ? scale[b] : 0, 17);
+        }
+
+        __m128i m = _mm_loadu_si128((const __m128i *)mask);
+        for (int n = 0; n < nsamples; n += 4) {
+            __m128i v[4];
+            load_bands_x4(input + n * stride + band, stride, v);
+            for (int k = 0; k < 4; k++)
+                v[k] = clip23_sse2(mul__coeff_sse2(v[k], &coeff[k], 17));
+            store_bands_x4(output + n * stride + band, stride, v, m, false);
+        }
+    }
+#else
+    for (int band = start; band < end; band++)
+        for (int n = 0; n < nsamples; n++)
+            output[n * stride + band] = clip23(mul17(input[n * stride + band], scale[band]));
+#endif
+}
+
+#if HAVE_SSE2
+// Pack low 16 bits of a and b into 16-bit pairs for _mm_madd_epi16()
+static inline __m128i pack_epi16(__m128i a, __m128i b)
+{
+    return _mm_or_si128(_mm_and_si128(a, _mm_set1_epi32(0xffff)), _mm_slli_epi32(b, 16));
+}
+#endif
+
+// Inverse ADPCM for subbands in [start, end) that have prediction
+// coefficients. The recursion is serial within each subband, but adjacent
+// subbands are processed in parallel.
+static void inverse_adpcm(int *samples, int stride, const int16_t **coeffs,
+                          int start, int end, int nsamples)
+{
+#if HAVE_SSE2
+    // Subband samples are always clipped to 24 bits, so each sample is split
+    // into signed high and unsigned low 12-bit halves, which makes the
+    // prediction fit in 16x16-bit multiplies and 32-bit sums. The result is
+    // bit exact with the 64-bit scalar version.
+    static const int16_t zero[NUM_ADPCM_COEFFS];
+    const __m128i lomask = _mm_set1_epi32(0xfff);
+    const __m128i round = _mm_set1_epi32(1 << 12);
+
+    for (int band = start & ~3; band < end; band += 4) {
+        const int16_t *c[4];
+        int mask[4];
+
+        for (int k = 0; k < 4; k++) {
+            int b = band + k;
+            c[k] = b >= start && b < end ? coeffs[b] : NULL;
+            mask[k] = c[k] ? -1 : 0;
+            if (!c[k])
+                c[k] = zero;
+        }
+
+        __m128i m = _mm_loadu_si128((const __m128i *)mask);
+        if (!_mm_movemask_epi8(m))
+            continue;
+
+        __m128i c01 = _mm_set_epi16(c[3][1], c[3][0], c[2][1], c[2][0],
+                                    c[1][1], c[1][0], c[0][1], c[0][0]);
+        __m128i c23 = _mm_set_epi16(c[3][3], c[3][2], c[2][3], c[2][2],
+                                    c[1][3], c[1][2], c[0][3], c[0][2]);
+
+        // Load history
+        int *ptr = samples + band;
+        __m128i x1 = _mm_loadu_si128((const __m128i *)(ptr - 1 * stride));
+        __m128i x2 = _mm_loadu_si128((const __m128i *)(ptr - 2 * stride));
+        __m128i x3 = _mm_loadu_si128((const __m128i *)(ptr - 3 * stride));
+        __m128i x4 = _mm_loadu_si128((const __m128i *)(ptr - 4 * stride));
+
+        __m128i h01 = pack_epi16(_mm_srai_epi32(x1, 12), _mm_srai_epi32(x2, 12));
+        __m128i h23 = pack_epi16(_mm_srai_epi32(x3, 12), _mm_srai_epi32(x4, 12));
+        __m128i l01 = pack_epi16(_mm_and_si128(x1, lomask), _mm_and_si128(x2, lomask));
+        __m128i l23 = pack_epi16(_mm_and_si128(x3, lomask), _mm_and_si128(x4, lomask));
+
+        for (int n = 0; n < nsamples; n++, ptr += stride) {
+            // Prediction error, equal to norm13() of the full product sum
+            __m128i hi = _mm_add_epi32(_mm_madd_epi16(h01, c01), _mm_madd_epi16(h23, c23));
+            __m128i lo = _mm_add_epi32(_mm_madd_epi16(l01, c01), _mm_madd_epi16(l23, c23));
+            __m128i err = _mm_add_epi32(hi, _mm_srai_epi32(_mm_add_epi32(lo, round), 12));
+            err = clip23_sse2(_mm_srai_epi32(err, 1));
+
+            __m128i x = _mm_loadu_si128((const __m128i *)ptr);
+            __m128i y = blend_epi32(m, clip23_sse2(_mm_add_epi32(x, err)), x);
+            _mm_storeu_si128((__m128i *)ptr, y);
+
+            // Shift history
+            h23 = _mm_or_si128(_mm_srli_epi32(h01, 16), _mm_slli_epi32(h23, 16));
+            l23 = _mm_or_si128(_mm_srli_epi32(l01, 16), _mm_slli_epi32(l23, 16));
+            h01 = pack_epi16(_mm_srai_epi32(y, 12), h01);
+            l01 = pack_epi16(_mm_and_si128(y, lomask), l01);
+        }
+    }
+#else
+    for (int band = start; band < end; band++) {
+        const int16_t *vq_coeffs = coeffs[band];
+        if (!vq_coeffs)
+            continue;
+
+        int *ptr = samples + band;
+        for (int m = 0; m < nsamples; m++, ptr += stride) {
+            int64_t err = INT64_C(0);
+            for (int n = 0; n < NUM_ADPCM_COEFFS; n++)
+                err += (int64_t)ptr[-(n + 1) * stride] * vq_coeffs[n];
+            *ptr = clip23(*ptr + clip23(norm13(err)));
+        }
+    }
+#endif
 }
 
 // 5.5 - Primary audio data arrays
@@ -705,9 +924,8 @@ static int parse_subframe_audio(struct core_decoder *core, int sf, enum HeaderTy
             const int8_t *vq_samples = high_freq_samples[vq_index];
 
             // Scale and take the samples
-            int *samples = core->subband_samples[ch][band] + *sub_pos;
-            for (int n = 0; n < nsamples; n++)
-                samples[n] = clip23(mul4(scale, vq_samples[n]));
+            scale_vq(core->subband_samples[ch] + *sub_pos * MAX_SUBBANDS + band,
+                     MAX_SUBBANDS, vq_samples, scale, nsamples);
         }
     }
 
@@ -746,14 +964,17 @@ static int parse_subframe_audio(struct core_decoder *core, int sf, enum HeaderTy
     // Audio data
     for (ssf = 0, ofs = *sub_pos; ssf < core->nsubsubframes[sf]; ssf++) {
         for (ch = xch_base; ch < core->nchannels; ch++) {
+            int audio[MAX_SUBBANDS][NUM_SUBBAND_SAMPLES];
+            int step_scale[MAX_SUBBANDS], bits[MAX_SUBBANDS];
+            bool active[MAX_SUBBANDS];
+
             // Not high frequency VQ subbands
             for (band = 0; band < core->subband_vq_start[ch]; band++) {
                 int abits = core->bit_allocation[ch][band];
-                int audio[NUM_SUBBAND_SAMPLES];
                 int ret, step_size, trans_ssf, scale;
 
                 // Extract bits from the bit stream
-                if ((ret = extract_audio(core, audio, abits, ch)) < 0)
+                if ((ret = extract_audio(core, audio[band], abits, ch)) < 0)
                     return ret;
 
                 // Select quantization step size table
@@ -779,9 +1000,12 @@ static int parse_subframe_audio(struct core_decoder *core, int sf, enum HeaderTy
                     scale = clip23((adj * scale) >> 22);
                 }
 
-                dequantize(core->subband_samples[ch][band] + ofs,
-                           audio, step_size, scale, false);
+                step_scale[band] = make_step_scale(step_size, scale, &bits[band]);
+                active[band] = true;
             }
+
+            dequantize(core->subband_samples[ch] + ofs * MAX_SUBBANDS, MAX_SUBBANDS,
+                       audio, step_scale, bits, active, 0, core->subband_vq_start[ch], false);
         }
 
         // DSYNC
@@ -796,24 +1020,23 @@ static int parse_subframe_audio(struct core_decoder *core, int sf, enum HeaderTy
 
     // Inverse ADPCM
     for (ch = xch_base; ch < core->nchannels; ch++) {
+        const int16_t *vq_coeffs[MAX_SUBBANDS];
+
         for (band = 0; band < core->nsubbands[ch]; band++) {
             // Only if prediction mode is on
             if (core->prediction_mode[ch][band]) {
-                int *samples = core->subband_samples[ch][band] + *sub_pos;
-
                 // Extract the VQ index
                 int vq_index = core->prediction_vq_index[ch][band];
 
                 // Look up the VQ table for prediction coefficients
-                const int16_t *vq_coeffs = adpcm_coeffs[vq_index];
-                for (int m = 0; m < nsamples; m++) {
-                    int64_t err = INT64_C(0);
-                    for (int n = 0; n < NUM_ADPCM_COEFFS; n++)
-                        err += (int64_t)samples[m - n - 1] * vq_coeffs[n];
-                    samples[m] = clip23(samples[m] + clip23(norm13(err)));
-                }
+                vq_coeffs[band] = adpcm_coeffs[vq_index];
+            } else {
+                vq_coeffs[band] = NULL;
             }
         }
+
+        inverse_adpcm(core->subband_samples[ch] + *sub_pos * MAX_SUBBANDS, MAX_SUBBANDS, vq_coeffs,
+                      0, core->nsubbands[ch], nsamples);
     }
 
     // Joint subband coding
@@ -822,13 +1045,10 @@ static int parse_subframe_audio(struct core_decoder *core, int sf, enum HeaderTy
         if (core->joint_intensity_index[ch]) {
             // Get source channel
             int src_ch = core->joint_intensity_index[ch] - 1;
-            for (band = core->nsubbands[ch]; band < core->nsubbands[src_ch]; band++) {
-                int *src = core->subband_samples[src_ch][band] + *sub_pos;
-                int *dst = core->subband_samples[    ch][band] + *sub_pos;
-                int scale = core->joint_scale_factors[ch][band];
-                for (int n = 0; n < nsamples; n++)
-                    dst[n] = clip23(mul17(src[n], scale));
-            }
+            int *src = core->subband_samples[src_ch] + *sub_pos * MAX_SUBBANDS;
+            int *dst = core->subband_samples[    ch] + *sub_pos * MAX_SUBBANDS;
+            scale_joint(dst, src, MAX_SUBBANDS, core->joint_scale_factors[ch],
+                        core->nsubbands[ch], core->nsubbands[src_ch], nsamples);
         }
     }
 
@@ -842,8 +1062,8 @@ static void erase_adpcm_history(struct core_decoder *core)
     // Erase ADPCM history from previous frame if
     // predictor history switch was disabled
     for (int ch = 0; ch < MAX_CHANNELS; ch++)
-        for (int band = 0; band < MAX_SUBBANDS; band++)
-            memset(core->subband_samples[ch][band] - NUM_ADPCM_COEFFS, 0, NUM_ADPCM_COEFFS * sizeof(int));
+        memset(core->subband_samples[ch] - NUM_ADPCM_COEFFS * MAX_SUBBANDS, 0,
+               NUM_ADPCM_COEFFS * MAX_SUBBANDS * sizeof(int));
 }
 
 static int alloc_sample_buffer(struct core_decoder *core)
@@ -858,12 +1078,23 @@ static int alloc_sample_buffer(struct core_decoder *core)
         return -DCADEC_ENOMEM;
     if (ret > 0) {
         for (int ch = 0; ch < MAX_CHANNELS; ch++)
-            for (int band = 0; band < MAX_SUBBANDS; band++)
-                core->subband_samples[ch][band] = core->subband_buffer +
-                    (ch * MAX_SUBBANDS + band) * nchsamples + NUM_ADPCM_COEFFS;
+            core->subband_samples[ch] = core->subband_buffer +
+                (ch * nchsamples + NUM_ADPCM_COEFFS) * MAX_SUBBANDS;
         core->lfe_samples = core->subband_buffer + nframesamples;
     }
 
+    // Bring back the history saved by core_trim()
+    if (core->subband_history) {
+        for (int ch = 0; ch < MAX_CHANNELS; ch++)
+            memcpy(core->subband_samples[ch] - NUM_ADPCM_COEFFS * MAX_SUBBANDS,
+                   core->subband_history + ch * NUM_ADPCM_COEFFS * MAX_SUBBANDS,
+                   NUM_ADPCM_COEFFS * MAX_SUBBANDS * sizeof(int));
+        memcpy(core->lfe_samples, core->subband_history + MAX_CHANNELS * NUM_ADPCM_COEFFS * MAX_SUBBANDS,
+               MAX_LFE_HISTORY * sizeof(int));
+        ta_free(core->subband_history);
+        core->subband_history = NULL;
+    }
+
     if (!core->predictor_history)
         erase_adpcm_history(core);
 
@@ -892,16 +1123,13 @@ static int parse_frame_data(struct core_decoder *core, enum HeaderType header, i
             nsubbands = DCA_MAX(nsubbands, core->nsubbands[core->joint_intensity_index[ch] - 1]);
 
         // Update history for ADPCM
-        for (int band = 0; band < nsubbands; band++) {
-            int *samples = core->subband_samples[ch][band] - NUM_ADPCM_COEFFS;
-            memcpy(samples, samples + core->npcmblocks, NUM_ADPCM_COEFFS * sizeof(int));
-        }
+        int *samples = core->subband_samples[ch] - NUM_ADPCM_COEFFS * MAX_SUBBANDS;
+        memcpy(samples, samples + core->npcmblocks * MAX_SUBBANDS,
+               NUM_ADPCM_COEFFS * MAX_SUBBANDS * sizeof(int));
 
         // Clear inactive subbands
-        for (int band = nsubbands; band < MAX_SUBBANDS; band++) {
-            int *samples = core->subband_samples[ch][band] - NUM_ADPCM_COEFFS;
-            memset(samples, 0, (NUM_ADPCM_COEFFS + core->npcmblocks) * sizeof(int));
-        }
+        for (int n = 0; n < NUM_ADPCM_COEFFS + core->npcmblocks; n++, samples += MAX_SUBBANDS)
+            memset(samples + nsubbands, 0, (MAX_SUBBANDS - nsubbands) * sizeof(int));
     }
 
     return 0;
@@ -978,7 +1206,7 @@ int core_filter(struct core_decoder *core, int flags)
     // Handle change of certain filtering parameters
     int diff = core->filter_flags ^ flags;
 
-    if (diff & (DCADEC_FLAG_CORE_BIT_EXACT | DCADEC_FLAG_CORE_SYNTH_X96)) {
+    if (diff & (DCADEC_FLAG_CORE_BIT_EXACT | DCADEC_FLAG_CORE_SYNTH_X96 | DCADEC_FLAG_CORE_FLOAT32)) {
         for (int ch = 0; ch < MAX_CHANNELS; ch++) {
             ta_free(core->subband_dsp[ch]);
             core->subband_dsp[ch] = NULL;
@@ -993,8 +1221,12 @@ int core_filter(struct core_decoder *core, int flags)
 
     core->filter_flags = flags;
 
-    if (!core->subband_dsp_idct[synth_x96] && !(core->subband_dsp_idct[synth_x96] = idct_init(core, 5 + synth_x96, 0.25)))
-        return -DCADEC_ENOMEM;
+    if (!core->subband_dsp_idct[synth_x96]) {
+        if (!(core->subband_dsp_idct[synth_x96] = idct_init(core, 5 + synth_x96, 0.25)))
+            return -DCADEC_ENOMEM;
+        // Interpolators and their histories are allocated below the IDCT
+        ta_set_account(core->subband_dsp_idct[synth_x96], dca_get_account(core->ctx, DCADEC_MEM_INTERPOLATOR));
+    }
 
     // Filter primary channels
     for (int ch = 0; ch < core->nchannels; ch++) {
@@ -1008,7 +1240,7 @@ int core_filter(struct core_decoder *core, int flags)
             return -DCADEC_EINVAL;
 
         // Get the pointer to high frequency subbands for this channel, if present
-        int **subband_samples_hi;
+        int *subband_samples_hi;
         if (ch < x96_nchannels)
             subband_samples_hi = core->x96_subband_samples[ch];
         else
@@ -1037,6 +1269,11 @@ int core_filter(struct core_decoder *core, int flags)
             interpolate = interpolate_lfe_fixed_fir;
         } else if (flags & DCADEC_FLAG_CORE_LFE_IIR) {
             interpolate = interpolate_lfe_float_iir;
+        } else if (flags & DCADEC_FLAG_CORE_FLOAT32) {
+            if (dec_select)
+                interpolate = interpolate_lfe_float32_fir_2x;
+            else
+                interpolate = interpolate_lfe_float32_fir;
         } else if (dec_select) {
             interpolate = interpolate_lfe_float_fir_2x;
         } else {
@@ -1326,21 +1563,25 @@ static int parse_xbr_subframe(struct core_decoder *core, int xbr_base_ch, int xb
     // Audio data
     for (ssf = 0, ofs = *sub_pos; ssf < core->nsubsubframes[sf]; ssf++) {
         for (ch = xbr_base_ch; ch < xbr_nchannels; ch++) {
+            int audio[MAX_SUBBANDS][NUM_SUBBAND_SAMPLES];
+            int step_scale[MAX_SUBBANDS], bits[MAX_SUBBANDS];
+            bool active[MAX_SUBBANDS];
+
             for (band = 0; band < xbr_nsubbands[ch]; band++) {
                 int abits = xbr_bit_allocation[ch][band];
-                int audio[NUM_SUBBAND_SAMPLES];
                 int ret, step_size, trans_ssf, scale;
 
                 // Extract bits from the bit stream
                 if (abits > 7) {
                     // No further encoding
-                    bits_get_signed_array(&core->bits, audio, NUM_SUBBAND_SAMPLES, abits - 3);
+                    bits_get_signed_array(&core->bits, audio[band], NUM_SUBBAND_SAMPLES, abits - 3);
                 } else if (abits > 0) {
                     // Block codes
-                    if ((ret = parse_block_codes(core, audio, abits)) < 0)
+                    if ((ret = parse_block_codes(core, audio[band], abits)) < 0)
                         return ret;
                 } else {
                     // No bits allocated
+                    active[band] = false;
                     continue;
                 }
 
@@ -1359,9 +1600,12 @@ static int parse_xbr_subframe(struct core_decoder *core, int xbr_base_ch, int xb
                 else
                     scale = xbr_scale_factors[ch][band][1];
 
-                dequantize(core->subband_samples[ch][band] + ofs,
-                           audio, step_size, scale, true);
+                step_scale[band] = make_step_scale(step_size, scale, &bits[band]);
+                active[band] = true;
             }
+
+            dequantize(core->subband_samples[ch] + ofs * MAX_SUBBANDS, MAX_SUBBANDS,
+                       audio, step_scale, bits, active, 0, xbr_nsubbands[ch], true);
         }
 
         // DSYNC
@@ -1484,7 +1728,7 @@ static int parse_x96_subframe_audio(struct core_decoder *core, int sf, int xch_b
     for (ch = xch_base; ch < core->x96_nchannels; ch++) {
         for (band = core->x96_subband_start; band < core->nsubbands[ch]; band++) {
             // Get the sample pointer
-            int *samples = core->x96_subband_samples[ch][band] + *sub_pos;
+            int *samples = core->x96_subband_samples[ch] + *sub_pos * MAX_SUBBANDS_X96 + band;
 
             // Get the scale factor
             int scale = core->x96_scale_factors[ch][band];
@@ -1492,11 +1736,12 @@ static int parse_x96_subframe_audio(struct core_decoder *core, int sf, int xch_b
             int abits = core->bit_allocation[ch][band];
             if (abits == 0) {   // No bits allocated for subband
                 if (scale <= 1) {
-                    memset(samples, 0, nsamples * sizeof(int));
+                    for (int n = 0; n < nsamples; n++)
+                        samples[n * MAX_SUBBANDS_X96] = 0;
                 } else {
                     // Generate scaled random samples as required by specification
                     for (int n = 0; n < nsamples; n++)
-                        samples[n] = mul31(rand_x96(core), scale);
+                        samples[n * MAX_SUBBANDS_X96] = mul31(rand_x96(core), scale);
                 }
             } else if (abits == 1) {    // VQ encoded subband
                 for (ssf = 0; ssf < (core->nsubsubframes[sf] + 1) / 2; ssf++) {
@@ -1510,8 +1755,8 @@ static int parse_x96_subframe_audio(struct core_decoder *core, int sf, int xch_b
                     int vq_nsamples = DCA_MIN(nsamples - ssf * 16, 16);
 
                     // Scale and take the samples
-                    for (int n = 0; n < vq_nsamples; n++)
-                        *samples++ = clip23(mul4(scale, vq_samples[n]));
+                    scale_vq(samples, MAX_SUBBANDS_X96, vq_samples, scale, vq_nsamples);
+                    samples += vq_nsamples * MAX_SUBBANDS_X96;
                 }
             }
         }
@@ -1520,17 +1765,22 @@ static int parse_x96_subframe_audio(struct core_decoder *core, int sf, int xch_b
     // Audio data
     for (ssf = 0, ofs = *sub_pos; ssf < core->nsubsubframes[sf]; ssf++) {
         for (ch = xch_base; ch < core->x96_nchannels; ch++) {
+            int audio[MAX_SUBBANDS_X96][NUM_SUBBAND_SAMPLES];
+            int step_scale[MAX_SUBBANDS_X96], bits[MAX_SUBBANDS_X96];
+            bool active[MAX_SUBBANDS_X96];
+
             for (band = core->x96_subband_start; band < core->nsubbands[ch]; band++) {
                 int abits = core->bit_allocation[ch][band] - 1;
-                int audio[NUM_SUBBAND_SAMPLES];
                 int ret, step_size, scale;
 
                 // Not VQ encoded or unallocated subbands
-                if (abits < 1)
+                if (abits < 1) {
+                    active[band] = false;
                     continue;
+                }
 
                 // Extract bits from the bit stream
-                if ((ret = extract_audio(core, audio, abits, ch)) < 0)
+                if ((ret = extract_audio(core, audio[band], abits, ch)) < 0)
                     return ret;
 
                 // Select quantization step size table
@@ -1543,9 +1793,12 @@ static int parse_x96_subframe_audio(struct core_decoder *core, int sf, int xch_b
                 // Determine proper scale factor
                 scale = core->x96_scale_factors[ch][band];
 
-                dequantize(core->x96_subband_samples[ch][band] + ofs,
-                           audio, step_size, scale, false);
+                step_scale[band] = make_step_scale(step_size, scale, &bits[band]);
+                active[band] = true;
             }
+
+            dequantize(core->x96_subband_samples[ch] + ofs * MAX_SUBBANDS_X96, MAX_SUBBANDS_X96,
+                       audio, step_scale, bits, active, core->x96_subband_start, core->nsubbands[ch], false);
         }
 
         // DSYNC
@@ -1560,24 +1813,23 @@ static int parse_x96_subframe_audio(struct core_decoder *core, int sf, int xch_b
 
     // Inverse ADPCM
     for (ch = xch_base; ch < core->x96_nchannels; ch++) {
+        const int16_t *vq_coeffs[MAX_SUBBANDS_X96];
+
         for (band = core->x96_subband_start; band < core->nsubbands[ch]; band++) {
             // Only if prediction mode is on
             if (core->prediction_mode[ch][band]) {
-                int *samples = core->x96_subband_samples[ch][band] + *sub_pos;
-
                 // Extract the VQ index
                 int vq_index = core->prediction_vq_index[ch][band];
 
                 // Look up the VQ table for prediction coefficients
-                const int16_t *vq_coeffs = adpcm_coeffs[vq_index];
-                for (int m = 0; m < nsamples; m++) {
-                    int64_t err = INT64_C(0);
-                    for (int n = 0; n < NUM_ADPCM_COEFFS; n++)
-                        err += (int64_t)samples[m - n - 1] * vq_coeffs[n];
-                    samples[m] = clip23(samples[m] + clip23(norm13(err)));
-                }
+                vq_coeffs[band] = adpcm_coeffs[vq_index];
+            } else {
+                vq_coeffs[band] = NULL;
             }
         }
+
+        inverse_adpcm(core->x96_subband_samples[ch] + *sub_pos * MAX_SUBBANDS_X96, MAX_SUBBANDS_X96, vq_coeffs,
+                      core->x96_subband_start, core->nsubbands[ch], nsamples);
     }
 
     // Joint subband coding
@@ -1586,13 +1838,10 @@ static int parse_x96_subframe_audio(struct core_decoder *core, int sf, int xch_b
         if (core->joint_intensity_index[ch]) {
             // Get source channel
             int src_ch = core->joint_intensity_index[ch] - 1;
-            for (band = core->nsubbands[ch]; band < core->nsubbands[src_ch]; band++) {
-                int *src = core->x96_subband_samples[src_ch][band] + *sub_pos;
-                int *dst = core->x96_subband_samples[    ch][band] + *sub_pos;
-                int scale = core->joint_scale_factors[ch][band];
-                for (int n = 0; n < nsamples; n++)
-                    dst[n] = clip23(mul17(src[n], scale));
-            }
+            int *src = core->x96_subband_samples[src_ch] + *sub_pos * MAX_SUBBANDS_X96;
+            int *dst = core->x96_subband_samples[    ch] + *sub_pos * MAX_SUBBANDS_X96;
+            scale_joint(dst, src, MAX_SUBBANDS_X96, core->joint_scale_factors[ch],
+                        core->nsubbands[ch], core->nsubbands[src_ch], nsamples);
         }
     }
 
@@ -1606,8 +1855,8 @@ static void erase_x96_adpcm_history(struct core_decoder *core)
     // Erase ADPCM history from previous frame if
     // predictor history switch was disabled
     for (int ch = 0; ch < MAX_CHANNELS; ch++)
-        for (int band = 0; band < MAX_SUBBANDS_X96; band++)
-            memset(core->x96_subband_samples[ch][band] - NUM_ADPCM_COEFFS, 0, NUM_ADPCM_COEFFS * sizeof(int));
+        memset(core->x96_subband_samples[ch] - NUM_ADPCM_COEFFS * MAX_SUBBANDS_X96, 0,
+               NUM_ADPCM_COEFFS * MAX_SUBBANDS_X96 * sizeof(int));
 }
 
 static int alloc_x96_sample_buffer(struct core_decoder *core)
@@ -1621,9 +1870,18 @@ static int alloc_x96_sample_buffer(struct core_decoder *core)
         return -DCADEC_ENOMEM;
     if (ret > 0) {
         for (int ch = 0; ch < MAX_CHANNELS; ch++)
-            for (int band = 0; band < MAX_SUBBANDS_X96; band++)
-                core->x96_subband_samples[ch][band] = core->x96_subband_buffer +
-                    (ch * MAX_SUBBANDS_X96 + band) * nchsamples + NUM_ADPCM_COEFFS;
+            core->x96_subband_samples[ch] = core->x96_subband_buffer +
+                (ch * nchsamples + NUM_ADPCM_COEFFS) * MAX_SUBBANDS_X96;
+    }
+
+    // Bring back the history saved by core_trim()
+    if (core->x96_subband_history) {
+        for (int ch = 0; ch < MAX_CHANNELS; ch++)
+            memcpy(core->x96_subband_samples[ch] - NUM_ADPCM_COEFFS * MAX_SUBBANDS_X96,
+                   core->x96_subband_history + ch * NUM_ADPCM_COEFFS * MAX_SUBBANDS_X96,
+                   NUM_ADPCM_COEFFS * MAX_SUBBANDS_X96 * sizeof(int));
+        ta_free(core->x96_subband_history);
+        core->x96_subband_history = NULL;
     }
 
     if (!core->predictor_history)
@@ -1839,13 +2097,18 @@ static int parse_x96_frame_data(struct core_decoder *core, bool exss, int xch_ba
             nsubbands = DCA_MAX(nsubbands, core->nsubbands[core->joint_intensity_index[ch] - 1]);
 
         // Update history for ADPCM
+        int *samples = core->x96_subband_samples[ch] - NUM_ADPCM_COEFFS * MAX_SUBBANDS_X96;
+        memcpy(samples, samples + core->npcmblocks * MAX_SUBBANDS_X96,
+               NUM_ADPCM_COEFFS * MAX_SUBBANDS_X96 * sizeof(int));
+
         // Clear inactive subbands
-        for (int band = 0; band < MAX_SUBBANDS_X96; band++) {
-            int *samples = core->x96_subband_samples[ch][band] - NUM_ADPCM_COEFFS;
-            if (band >= core->x96_subband_start && band < nsubbands)
-                memcpy(samples, samples + core->npcmblocks, NUM_ADPCM_COEFFS * sizeof(int));
+        int start = core->x96_subband_start;
+        for (int n = 0; n < NUM_ADPCM_COEFFS + core->npcmblocks; n++, samples += MAX_SUBBANDS_X96) {
+            memset(samples, 0, start * sizeof(int));
+            if (nsubbands > start)
+                memset(samples + nsubbands, 0, (MAX_SUBBANDS_X96 - nsubbands) * sizeof(int));
             else
-                memset(samples, 0, (NUM_ADPCM_COEFFS + core->npcmblocks) * sizeof(int));
+                memset(samples + start, 0, (MAX_SUBBANDS_X96 - start) * sizeof(int));
         }
     }
 
@@ -2072,7 +2335,7 @@ static int parse_optional_info(struct core_decoder *core, int flags)
             // 96 bytes. AMODE and PCHS are further checked to reduce
             // probability of alias sync detection.
             for (; sync_pos >= last_pos; sync_pos--) {
-                if (core->bits.data[sync_pos] == DCA_32BE_C(SYNC_WORD_XCH)) {
+                if (DCA_MEM32NE(core->bits.data + sync_pos * 4) == DCA_32BE_C(SYNC_WORD_XCH)) {
                     core->bits.index = (sync_pos + 1) * 32;
                     int frame_size = bits_get(&core->bits, 10) + 1;
                     int dist = core->frame_size - sync_pos * 4;
@@ -2093,7 +2356,7 @@ static int parse_optional_info(struct core_decoder *core, int flags)
             // must be equal to X96 frame size. Minimum X96 frame size is 96
             // bytes.
             for (; sync_pos >= last_pos; sync_pos--) {
-                if (core->bits.data[sync_pos] == DCA_32BE_C(SYNC_WORD_X96)) {
+                if (DCA_MEM32NE(core->bits.data + sync_pos * 4) == DCA_32BE_C(SYNC_WORD_X96)) {
                     core->bits.index = (sync_pos + 1) * 32;
                     int frame_size = bits_get(&core->bits, 12) + 1;
                     int dist = core->frame_size - sync_pos * 4;
@@ -2114,7 +2377,7 @@ static int parse_optional_info(struct core_decoder *core, int flags)
             // XXCH frame header CRC must be valid. Minimum XXCH frame header
             // size is 11 bytes.
             for (; sync_pos >= last_pos; sync_pos--) {
-                if (core->bits.data[sync_pos] == DCA_32BE_C(SYNC_WORD_XXCH)) {
+                if (DCA_MEM32NE(core->bits.data + sync_pos * 4) == DCA_32BE_C(SYNC_WORD_XXCH)) {
                     core->bits.index = (sync_pos + 1) * 32;
                     int hdr_size = bits_get(&core->bits, 6) + 1;
                     if (hdr_size >= 11 &&
@@ -2251,6 +2514,50 @@ int core_parse_exss(struct core_decoder *core, uint8_t *data,
     return status;
 }
 
+// Parse the frame header only. Core extensions are taken from the header
+// flags, their sync words are not searched for and (X)XCH channel set
+// headers are not parsed.
+int core_probe(struct core_decoder *core, uint8_t *data, int size,
+               struct exss_asset *asset)
+{
+    if (asset) {
+        bits_init(&core->bits, data + asset->core_offset, asset->core_size);
+        if (bits_get(&core->bits, 32) != SYNC_WORD_CORE_EXSS)
+            return -DCADEC_ENOSYNC;
+    } else {
+        bits_init(&core->bits, data, size);
+        bits_skip(&core->bits, 32);
+    }
+
+    int ret;
+    if ((ret = parse_frame_header(core)) < 0)
+        return ret;
+
+    core->nchannels = audio_mode_nch[core->audio_mode];
+    core->ch_mask = audio_mode_ch_mask[core->audio_mode];
+    if (core->lfe_present)
+        core->ch_mask |= SPEAKER_MASK_LFE1;
+
+    core->ext_audio_mask = 0;
+    if (!asset && core->ext_audio_present) {
+        switch (core->ext_audio_type) {
+        case EXT_AUDIO_XCH:
+            core->ext_audio_mask = CSS_XCH;
+            core->nchannels++;
+            core->ch_mask |= SPEAKER_MASK_Cs;
+            break;
+        case EXT_AUDIO_X96:
+            core->ext_audio_mask = CSS_X96;
+            break;
+        case EXT_AUDIO_XXCH:
+            core->ext_audio_mask = CSS_XXCH;
+            break;
+        }
+    }
+
+    return 0;
+}
+
 void core_clear(struct core_decoder *core)
 {
     if (core) {
@@ -2260,17 +2567,107 @@ void core_clear(struct core_decoder *core)
         }
         if (core->x96_subband_buffer)
             erase_x96_adpcm_history(core);
+        // Trimmed buffers come back zeroed
+        ta_free(core->subband_history);
+        core->subband_history = NULL;
+        ta_free(core->x96_subband_history);
+        core->x96_subband_history = NULL;
         for (int ch = 0; ch < MAX_CHANNELS; ch++)
             interpolator_clear(core->subband_dsp[ch]);
         core->output_history_lfe = 0;
+        core->x96_rand = 1;
     }
 }
 
-struct dcadec_core_info *core_get_info(struct core_decoder *core)
+static void trim_sample_buffer(struct core_decoder *core)
 {
-    struct dcadec_core_info *info = ta_znew(NULL, struct dcadec_core_info);
-    if (!info)
-        return NULL;
+    // Keep the ADPCM history and the LFE history, the rest of the subband
+    // buffer is filled by every frame
+    int nhistory = MAX_CHANNELS * NUM_ADPCM_COEFFS * MAX_SUBBANDS;
+    if (!core->subband_buffer)
+        return;
+    if (!(core->subband_history = ta_new_array(core, int, nhistory + MAX_LFE_HISTORY)))
+        return;
+
+    for (int ch = 0; ch < MAX_CHANNELS; ch++) {
+        memcpy(core->subband_history + ch * NUM_ADPCM_COEFFS * MAX_SUBBANDS,
+               core->subband_samples[ch] - NUM_ADPCM_COEFFS * MAX_SUBBANDS,
+               NUM_ADPCM_COEFFS * MAX_SUBBANDS * sizeof(int));
+        core->subband_samples[ch] = NULL;
+    }
+    memcpy(core->subband_history + nhistory, core->lfe_samples, MAX_LFE_HISTORY * sizeof(int));
+    core->lfe_samples = NULL;
+
+    ta_free(core->subband_buffer);
+    core->subband_buffer = NULL;
+}
+
+static void trim_x96_sample_buffer(struct core_decoder *core)
+{
+    int nhistory = MAX_CHANNELS * NUM_ADPCM_COEFFS * MAX_SUBBANDS_X96;
+    if (!core->x96_subband_buffer)
+        return;
+    if (!(core->x96_subband_history = ta_new_array(core, int, nhistory)))
+        return;
+
+    for (int ch = 0; ch < MAX_CHANNELS; ch++) {
+        memcpy(core->x96_subband_history + ch * NUM_ADPCM_COEFFS * MAX_SUBBANDS_X96,
+               core->x96_subband_samples[ch] - NUM_ADPCM_COEFFS * MAX_SUBBANDS_X96,
+               NUM_ADPCM_COEFFS * MAX_SUBBANDS_X96 * sizeof(int));
+        core->x96_subband_samples[ch] = NULL;
+    }
+
+    ta_free(core->x96_subband_buffer);
+    core->x96_subband_buffer = NULL;
+}
+
+void core_trim(struct core_decoder *core)
+{
+    // Subband buffers shrink to the ADPCM and LFE history, the output buffer
+    // is filled from scratch by every frame
+    if (core) {
+        ta_free(core->output_buffer);
+        core->output_buffer = NULL;
+        memset(core->output_samples, 0, sizeof(core->output_samples));
+        trim_sample_buffer(core);
+        trim_x96_sample_buffer(core);
+    }
+}
+
+size_t core_get_reserve_size(struct core_decoder *core, int ext_mask, bool synth_x96)
+{
+    // X96 subbands come with the extension announced by the core header or
+    // the asset, X96 synthesis also with a lossless residual at 96 kHz
+    bool x96 = (core->ext_audio_mask | ext_mask) & (CSS_X96 | EXSS_X96);
+    synth_x96 |= x96;
+
+    size_t nchsamples = NUM_ADPCM_COEFFS + core->npcmblocks;
+    size_t nlfesamples = MAX_LFE_HISTORY + core->npcmblocks / 2;
+    size_t npcmsamples = (core->npcmblocks * NUM_PCMBLOCK_SAMPLES) << synth_x96;
+    size_t size = 0;
+
+    size += dca_reserve_size(core, core->subband_buffer,
+                             (nchsamples * MAX_CHANNELS * MAX_SUBBANDS + nlfesamples) * sizeof(int));
+    if (x96)
+        size += dca_reserve_size(core, core->x96_subband_buffer,
+                                 nchsamples * MAX_CHANNELS * MAX_SUBBANDS_X96 * sizeof(int));
+    size += dca_reserve_size(core, core->output_buffer,
+                             npcmsamples * dca_popcount(core->ch_mask) * sizeof(int));
+
+    // Interpolators are created again when the synthesis switches to X96,
+    // their history is largest with the double precision one
+    if (synth_x96 && !(core->filter_flags & DCADEC_FLAG_CORE_SYNTH_X96)) {
+        size += ta_get_arena_block_size(core, sizeof(struct idct_context));
+        size += core->nchannels * (ta_get_arena_block_size(core, sizeof(struct interpolator)) +
+                                   ta_get_arena_block_size(core, 1024 * sizeof(double)));
+    }
+
+    return size;
+}
+
+void core_fill_info(struct core_decoder *core, struct dcadec_core_info *info)
+{
+    memset(info, 0, sizeof(*info));
     info->nchannels = audio_mode_nch[core->audio_mode];
     info->audio_mode = core->audio_mode;
     info->lfe_present = core->lfe_present;
@@ -2281,6 +2678,13 @@ struct dcadec_core_info *core_get_info(struct core_decoder *core)
     info->npcmblocks = core->npcmblocks;
     info->ext_audio_present = core->ext_audio_present;
     info->ext_audio_type = core->ext_audio_type;
+}
+
+struct dcadec_core_info *core_get_info(struct core_decoder *core)
+{
+    struct dcadec_core_info *info = ta_znew(NULL, struct dcadec_core_info);
+    if (info)
+        core_fill_info(core, info);
     return info;
 }
 
@@ -2310,12 +2714,9 @@ static int make_spkr_pair_mask(int mask1)
     return mask2;
 }
 
-struct dcadec_exss_info *core_get_info_exss(struct core_decoder *core)
+void core_fill_info_exss(struct core_decoder *core, struct dcadec_exss_info *info)
 {
-    struct dcadec_exss_info *info = ta_znew(NULL, struct dcadec_exss_info);
-    if (!info)
-        return NULL;
-
+    memset(info, 0, sizeof(*info));
     info->nchannels = core->nchannels + !!core->lfe_present;
     info->sample_rate = core->sample_rate << !!(core->ext_audio_mask & CSS_X96);
     info->bits_per_sample = core->source_pcm_res;
@@ -2332,6 +2733,12 @@ struct dcadec_exss_info *core_get_info_exss(struct core_decoder *core)
 
     if (core->audio_mode == AMODE_STEREO_TOTAL)
         info->matrix_encoding = DCADEC_MATRIX_ENCODING_SURROUND;
+}
 
+struct dcadec_exss_info *core_get_info_exss(struct core_decoder *core)
+{
+    struct dcadec_exss_info *info = ta_znew(NULL, struct dcadec_exss_info);
+    if (info)
+        core_fill_info_exss(core, info);
     return info;
 }
@@ -130,11 +130,13 @@ struct core_decoder {
     int     x96_pos;            ///< Bit position of X96 frame in core substream
 
     int     *x96_subband_buffer;    ///< X96 subband sample buffer base
-    int     *x96_subband_samples[MAX_CHANNELS][MAX_SUBBANDS_X96];   ///< X96 subband samples
+    int     *x96_subband_samples[MAX_CHANNELS];     ///< X96 subband samples, MAX_SUBBANDS_X96 per block
+    int     *x96_subband_history;   ///< X96 ADPCM history while the buffer is trimmed
 
     // Core subband buffer and filter banks
     int                 *subband_buffer;    ///< Subband sample buffer base
-    int                 *subband_samples[MAX_CHANNELS][MAX_SUBBANDS];   ///< Subband samples
+    int                 *subband_samples[MAX_CHANNELS]; ///< Subband samples, MAX_SUBBANDS per block
+    int                 *subband_history;   ///< ADPCM and LFE history while the buffer is trimmed
     struct interpolator *subband_dsp[MAX_CHANNELS]; ///< Filter banks
     struct idct_context *subband_dsp_idct[2];       ///< IDCT context
     int                 *lfe_samples;   ///< Buffer for decimated LFE samples
@@ -156,6 +158,12 @@ int core_parse_exss(struct core_decoder *core, uint8_t *data,
                     int flags, struct exss_asset *asset);
 int core_filter(struct core_decoder *core, int flags);
 void core_clear(struct core_decoder *core) __attribute__((cold));
+void core_trim(struct core_decoder *core) __attribute__((cold));
+size_t core_get_reserve_size(struct core_decoder *core, int ext_mask, bool synth_x96) __attribute__((cold));
+int core_probe(struct core_decoder *core, uint8_t *data, int size,
+               struct exss_asset *asset) __attribute__((cold));
+void core_fill_info(struct core_decoder *core, struct dcadec_core_info *info) __attribute__((cold));
+void core_fill_info_exss(struct core_decoder *core, struct dcadec_exss_info *info) __attribute__((cold));
 struct dcadec_core_info *core_get_info(struct core_decoder *core) __attribute__((cold));
 struct dcadec_exss_info *core_get_info_exss(struct core_decoder *core) __attribute__((cold));
 
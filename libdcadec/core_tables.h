@@ -133,3 +133,9 @@ static const int32_t joint_scale_factors[129] = {
 static const uint8_t block_code_nbits[8] = {
     0, 7, 10, 12, 13, 15, 17, 19
 };
+
+// Rounded up 2^32 / quant_levels[abits], exact for all block code values
+static const uint32_t block_code_mult[8] = {
+             0, 0x55555556, 0x33333334, 0x24924925,
+    0x1c71c71d, 0x13b13b14, 0x0f0f0f10, 0x0a3d70a4
+};
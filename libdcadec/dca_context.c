@@ -22,9 +22,17 @@
 #include "xll_decoder.h"
 #include "lbr_decoder.h"
 #include "fixed_math.h"
+#include "stats.h"
 
 #define MAX_PACKET_SIZE     0x104000
 
+// Slab size and buffer alignment used with DCADEC_FLAG_ARENA
+#define ARENA_SLAB_SIZE     0x2000
+#define ARENA_ALIGN         64
+
+// Highest bit rate of an extension substream, that of DTS-HD Master Audio
+#define EXSS_MAX_BIT_RATE   24500000
+
 #define PACKET_CORE     0x01
 #define PACKET_EXSS     0x02
 #define PACKET_XLL      0x04
@@ -32,6 +40,7 @@
 
 #define PACKET_FILTERED     0x100
 #define PACKET_RECOVERY     0x200
+#define PACKET_VALIDATED    0x400
 
 #define dca_warn_once(...) \
     dca_format_log(dca, DCADEC_LOG_WARNING | DCADEC_LOG_ONCE, __FILE__, __LINE__, __VA_ARGS__)
@@ -51,6 +60,7 @@ struct dcadec_context {
 
     bool    has_residual_encoded;   ///< XLL residual encoded channels present
     bool    core_residual_valid;    ///< Core valid for residual decoding
+    int     xll_status;             ///< Result of XLL frame validation
 
     int     *dmix_sample_buffer;    ///< Primary channel set downmixing buffer
 
@@ -61,6 +71,10 @@ struct dcadec_context {
     int     profile;            ///< Type of DTS profile decoded
     int     channel_mask;       ///< Channel or speaker mask
     int     *samples[SPEAKER_COUNT];    ///< Sample buffer pointers
+
+    struct dcadec_stats stats;  ///< Stage timers and event counters
+
+    struct ta_account mem[DCADEC_MEM_COUNT];    ///< Memory charged per subsystem
 };
 
 static const uint8_t dca2wav_norm[] = {
@@ -177,12 +191,14 @@ static bool shift_and_clip(struct dcadec_context *dca, int nchannels,
 {
     int shift = storage_bit_res - pcm_bit_res;
     int nsamples = dca->nframesamples;
+    uint64_t start = dca_stats_time();
 
     if (dca->flags & DCADEC_FLAG_DONT_CLIP) {
         if (shift)
             for (int ch = 0; ch < nchannels; ch++)
                 for (int n = 0; n < nsamples; n++)
                     dca->samples[ch][n] *= 1 << shift;
+        dca_stats_add(&dca->stats.stages[DCADEC_STAGE_SHIFT_CLIP], &start, "shift_and_clip");
         return false;
     }
 
@@ -201,6 +217,7 @@ static bool shift_and_clip(struct dcadec_context *dca, int nchannels,
         break;
     }
 
+    dca_stats_add(&dca->stats.stages[DCADEC_STAGE_SHIFT_CLIP], &start, "shift_and_clip");
     return clipped;
 }
 
@@ -252,6 +269,8 @@ static int down_mix_prim_chset(struct dcadec_context *dca,
 
     assert(nsamples > 1);
 
+    uint64_t start = dca_stats_time();
+
     // Reallocate downmix sample buffer
     if (ta_alloc_fast(dca, &dca->dmix_sample_buffer, 2 * nsamples, sizeof(int)) < 0)
         return -DCADEC_ENOMEM;
@@ -301,16 +320,31 @@ static int down_mix_prim_chset(struct dcadec_context *dca,
     samples[SPEAKER_L] = dca->dmix_sample_buffer;
     samples[SPEAKER_R] = dca->dmix_sample_buffer + nsamples;
     *ch_mask = SPEAKER_LAYOUT_STEREO;
+    dca_stats_add(&dca->stats.stages[DCADEC_STAGE_DOWNMIX], &start, "down_mix_prim_chset");
     return 1;
 }
 
+static int core_profile(struct core_decoder *core)
+{
+    if (core->ext_audio_mask & (EXSS_XBR | EXSS_XXCH | EXSS_X96))
+        return DCADEC_PROFILE_HD_HRA;
+    if (core->ext_audio_mask & (CSS_XXCH | CSS_XCH))
+        return DCADEC_PROFILE_DS_ES;
+    if (core->ext_audio_mask & CSS_X96)
+        return DCADEC_PROFILE_DS_96_24;
+    return DCADEC_PROFILE_DS;
+}
+
 static int filter_core_frame(struct dcadec_context *dca)
 {
     struct core_decoder *core = dca->core;
 
     // Filter core frame
     int ret;
-    if ((ret = core_filter(core, dca->flags)) < 0) {
+    uint64_t start = dca_stats_time();
+    ret = core_filter(core, dca->flags);
+    dca_stats_add(&dca->stats.stages[DCADEC_STAGE_CORE_FILTER], &start, "core_filter");
+    if (ret < 0) {
         dca->core_residual_valid = false;
         return ret;
     }
@@ -338,16 +372,7 @@ static int filter_core_frame(struct dcadec_context *dca)
     dca->nframesamples = core->npcmsamples;
     dca->sample_rate = core->output_rate;
     dca->bits_per_sample = 24;
-
-    // Set profile
-    if (core->ext_audio_mask & (EXSS_XBR | EXSS_XXCH | EXSS_X96))
-        dca->profile = DCADEC_PROFILE_HD_HRA;
-    else if (core->ext_audio_mask & (CSS_XXCH | CSS_XCH))
-        dca->profile = DCADEC_PROFILE_DS_ES;
-    else if (core->ext_audio_mask & CSS_X96)
-        dca->profile = DCADEC_PROFILE_DS_96_24;
-    else
-        dca->profile = DCADEC_PROFILE_DS;
+    dca->profile = core_profile(core);
 
     // Perform clipping after Lo/Ro downmix
     if (ret > 0)
@@ -629,6 +654,17 @@ static int validate_hd_ma_frame(struct dcadec_context *dca)
     return 0;
 }
 
+// Validation result is kept until the next packet is parsed, so that querying
+// the output format before filtering does not repeat the checks
+static int check_hd_ma_frame(struct dcadec_context *dca)
+{
+    if (!(dca->packet & PACKET_VALIDATED)) {
+        dca->xll_status = validate_hd_ma_frame(dca);
+        dca->packet |= PACKET_VALIDATED;
+    }
+    return dca->xll_status;
+}
+
 static void force_lossy_output(struct core_decoder *core, struct xll_chset *c)
 {
     // Clear all band data
@@ -662,7 +698,10 @@ static int filter_residual_core_frame(struct dcadec_context *dca)
         flags |= DCADEC_FLAG_CORE_SYNTH_X96;
 
     // Filter core frame
-    if ((ret = core_filter(core, flags)) < 0) {
+    uint64_t start = dca_stats_time();
+    ret = core_filter(core, flags);
+    dca_stats_add(&dca->stats.stages[DCADEC_STAGE_CORE_FILTER], &start, "core_filter");
+    if (ret < 0) {
         dca->core_residual_valid = false;
         return ret;
     }
@@ -767,6 +806,8 @@ static int filter_hd_ma_frame(struct dcadec_context *dca)
         if ((ret = filter_residual_core_frame(dca)) < 0)
             return ret;
 
+    uint64_t start = dca_stats_time();
+
     // Prepare downmixing coefficients for all channel sets
     for (i = xll->nchsets - 1, c = &xll->chset[i]; i >= 0; i--, c--) {
         // Pre-scale by next channel set in hierarchy
@@ -808,6 +849,8 @@ static int filter_hd_ma_frame(struct dcadec_context *dca)
     if (xll->nfreqbands > 1 && (ret = xll_assemble_freq_bands(xll)) < 0)
         return ret;
 
+    dca_stats_add(&dca->stats.stages[DCADEC_STAGE_XLL_FILTER], &start, "xll_filter");
+
     // Output speaker map and channel mask
     int *spkr_map[SPEAKER_COUNT] = { NULL };
     int ch_mask = 0;
@@ -887,7 +930,10 @@ static int filter_lbr_frame(struct dcadec_context *dca)
     struct lbr_decoder *lbr = dca->lbr;
     int ret;
 
-    if ((ret = lbr_filter(lbr)) < 0)
+    uint64_t start = dca_stats_time();
+    ret = lbr_filter(lbr);
+    dca_stats_add(&dca->stats.stages[DCADEC_STAGE_LBR_FILTER], &start, "lbr_filter");
+    if (ret < 0)
         return ret;
 
     if ((ret = reorder_samples(dca, lbr->output_samples, lbr->output_mask)) <= 0)
@@ -907,6 +953,7 @@ static int alloc_core_decoder(struct dcadec_context *dca)
     if (!dca->core) {
         if (!(dca->core = ta_znew(dca, struct core_decoder)))
             return -DCADEC_ENOMEM;
+        ta_set_account(dca->core, &dca->mem[DCADEC_MEM_CORE]);
         dca->core->ctx = dca;
         dca->core->x96_rand = 1;
     }
@@ -918,6 +965,7 @@ static int alloc_exss_parser(struct dcadec_context *dca)
     if (!dca->exss) {
         if (!(dca->exss = ta_znew(dca, struct exss_parser)))
             return -DCADEC_ENOMEM;
+        ta_set_account(dca->exss, &dca->mem[DCADEC_MEM_EXSS]);
         dca->exss->ctx = dca;
     }
     return 0;
@@ -928,6 +976,7 @@ static int alloc_xll_decoder(struct dcadec_context *dca)
     if (!dca->xll) {
         if (!(dca->xll = ta_znew(dca, struct xll_decoder)))
             return -DCADEC_ENOMEM;
+        ta_set_account(dca->xll, &dca->mem[DCADEC_MEM_XLL]);
         dca->xll->ctx = dca;
         dca->xll->flags = dca->flags;
     }
@@ -939,6 +988,7 @@ static int alloc_lbr_decoder(struct dcadec_context *dca)
     if (!dca->lbr) {
         if (!(dca->lbr = ta_znew(dca, struct lbr_decoder)))
             return -DCADEC_ENOMEM;
+        ta_set_account(dca->lbr, &dca->mem[DCADEC_MEM_LBR]);
         dca->lbr->ctx = dca;
         dca->lbr->ctx_flags = dca->flags;
         dca->lbr->lbr_rand = 1;
@@ -946,11 +996,12 @@ static int alloc_lbr_decoder(struct dcadec_context *dca)
     return 0;
 }
 
-DCADEC_API int dcadec_context_parse(struct dcadec_context *dca, uint8_t *data, size_t size)
+static int parse_packet(struct dcadec_context *dca, uint8_t *data, size_t size)
 {
     int status = 0, ret;
+    uint64_t start;
 
-    if (!dca || !data || size < 4 || size > MAX_PACKET_SIZE || ((uintptr_t)data & 3))
+    if (!data || size < 4 || size > MAX_PACKET_SIZE || ((uintptr_t)data & 3))
         return -DCADEC_EINVAL;
 
     int prev_packet = dca->packet;
@@ -960,7 +1011,10 @@ DCADEC_API int dcadec_context_parse(struct dcadec_context *dca, uint8_t *data, s
     if (DCA_MEM32NE(data) == DCA_32BE_C(SYNC_WORD_CORE)) {
         if ((ret = alloc_core_decoder(dca)) < 0)
             return ret;
-        if ((ret = core_parse(dca->core, data, size, dca->flags, NULL)) < 0) {
+        start = dca_stats_time();
+        ret = core_parse(dca->core, data, size, dca->flags, NULL);
+        dca_stats_add(&dca->stats.stages[DCADEC_STAGE_CORE_PARSE], &start, "core_parse");
+        if (ret < 0) {
             dca->core_residual_valid = false;
             return ret;
         }
@@ -983,7 +1037,10 @@ DCADEC_API int dcadec_context_parse(struct dcadec_context *dca, uint8_t *data, s
     if (DCA_MEM32NE(data) == DCA_32BE_C(SYNC_WORD_EXSS)) {
         if ((ret = alloc_exss_parser(dca)) < 0)
             return ret;
-        if ((ret = exss_parse(dca->exss, data, size)) < 0) {
+        start = dca_stats_time();
+        ret = exss_parse(dca->exss, data, size);
+        dca_stats_add(&dca->stats.stages[DCADEC_STAGE_EXSS_PARSE], &start, "exss_parse");
+        if (ret < 0) {
             if (dca->flags & DCADEC_FLAG_STRICT)
                 return ret;
             status = DCADEC_WEXSSFAILED;
@@ -999,7 +1056,10 @@ DCADEC_API int dcadec_context_parse(struct dcadec_context *dca, uint8_t *data, s
         if (!(dca->packet & PACKET_CORE) && (asset->extension_mask & EXSS_CORE)) {
             if ((ret = alloc_core_decoder(dca)) < 0)
                 return ret;
-            if ((ret = core_parse(dca->core, data, size, dca->flags, asset)) < 0) {
+            start = dca_stats_time();
+            ret = core_parse(dca->core, data, size, dca->flags, asset);
+            dca_stats_add(&dca->stats.stages[DCADEC_STAGE_CORE_PARSE], &start, "core_parse");
+            if (ret < 0) {
                 dca->core_residual_valid = false;
                 return ret;
             }
@@ -1013,7 +1073,11 @@ DCADEC_API int dcadec_context_parse(struct dcadec_context *dca, uint8_t *data, s
         if (!(dca->flags & DCADEC_FLAG_CORE_ONLY) && (asset->extension_mask & EXSS_XLL)) {
             if ((ret = alloc_xll_decoder(dca)) < 0)
                 return ret;
-            if ((ret = xll_parse(dca->xll, data, asset)) < 0) {
+            start = dca_stats_time();
+            ret = xll_parse(dca->xll, data, asset);
+            dca_stats_add(&dca->stats.stages[DCADEC_STAGE_XLL_PARSE], &start, "xll_parse");
+            dca_stats_sum(dca->stats.pbr_copied, dca->xll->pbr_copied);
+            if (ret < 0) {
                 // Conceal XLL synchronization error
                 if (ret == -DCADEC_ENOSYNC &&
                     (prev_packet & PACKET_XLL) &&
@@ -1036,7 +1100,10 @@ DCADEC_API int dcadec_context_parse(struct dcadec_context *dca, uint8_t *data, s
         if (!(dca->flags & DCADEC_FLAG_CORE_ONLY) && (asset->extension_mask & EXSS_LBR)) {
             if ((ret = alloc_lbr_decoder(dca)) < 0)
                 return ret;
-            if ((ret = lbr_parse(dca->lbr, data, size, asset)) < 0) {
+            start = dca_stats_time();
+            ret = lbr_parse(dca->lbr, data, size, asset);
+            dca_stats_add(&dca->stats.stages[DCADEC_STAGE_LBR_PARSE], &start, "lbr_parse");
+            if (ret < 0) {
                 if (dca->flags & DCADEC_FLAG_STRICT)
                     return ret;
             } else {
@@ -1050,7 +1117,10 @@ DCADEC_API int dcadec_context_parse(struct dcadec_context *dca, uint8_t *data, s
 
     // Parse core extensions in EXSS or backward compatible core sub-stream
     if (!(dca->flags & DCADEC_FLAG_CORE_ONLY) && (dca->packet & PACKET_CORE)) {
-        if ((ret = core_parse_exss(dca->core, data, dca->flags, asset)) < 0)
+        start = dca_stats_time();
+        ret = core_parse_exss(dca->core, data, dca->flags, asset);
+        dca_stats_add(&dca->stats.stages[DCADEC_STAGE_CORE_PARSE], &start, "core_parse_exss");
+        if (ret < 0)
             return ret;
         if (ret > status)
             status = ret;
@@ -1059,6 +1129,22 @@ DCADEC_API int dcadec_context_parse(struct dcadec_context *dca, uint8_t *data, s
     return status;
 }
 
+DCADEC_API int dcadec_context_parse(struct dcadec_context *dca, uint8_t *data, size_t size)
+{
+    int ret;
+
+    if (!dca)
+        return -DCADEC_EINVAL;
+
+    uint64_t start = dca_stats_time();
+    if ((ret = parse_packet(dca, data, size)) < 0)
+        dca_stats_count(dca->stats.nerrors);
+    else if (ret > 0)
+        dca_stats_count(dca->stats.nwarnings[ret]);
+    dca_stats_span("dcadec_context_parse", start);
+    return ret;
+}
+
 DCADEC_API struct dcadec_core_info *dcadec_context_get_core_info(struct dcadec_context *dca)
 {
     if (dca && (dca->packet & PACKET_CORE))
@@ -1087,6 +1173,36 @@ DCADEC_API void dcadec_context_free_exss_info(struct dcadec_exss_info *info)
     ta_free(info);
 }
 
+static int filter_packet(struct dcadec_context *dca)
+{
+    int ret;
+
+    if (dca->packet & PACKET_LBR) {
+        if ((ret = filter_lbr_frame(dca)) < 0)
+            return ret;
+    } else if (dca->packet & PACKET_XLL) {
+        if ((ret = check_hd_ma_frame(dca)) < 0) {
+            if (dca->flags & DCADEC_FLAG_STRICT)
+                return ret;
+            if (!(dca->packet & PACKET_CORE))
+                return ret;
+            if ((ret = filter_core_frame(dca)) < 0)
+                return ret;
+            ret = DCADEC_WXLLCONFERR;
+        } else {
+            if ((ret = filter_hd_ma_frame(dca)) < 0)
+                return ret;
+        }
+    } else if (dca->packet & PACKET_CORE) {
+        if ((ret = filter_core_frame(dca)) < 0)
+            return ret;
+    } else {
+        return -DCADEC_EINVAL;
+    }
+
+    return ret;
+}
+
 DCADEC_API int dcadec_context_filter(struct dcadec_context *dca, int ***samples,
                                      int *nsamples, int *channel_mask,
                                      int *sample_rate, int *bits_per_sample,
@@ -1098,28 +1214,16 @@ DCADEC_API int dcadec_context_filter(struct dcadec_context *dca, int ***samples,
         return -DCADEC_EINVAL;
 
     if (!(dca->packet & PACKET_FILTERED)) {
-        if (dca->packet & PACKET_LBR) {
-            if ((ret = filter_lbr_frame(dca)) < 0)
-                return ret;
-        } else if (dca->packet & PACKET_XLL) {
-            if ((ret = validate_hd_ma_frame(dca)) < 0) {
-                if (dca->flags & DCADEC_FLAG_STRICT)
-                    return ret;
-                if (!(dca->packet & PACKET_CORE))
-                    return ret;
-                if ((ret = filter_core_frame(dca)) < 0)
-                    return ret;
-                ret = DCADEC_WXLLCONFERR;
-            } else {
-                if ((ret = filter_hd_ma_frame(dca)) < 0)
-                    return ret;
-            }
-        } else if (dca->packet & PACKET_CORE) {
-            if ((ret = filter_core_frame(dca)) < 0)
-                return ret;
-        } else {
-            return -DCADEC_EINVAL;
+        uint64_t start = dca_stats_time();
+        ret = filter_packet(dca);
+        dca_stats_span("dcadec_context_filter", start);
+        if (ret < 0) {
+            dca_stats_count(dca->stats.nerrors);
+            return ret;
         }
+        dca_stats_count(dca->stats.nframes);
+        if (ret > 0)
+            dca_stats_count(dca->stats.nwarnings[ret]);
         dca->status = ret;
         dca->packet |= PACKET_FILTERED;
     }
@@ -1139,6 +1243,58 @@ DCADEC_API int dcadec_context_filter(struct dcadec_context *dca, int ***samples,
     return dca->status;
 }
 
+DCADEC_API int dcadec_context_get_format(struct dcadec_context *dca,
+                                         int *nsamples, int *sample_rate,
+                                         int *bits_per_sample, int *profile)
+{
+    int n, rate, bits, prof;
+
+    if (!dca)
+        return -DCADEC_EINVAL;
+
+    if (dca->packet & PACKET_FILTERED) {
+        n = dca->nframesamples;
+        rate = dca->sample_rate;
+        bits = dca->bits_per_sample;
+        prof = dca->profile;
+    } else if (dca->packet & PACKET_LBR) {
+        struct lbr_decoder *lbr = dca->lbr;
+        n = 1024 << lbr->freq_range;
+        rate = lbr->sample_rate;
+        bits = 24;
+        prof = DCADEC_PROFILE_EXPRESS;
+    } else if ((dca->packet & PACKET_XLL) && check_hd_ma_frame(dca) >= 0) {
+        struct xll_decoder *xll = dca->xll;
+        struct xll_chset *p = &xll->chset[0];
+        n = xll->nframesamples << (xll->nfreqbands - 1);
+        rate = p->freq << (xll->nfreqbands - 1);
+        bits = p->storage_bit_res;
+        prof = DCADEC_PROFILE_HD_MA;
+    } else if ((dca->packet & PACKET_CORE) && (!(dca->packet & PACKET_XLL)
+               || !(dca->flags & DCADEC_FLAG_STRICT))) {
+        // Mirrors X96 synthesis selection in core_filter()
+        struct core_decoder *core = dca->core;
+        bool synth_x96 = (dca->flags & DCADEC_FLAG_CORE_SYNTH_X96) ||
+                         (core->ext_audio_mask & (CSS_X96 | EXSS_X96));
+        n = (core->npcmblocks * NUM_PCMBLOCK_SAMPLES) << synth_x96;
+        rate = core->sample_rate << synth_x96;
+        bits = 24;
+        prof = core_profile(core);
+    } else {
+        return -DCADEC_EINVAL;
+    }
+
+    if (nsamples)
+        *nsamples = n;
+    if (sample_rate)
+        *sample_rate = rate;
+    if (bits_per_sample)
+        *bits_per_sample = bits;
+    if (profile)
+        *profile = prof;
+    return 0;
+}
+
 DCADEC_API void dcadec_context_clear(struct dcadec_context *dca)
 {
     if (dca) {
@@ -1149,11 +1305,173 @@ DCADEC_API void dcadec_context_clear(struct dcadec_context *dca)
     }
 }
 
+DCADEC_API int dcadec_context_trim(struct dcadec_context *dca)
+{
+    if (!dca)
+        return -DCADEC_EINVAL;
+
+    core_trim(dca->core);
+    xll_trim(dca->xll);
+    lbr_trim(dca->lbr);
+    ta_free(dca->dmix_sample_buffer);
+    dca->dmix_sample_buffer = NULL;
+
+    // Parsed packet is gone along with the buffers, and so are the samples
+    memset(dca->samples, 0, sizeof(dca->samples));
+    dca->packet = 0;
+    return 0;
+}
+
+DCADEC_API size_t dcadec_context_get_memory_usage(struct dcadec_context *dca)
+{
+    return ta_get_tree_size(dca);
+}
+
+DCADEC_API int dcadec_context_reserve(struct dcadec_context *dca, size_t size)
+{
+    if (!dca || !(dca->flags & DCADEC_FLAG_ARENA))
+        return -DCADEC_EINVAL;
+    if (!ta_reserve_arena(dca, size))
+        return -DCADEC_ENOMEM;
+    return 0;
+}
+
+DCADEC_API size_t dcadec_context_get_heap_allocs(struct dcadec_context *dca)
+{
+    return ta_get_arena_allocs(dca);
+}
+
+DCADEC_API size_t dcadec_context_get_arena_usage(struct dcadec_context *dca)
+{
+    return ta_get_arena_used(dca);
+}
+
+DCADEC_API size_t dcadec_context_get_reserve_size(struct dcadec_context *dca)
+{
+    if (!dca)
+        return 0;
+
+    struct exss_asset *asset = (dca->packet & PACKET_EXSS) ? &dca->exss->assets[0] : NULL;
+    int ext_mask = asset ? asset->extension_mask : 0;
+    size_t nsamples = dca->nframesamples;
+    size_t size = 0;
+
+    if (dca->packet & PACKET_CORE) {
+        struct core_decoder *core = dca->core;
+        // Mirrors the X96 synthesis selection of core_filter() and, for a
+        // lossless residual, of filter_residual_core_frame()
+        bool synth_x96 = (dca->flags & DCADEC_FLAG_CORE_SYNTH_X96) ||
+                         ((core->ext_audio_mask | ext_mask) & (CSS_X96 | EXSS_X96)) ||
+                         ((dca->packet & PACKET_XLL) && dca->xll->chset->freq == 96000);
+        size += core_get_reserve_size(core, ext_mask, synth_x96);
+        nsamples = DCA_MAX(nsamples, (size_t)(core->npcmblocks * NUM_PCMBLOCK_SAMPLES) << synth_x96);
+    }
+
+    if (dca->packet & PACKET_XLL)
+        size += xll_get_reserve_size(dca->xll, asset);
+
+    if (dca->flags & DCADEC_FLAG_KEEP_DMIX_2CH)
+        size += dca_reserve_size(dca, dca->dmix_sample_buffer, 2 * nsamples * sizeof(int));
+
+    return size;
+}
+
+DCADEC_API size_t dcadec_context_get_max_frame_size(struct dcadec_context *dca)
+{
+    if (!dca)
+        return 0;
+
+    size_t size = 0;
+
+    // Backward compatible core, its size field has 14 bits
+    if ((dca->packet & PACKET_CORE) && !((dca->packet & PACKET_EXSS) &&
+                                         (dca->exss->assets[0].extension_mask & EXSS_CORE)))
+        size += 1 << 14;
+
+    // Extension substream, limited by its size field or, if the frame
+    // duration is known, by the highest bit rate
+    if (dca->packet & PACKET_EXSS) {
+        struct exss_parser *exss = dca->exss;
+        size_t exss_size = (size_t)1 << exss->exss_size_nbits;
+        if (exss->ref_clock) {
+            uint64_t rate_size = (uint64_t)EXSS_MAX_BIT_RATE / 8 * exss->frame_duration / exss->ref_clock;
+            if (rate_size < exss_size)
+                exss_size = DCA_MAX((size_t)rate_size, (size_t)exss->exss_size);
+        }
+        size += exss_size;
+    }
+
+    return size;
+}
+
+DCADEC_API int dcadec_context_get_pbr_copied(struct dcadec_context *dca)
+{
+    return dca && dca->xll ? dca->xll->pbr_copied : 0;
+}
+
+DCADEC_API int dcadec_context_get_stats(struct dcadec_context *dca,
+                                        struct dcadec_stats *stats)
+{
+    if (!dca || !stats)
+        return -DCADEC_EINVAL;
+    *stats = dca->stats;
+    return 0;
+}
+
+DCADEC_API void dcadec_context_reset_stats(struct dcadec_context *dca)
+{
+    if (dca) {
+        memset(&dca->stats, 0, sizeof(dca->stats));
+        for (int i = 0; i < DCADEC_MEM_COUNT; i++) {
+            struct ta_account *a = &dca->mem[i];
+            a->peak = a->live;
+            a->nallocs = a->nreallocs = a->nfrees = 0;
+        }
+    }
+}
+
+DCADEC_API int dcadec_context_get_memory_stats(struct dcadec_context *dca,
+                                               int subsystem,
+                                               struct dcadec_memory_stats *stats)
+{
+    if (!dca || subsystem < 0 || subsystem >= DCADEC_MEM_COUNT || !stats)
+        return -DCADEC_EINVAL;
+    struct ta_account *a = &dca->mem[subsystem];
+    stats->live = a->live;
+    stats->peak = a->peak;
+    stats->nallocs = a->nallocs;
+    stats->nreallocs = a->nreallocs;
+    stats->nfrees = a->nfrees;
+    return 0;
+}
+
+struct ta_account *dca_get_account(struct dcadec_context *dca, int subsystem)
+{
+    return &dca->mem[subsystem];
+}
+
+DCADEC_API uint64_t dcadec_stats_timer(void)
+{
+    return dca_stats_time();
+}
+
 DCADEC_API struct dcadec_context *dcadec_context_create(int flags)
 {
     struct dcadec_context *dca = ta_znew(NULL, struct dcadec_context);
-    if (dca)
-        dca->flags = flags;
+    if (!dca)
+        return NULL;
+
+    // Every subsystem is part of the total
+    for (int i = DCADEC_MEM_TOTAL + 1; i < DCADEC_MEM_COUNT; i++)
+        dca->mem[i].parent = &dca->mem[DCADEC_MEM_TOTAL];
+    ta_set_account(dca, &dca->mem[DCADEC_MEM_CONTEXT]);
+
+    if ((flags & DCADEC_FLAG_ARENA) && !ta_set_arena(dca, ARENA_SLAB_SIZE, ARENA_ALIGN, &dca->mem[DCADEC_MEM_ARENA])) {
+        ta_free(dca);
+        return NULL;
+    }
+
+    dca->flags = flags;
     return dca;
 }
 
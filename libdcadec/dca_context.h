@@ -129,6 +129,21 @@
 
 /** Don't clip returned PCM samples to output bit depth */
 #define DCADEC_FLAG_DONT_CLIP           0x200
+
+/**
+ * Use single precision floating point for DTS core synthesis and LFE FIR
+ * interpolation. About 1.8x faster, but output is not identical to double
+ * precision synthesis: SNR relative to it is 105-135 dB depending on signal
+ * level. Ignored when bit exact decoding is enabled.
+ */
+#define DCADEC_FLAG_CORE_FLOAT32        0x400
+
+/**
+ * Allocate all decoder state from contiguous slabs owned by the context, with
+ * buffers aligned to 64 bytes. Memory of buffers that are replaced when the
+ * stream parameters change is only returned when the context is destroyed.
+ */
+#define DCADEC_FLAG_ARENA               0x800
 /**@}*/
 
 /**@{*/
@@ -160,6 +175,39 @@
 #define DCADEC_LOG_DEBUG    4
 /**@}*/
 
+/**@{*/
+#define DCADEC_STAGE_CORE_PARSE     0   /**< Core and core extension parsing */
+#define DCADEC_STAGE_EXSS_PARSE     1   /**< EXSS header parsing */
+#define DCADEC_STAGE_XLL_PARSE      2   /**< XLL parsing */
+#define DCADEC_STAGE_LBR_PARSE      3   /**< LBR parsing */
+#define DCADEC_STAGE_CORE_FILTER    4   /**< Core subband synthesis */
+#define DCADEC_STAGE_XLL_FILTER     5   /**< XLL prediction and band assembly */
+#define DCADEC_STAGE_LBR_FILTER     6   /**< LBR synthesis */
+#define DCADEC_STAGE_DOWNMIX        7   /**< Primary channel set downmix */
+#define DCADEC_STAGE_SHIFT_CLIP     8   /**< Output shift and clip */
+#define DCADEC_STAGE_COUNT          9
+/**@}*/
+
+/**@{*/
+#define DCADEC_MEM_TOTAL            0   /**< Whole decoder context */
+#define DCADEC_MEM_CONTEXT          1   /**< Context structure and anything not
+                                             charged to a sub-decoder */
+#define DCADEC_MEM_CORE             2   /**< Core decoder and its subband and
+                                             output buffers */
+#define DCADEC_MEM_INTERPOLATOR     3   /**< Core synthesis filter banks and
+                                             their histories */
+#define DCADEC_MEM_EXSS             4   /**< EXSS parser and asset descriptors */
+#define DCADEC_MEM_XLL              5   /**< XLL decoder and NAVI table */
+#define DCADEC_MEM_XLL_CHSET        6   /**< XLL channel sets and their band
+                                             buffers */
+#define DCADEC_MEM_PBR              7   /**< XLL PBR smoothing buffer */
+#define DCADEC_MEM_LBR              8   /**< LBR decoder */
+#define DCADEC_MEM_ARENA            9   /**< Slabs of a context created with
+                                             DCADEC_FLAG_ARENA, which hold all
+                                             of its other allocations */
+#define DCADEC_MEM_COUNT            10
+/**@}*/
+
 /**
  * Size in bytes of empty padding that must be present after the end of input
  * buffer. libdcadec may overread the input buffer up to this number of bytes.
@@ -195,6 +243,39 @@ struct dcadec_exss_info {
     int matrix_encoding;    /**< Matrix encoding type */
 };
 
+struct dcadec_stage_stats {
+    uint64_t    ticks;  /**< Time spent in the stage, in timer ticks */
+    uint64_t    calls;  /**< Number of times the stage was run */
+};
+
+struct dcadec_stats {
+    struct dcadec_stage_stats stages[DCADEC_STAGE_COUNT];
+                                /**< Indexed by DCADEC_STAGE_* constants */
+    uint64_t    nframes;        /**< Number of frames filtered */
+    uint64_t    nerrors;        /**< Number of packets failed to parse or
+                                     filter */
+    uint64_t    nwarnings[10];  /**< Number of warnings, indexed by warning
+                                     code */
+    uint64_t    pbr_copied;     /**< Total bytes copied into the XLL PBR
+                                     smoothing buffer */
+};
+
+struct dcadec_memory_stats {
+    size_t  live;       /**< Bytes currently allocated, including allocator
+                             headers */
+    size_t  peak;       /**< Highest number of live bytes */
+    size_t  nallocs;    /**< Number of allocations */
+    size_t  nreallocs;  /**< Number of allocations resized */
+    size_t  nfrees;     /**< Number of allocations freed */
+};
+
+struct dcadec_trace_event {
+    const char  *name;      /**< Span name, a string with static lifetime */
+    uint32_t    thread;     /**< Identifier of the thread that ran the span */
+    uint64_t    start;      /**< Start time in dcadec_stats_timer() ticks */
+    uint64_t    end;        /**< End time in dcadec_stats_timer() ticks */
+};
+
 typedef void (*dcadec_log_cb)(int level, const char *file, int line,
                               const char *message, void *cbarg);
 
@@ -302,6 +383,28 @@ DCADEC_API int dcadec_context_filter(struct dcadec_context *dca, int ***samples,
                                      int *sample_rate, int *bits_per_sample,
                                      int *profile);
 
+/**
+ * Get format of the PCM audio the parsed packet decodes to, without filtering
+ * it. Output of dcadec_context_filter() for the same packet matches the
+ * returned format. This is cheap enough to be used for probing streams, the
+ * expensive synthesis stages run only when the packet is filtered.
+ *
+ * @param dca       Pointer to decoder context.
+ *
+ * @param nsamples  Filled with number of PCM samples per channel.
+ *
+ * @param sample_rate       Filled with audio sample rate in Hz.
+ *
+ * @param bits_per_sample   Filled with audio PCM resolution in bits.
+ *
+ * @param profile           Filled with type of DTS profile to be decoded.
+ *
+ * @return          0 on success, negative error code on failure.
+ */
+DCADEC_API int dcadec_context_get_format(struct dcadec_context *dca,
+                                         int *nsamples, int *sample_rate,
+                                         int *bits_per_sample, int *profile);
+
 /**
  * Clear all inter-frame history of the decoder. Call this before parsing
  * packets out of sequence, e.g. after seeking to the arbitrary position within
@@ -311,6 +414,213 @@ DCADEC_API int dcadec_context_filter(struct dcadec_context *dca, int ***samples,
  */
 DCADEC_API void dcadec_context_clear(struct dcadec_context *dca);
 
+/**
+ * Release the buffers that only hold data of the current frame, such as PCM
+ * output, XLL band, LBR output and downmix buffers, and shrink the core subband
+ * buffers to their ADPCM history, while keeping the history needed to
+ * continue decoding seamlessly. Useful for contexts of paused streams. The
+ * buffers are allocated again by the next frame.
+ *
+ * Sample pointers returned by dcadec_context_filter() become invalid and a
+ * packet parsed but not filtered yet is discarded. Contexts created with
+ * DCADEC_FLAG_ARENA only get the memory back into their arena.
+ *
+ * @param dca   Pointer to decoder context.
+ *
+ * @return      0 on success, negative error code on failure.
+ */
+DCADEC_API int dcadec_context_trim(struct dcadec_context *dca);
+
+/**
+ * Get the amount of memory held by the decoder context, including all of its
+ * sub-decoders, tables and sample buffers.
+ *
+ * @param dca   Pointer to decoder context.
+ *
+ * @return      Size in bytes.
+ */
+DCADEC_API size_t dcadec_context_get_memory_usage(struct dcadec_context *dca);
+
+/**
+ * Reserve memory so that the decoder context can allocate at least the given
+ * number of bytes without going to the heap. Intended to be called after the
+ * first frame was decoded, so that later changes of buffer sizes are served
+ * from memory set aside in advance. Context must have been created with
+ * DCADEC_FLAG_ARENA.
+ *
+ * @param dca   Pointer to decoder context.
+ *
+ * @param size  Size in bytes.
+ *
+ * @return      0 on success, negative error code on failure.
+ */
+DCADEC_API int dcadec_context_reserve(struct dcadec_context *dca, size_t size);
+
+/**
+ * Get the number of heap allocations made by the decoder context since it was
+ * created. Only counted for contexts created with DCADEC_FLAG_ARENA.
+ *
+ * @param dca   Pointer to decoder context.
+ *
+ * @return      Number of allocations.
+ */
+DCADEC_API size_t dcadec_context_get_heap_allocs(struct dcadec_context *dca);
+
+/**
+ * Get the number of bytes the decoder context has allocated from its arena,
+ * without the free space left in the slabs. Unlike
+ * dcadec_context_get_memory_usage() this does not grow with memory reserved
+ * by dcadec_context_reserve(). Only counted for contexts created with
+ * DCADEC_FLAG_ARENA.
+ *
+ * @param dca   Pointer to decoder context.
+ *
+ * @return      Size in bytes.
+ */
+DCADEC_API size_t dcadec_context_get_arena_usage(struct dcadec_context *dca);
+
+/**
+ * Get an upper bound of the bytes the decoder context may still allocate for
+ * later frames of the stream whose first frame was parsed and filtered. The
+ * bound follows from the parsed headers: the X96 extension announced by the
+ * core header or the EXSS asset, the channels and sample rate of the asset
+ * for XLL channel sets and frequency bands, and whether XLL frames are split
+ * across packets. Meant to be passed to dcadec_context_reserve().
+ *
+ * Decoding can still allocate if later frames bring a component the first
+ * one didn't have (core, EXSS, XLL or LBR), a different number of core PCM
+ * blocks, LBR channels or XLL samples per frame, if X96 synthesis stops
+ * after it was used, if an XLL stream without sync words still needs the PBR
+ * buffer, or if the EXSS asset changes.
+ *
+ * @param dca   Pointer to decoder context.
+ *
+ * @return      Size in bytes.
+ */
+DCADEC_API size_t dcadec_context_get_reserve_size(struct dcadec_context *dca);
+
+/**
+ * Get an upper bound of the size of the frames of the stream whose first
+ * frame was parsed: 16384 bytes for a backward compatible core, plus for an
+ * extension substream what its size field can hold or, if the EXSS header
+ * gives the frame duration, what the highest DTS-HD bit rate fits in it.
+ *
+ * @param dca   Pointer to decoder context.
+ *
+ * @return      Size in bytes, 0 if no frame was parsed.
+ */
+DCADEC_API size_t dcadec_context_get_max_frame_size(struct dcadec_context *dca);
+
+/**
+ * Get the number of bytes copied into the XLL peak bit rate (PBR) smoothing
+ * buffer while parsing the last frame. Zero unless the stream uses PBR
+ * smoothing.
+ *
+ * @param dca   Pointer to decoder context.
+ *
+ * @return      Number of bytes.
+ */
+DCADEC_API int dcadec_context_get_pbr_copied(struct dcadec_context *dca);
+
+/**
+ * Get the timing and event counters accumulated by the decoder context since
+ * it was created or the counters were last reset. Stage times are measured in
+ * ticks of dcadec_stats_timer(). All counters stay zero when libdcadec was
+ * built with DCADEC_STATS defined to 0.
+ *
+ * @param dca   Pointer to decoder context.
+ *
+ * @param stats Pointer to structure that receives the counters.
+ *
+ * @return      0 on success, negative error code on failure.
+ */
+DCADEC_API int dcadec_context_get_stats(struct dcadec_context *dca,
+                                        struct dcadec_stats *stats);
+
+/**
+ * Reset the timing and event counters of the decoder context.
+ *
+ * @param dca   Pointer to decoder context.
+ */
+DCADEC_API void dcadec_context_reset_stats(struct dcadec_context *dca);
+
+/**
+ * Get the memory held by a subsystem of the decoder context, along with its
+ * peak and allocation counts since the context was created or the counters
+ * were last reset. Peaks restart from the live size on reset. A context
+ * created with DCADEC_FLAG_ARENA charges its slabs to DCADEC_MEM_ARENA, the
+ * other subsystems only see memory allocated outside of the arena.
+ *
+ * @param dca       Pointer to decoder context.
+ *
+ * @param subsystem One of DCADEC_MEM_* constants.
+ *
+ * @param stats     Pointer to structure that receives the counters.
+ *
+ * @return          0 on success, negative error code on failure.
+ */
+DCADEC_API int dcadec_context_get_memory_stats(struct dcadec_context *dca,
+                                               int subsystem,
+                                               struct dcadec_memory_stats *stats);
+
+/**
+ * Read the timer used for stage times. This is the time stamp counter on x86
+ * and a nanosecond clock elsewhere.
+ *
+ * @return      Current timer value in ticks.
+ */
+DCADEC_API uint64_t dcadec_stats_timer(void);
+
+/**
+ * Start recording the decoding stages of all decoder contexts as spans into a
+ * process wide ring buffer. When the ring is full the oldest spans are
+ * overwritten. Recording never blocks or allocates memory. Nothing is
+ * recorded when libdcadec was built with DCADEC_STATS defined to 0.
+ *
+ * @param size  Number of spans the ring holds, rounded up to a power of two.
+ *              Only used by the first call, later calls reuse the ring until
+ *              dcadec_trace_free() is called.
+ *
+ * @return      0 on success, negative error code on failure.
+ */
+DCADEC_API int dcadec_trace_start(size_t size);
+
+/**
+ * Stop recording spans. Recorded spans are kept until the next call to
+ * dcadec_trace_start() or dcadec_trace_free().
+ */
+DCADEC_API void dcadec_trace_stop(void);
+
+/**
+ * Record a span while tracing is started. Used by applications to add their
+ * own spans to the ones of the decoder.
+ *
+ * @param name  Span name, must remain valid until the ring is freed.
+ *
+ * @param start Start time in dcadec_stats_timer() ticks.
+ *
+ * @param end   End time in dcadec_stats_timer() ticks.
+ */
+DCADEC_API void dcadec_trace_add(const char *name, uint64_t start, uint64_t end);
+
+/**
+ * Copy the recorded spans, oldest first. Spans that are being overwritten
+ * while they are copied are skipped.
+ *
+ * @param events    Array that receives the spans.
+ *
+ * @param size      Number of elements in the array.
+ *
+ * @return          Number of spans copied.
+ */
+DCADEC_API size_t dcadec_trace_read(struct dcadec_trace_event *events, size_t size);
+
+/**
+ * Stop recording and free the ring. Must not be called while other threads
+ * are decoding.
+ */
+DCADEC_API void dcadec_trace_free(void);
+
 /**
  * Create DTS decoder context.
  *
@@ -19,6 +19,8 @@
 #include "common.h"
 #include "bitstream.h"
 #include "dca_frame.h"
+#include "core_decoder.h"
+#include "exss_parser.h"
 
 #define SRC_OP(E) \
     uint16_t src_0 = DCA_16##E(_src[0]); \
@@ -152,6 +154,79 @@ DCADEC_API int dcadec_frame_parse_header(const uint8_t *data, size_t *size)
     }
 }
 
+DCADEC_API int dcadec_frame_probe(uint8_t *data, size_t size,
+                                  struct dcadec_frame_info *info)
+{
+    // Only the header fields are written by core_probe() and read back by
+    // core_fill_info*(), so the rest of the decoder state is left alone
+    struct core_decoder core;
+    struct exss_parser *exss;
+    int ret;
+
+    if (!data || !info || size < 4 || size > INT_MAX || ((uintptr_t)data & 3))
+        return -DCADEC_EINVAL;
+
+    memset(info, 0, sizeof(*info));
+    core.ctx = NULL;
+
+    // Backward compatible core sub-stream
+    if (DCA_MEM32NE(data) == DCA_32BE_C(SYNC_WORD_CORE)) {
+        if ((ret = core_probe(&core, data, size, NULL)) < 0)
+            return ret;
+
+        info->core_present = true;
+
+        size_t frame_size = DCA_ALIGN(core.frame_size, 4);
+        if (size - 4 > frame_size) {
+            data += frame_size;
+            size -= frame_size;
+        }
+    }
+
+    // Extension sub-stream and core component in its first asset
+    if (DCA_MEM32NE(data) == DCA_32BE_C(SYNC_WORD_EXSS)) {
+        if (!(exss = ta_znew(NULL, struct exss_parser)))
+            return -DCADEC_ENOMEM;
+
+        if ((ret = exss_parse(exss, data, size)) >= 0) {
+            struct exss_asset *asset = &exss->assets[0];
+
+            if (!info->core_present && (asset->extension_mask & EXSS_CORE))
+                info->core_present = core_probe(&core, data, size, asset) >= 0;
+
+            exss_fill_info(exss, &info->exss);
+            info->exss_present = true;
+
+            if (exss->ref_clock > 0)
+                info->nframesamples = (int)((int64_t)exss->frame_duration *
+                                            info->exss.sample_rate / exss->ref_clock);
+        }
+
+        ta_free(exss);
+
+        if (ret < 0 && !info->core_present)
+            return ret;
+    }
+
+    if (!info->core_present && !info->exss_present)
+        return -DCADEC_ENOSYNC;
+
+    if (info->core_present) {
+        core_fill_info(&core, &info->core);
+        if (!info->exss_present)
+            core_fill_info_exss(&core, &info->exss);
+
+        if (!info->nframesamples) {
+            info->nframesamples = core.npcmblocks * NUM_PCMBLOCK_SAMPLES;
+            if (info->exss.sample_rate > core.sample_rate)
+                info->nframesamples = (int)((int64_t)info->nframesamples *
+                                            info->exss.sample_rate / core.sample_rate);
+        }
+    }
+
+    return 0;
+}
+
 DCADEC_API size_t dcadec_frame_buffer_size(size_t size)
 {
     size_t padding = -size & (DCADEC_FRAME_BUFFER_ALIGN - 1);
@@ -45,6 +45,19 @@
 #define DCADEC_FRAME_TYPE_EXSS  1   /**< Extension sub-stream (EXSS) */
 /**@}*/
 
+/** Stream properties gathered from packet headers by dcadec_frame_probe() */
+struct dcadec_frame_info {
+    bool    core_present;   /**< DTS core is present in the packet */
+    bool    exss_present;   /**< Extension sub-stream is present in the packet */
+    struct dcadec_core_info core;   /**< DTS core information, only
+                                         meaningful when core_present is true */
+    struct dcadec_exss_info exss;   /**< Extension sub-stream information. When
+                                         no EXSS is present extended audio in
+                                         core sub-stream is described */
+    int     nframesamples;  /**< Number of PCM samples per channel in a frame
+                                 at exss.sample_rate, zero if unavailable */
+};
+
 /**
  * Convert the raw input frame into native 16-bit big-endian format understood
  * by dcadec_context_parse(). Can operate in-place when destination buffer
@@ -90,6 +103,30 @@ DCADEC_API int dcadec_frame_convert_bitstream(uint8_t *dst, size_t *dst_size,
  */
 DCADEC_API int dcadec_frame_parse_header(const uint8_t *data, size_t *size);
 
+/**
+ * Gather stream properties from the headers of the packet without decoding
+ * it. Only the core frame header and the EXSS header with asset descriptors
+ * are parsed. No decoder context is needed and the function can be called
+ * concurrently from multiple threads.
+ *
+ * Unlike dcadec_context_parse(), core extensions are reported from header
+ * flags without locating them, and the number of channels does not include
+ * channels added by XXCH in the core sub-stream.
+ *
+ * @param data      Pointer to packet data in the format accepted by
+ *                  dcadec_context_parse(), with the same alignment and
+ *                  padding requirements.
+ *
+ * @param size      Size in bytes of packet data. Size should not include
+ *                  padding.
+ *
+ * @param info      Filled with stream properties.
+ *
+ * @return          0 on success, negative error code on failure.
+ */
+DCADEC_API int dcadec_frame_probe(uint8_t *data, size_t size,
+                                  struct dcadec_frame_info *info);
+
 /**
  * Given the raw frame size returned by dcadec_frame_parse_header(), calculate
  * minimum required buffer size for performing bitstream format conversion and
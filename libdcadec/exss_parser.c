@@ -27,6 +27,11 @@ const uint32_t exss_sample_rates[16] = {
      48000,  96000, 192000, 384000
 };
 
+// Reference clock code decoding
+static const int exss_ref_clocks[4] = {
+    32000, 44100, 48000, 0
+};
+
 static void parse_xll_parameters(struct exss_asset *asset)
 {
     struct exss_parser *exss = asset->parser;
@@ -398,10 +403,10 @@ int exss_parse(struct exss_parser *exss, uint8_t *data, int size)
     exss->static_fields_present = bits_get1(&exss->bits);
     if (exss->static_fields_present) {
         // Reference clock code
-        bits_skip(&exss->bits, 2);
+        exss->ref_clock = exss_ref_clocks[bits_get(&exss->bits, 2)];
 
         // Extension substream frame duration
-        bits_skip(&exss->bits, 3);
+        exss->frame_duration = (bits_get(&exss->bits, 3) + 1) * 512;
 
         // Timecode presence flag
         if (bits_get1(&exss->bits)) {
@@ -451,6 +456,8 @@ int exss_parse(struct exss_parser *exss, uint8_t *data, int size)
                 exss->nmixoutchs[i] = count_chs_for_mask(bits_get(&exss->bits, spkr_mask_nbits));
         }
     } else {
+        exss->ref_clock = 0;
+        exss->frame_duration = 0;
         exss->npresents = 1;
         exss->nassets = 1;
     }
@@ -493,11 +500,9 @@ int exss_parse(struct exss_parser *exss, uint8_t *data, int size)
     return ret;
 }
 
-struct dcadec_exss_info *exss_get_info(struct exss_parser *exss)
+void exss_fill_info(struct exss_parser *exss, struct dcadec_exss_info *info)
 {
-    struct dcadec_exss_info *info = ta_znew(NULL, struct dcadec_exss_info);
-    if (!info)
-        return NULL;
+    memset(info, 0, sizeof(*info));
 
     struct exss_asset *asset = &exss->assets[0];
 
@@ -528,6 +533,12 @@ struct dcadec_exss_info *exss_get_info(struct exss_parser *exss)
         else if (asset->representation_type == REPR_TYPE_LhRh)
             info->matrix_encoding = DCADEC_MATRIX_ENCODING_HEADPHONE;
     }
+}
 
+struct dcadec_exss_info *exss_get_info(struct exss_parser *exss)
+{
+    struct dcadec_exss_info *info = ta_znew(NULL, struct dcadec_exss_info);
+    if (info)
+        exss_fill_info(exss, info);
     return info;
 }
@@ -80,6 +80,8 @@ struct exss_parser {
     int     exss_size;          ///< Number of bytes of extension substream
 
     bool    static_fields_present;  ///< Per stream static fields presence flag
+    int     ref_clock;          ///< Reference clock frequency in Hz
+    int     frame_duration;     ///< Frame duration in reference clock periods
     int     npresents;  ///< Number of defined audio presentations
     int     nassets;    ///< Number of audio assets in extension substream
 
@@ -93,6 +95,7 @@ struct exss_parser {
 extern const uint32_t exss_sample_rates[16];
 
 int exss_parse(struct exss_parser *exss, uint8_t *data, int size);
+void exss_fill_info(struct exss_parser *exss, struct dcadec_exss_info *info) __attribute__((cold));
 struct dcadec_exss_info *exss_get_info(struct exss_parser *exss) __attribute__((cold));
 
 #endif
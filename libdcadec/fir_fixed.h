@@ -282,39 +282,56 @@ static const int32_t band_fir_nonperfect[512] = {
          -91,      -77,      -64,      -53
 };
 
-static const int32_t lfe_fir_64[256] = {
-     6103,   52170, -558064, 1592440, 6290049, 1502534, -546669, 53047,
-     1930,   51089, -568920, 1683709, 6286575, 1414057, -534782, 53729,
-     2228,   49794, -579194, 1776276, 6279634, 1327070, -522445, 54228,
-     2552,   48275, -588839, 1870070, 6269231, 1241632, -509702, 54550,
-     2904,   46523, -597808, 1965017, 6255380, 1157798, -496595, 54708,
-     3287,   44529, -606054, 2061044, 6238099, 1075621, -483164, 54710,
-     3704,   42282, -613529, 2158071, 6217408,  995149, -469451, 54566,
-     4152,   39774, -620186, 2256019, 6193332,  916430, -455494, 54285,
-     4631,   36995, -625976, 2354805, 6165900,  839507, -441330, 53876,
-     5139,   33937, -630850, 2454343, 6135146,  764419, -426998, 53348,
-     5682,   30591, -634759, 2554547, 6101107,  691203, -412531, 52711,
-     6264,   26948, -637655, 2655326, 6063824,  619894, -397966, 51972,
-     6886,   23001, -639488, 2756591, 6023343,  550521, -383335, 51140,
-     7531,   18741, -640210, 2858248, 5979711,  483113, -368671, 50224,
-     8230,   14162, -639772, 2960201, 5932981,  417692, -354003, 49231,
-     8959,    9257, -638125, 3062355, 5883210,  354281, -339362, 48168,
-     9727,    4018, -635222, 3164612, 5830457,  292897, -324777, 47044,
-    10535,   -1558, -631014, 3266872, 5774785,  233555, -310273, 45866,
-    11381,   -7480, -625455, 3369035, 5716260,  176267, -295877, 44640,
-    12267,  -13750, -618499, 3471000, 5654952,  121042, -281613, 43373,
-    13190,  -20372, -610098, 3572664, 5590933,   67886, -267505, 42072,
-    14152,  -27352, -600209, 3673924, 5524280,   16800, -253574, 40743,
-    15153,  -34691, -588788, 3774676, 5455069,  -32214, -239840, 39391,
-    16192,  -42390, -575791, 3874816, 5383383,  -79159, -226323, 38022,
-    17267,  -50453, -561178, 3974239, 5309305, -124041, -213041, 36642,
-    18377,  -58879, -544906, 4072841, 5232922, -166869, -200010, 35256,
-    19525,  -67667, -526937, 4170517, 5154321, -207653, -187246, 33866,
-    20704,  -76817, -507233, 4267162, 5073593, -246406, -174764, 32480,
-    21915,  -86327, -485757, 4362672, 4990831, -283146, -162575, 31101,
-    23157,  -96193, -462476, 4456942, 4906129, -317890, -150692, 29732,
-    24426, -106412, -437356, 4549871, 4819584, -350658, -139125, 28376,
-    25721, -116977, -410365, 4641355, 4731293, -381475, -127884, 27038
+// Annex D.8 - LFE interpolation FIR, 64x interpolation, indexed by [tap][output]
+static const int32_t lfe_fir_64[8][32] = {
+    {
+            6103,     1930,     2228,     2552,     2904,     3287,     3704,     4152,
+            4631,     5139,     5682,     6264,     6886,     7531,     8230,     8959,
+            9727,    10535,    11381,    12267,    13190,    14152,    15153,    16192,
+           17267,    18377,    19525,    20704,    21915,    23157,    24426,    25721
+    },
+    {
+           52170,    51089,    49794,    48275,    46523,    44529,    42282,    39774,
+           36995,    33937,    30591,    26948,    23001,    18741,    14162,     9257,
+            4018,    -1558,    -7480,   -13750,   -20372,   -27352,   -34691,   -42390,
+          -50453,   -58879,   -67667,   -76817,   -86327,   -96193,  -106412,  -116977
+    },
+    {
+         -558064,  -568920,  -579194,  -588839,  -597808,  -606054,  -613529,  -620186,
+         -625976,  -630850,  -634759,  -637655,  -639488,  -640210,  -639772,  -638125,
+         -635222,  -631014,  -625455,  -618499,  -610098,  -600209,  -588788,  -575791,
+         -561178,  -544906,  -526937,  -507233,  -485757,  -462476,  -437356,  -410365
+    },
+    {
+         1592440,  1683709,  1776276,  1870070,  1965017,  2061044,  2158071,  2256019,
+         2354805,  2454343,  2554547,  2655326,  2756591,  2858248,  2960201,  3062355,
+         3164612,  3266872,  3369035,  3471000,  3572664,  3673924,  3774676,  3874816,
+         3974239,  4072841,  4170517,  4267162,  4362672,  4456942,  4549871,  4641355
+    },
+    {
+         6290049,  6286575,  6279634,  6269231,  6255380,  6238099,  6217408,  6193332,
+         6165900,  6135146,  6101107,  6063824,  6023343,  5979711,  5932981,  5883210,
+         5830457,  5774785,  5716260,  5654952,  5590933,  5524280,  5455069,  5383383,
+         5309305,  5232922,  5154321,  5073593,  4990831,  4906129,  4819584,  4731293
+    },
+    {
+         1502534,  1414057,  1327070,  1241632,  1157798,  1075621,   995149,   916430,
+          839507,   764419,   691203,   619894,   550521,   483113,   417692,   354281,
+          292897,   233555,   176267,   121042,    67886,    16800,   -32214,   -79159,
+         -124041,  -166869,  -207653,  -246406,  -283146,  -317890,  -350658,  -381475
+    },
+    {
+         -546669,  -534782,  -522445,  -509702,  -496595,  -483164,  -469451,  -455494,
+         -441330,  -426998,  -412531,  -397966,  -383335,  -368671,  -354003,  -339362,
+         -324777,  -310273,  -295877,  -281613,  -267505,  -253574,  -239840,  -226323,
+         -213041,  -200010,  -187246,  -174764,  -162575,  -150692,  -139125,  -127884
+    },
+    {
+           53047,    53729,    54228,    54550,    54708,    54710,    54566,    54285,
+           53876,    53348,    52711,    51972,    51140,    50224,    49231,    48168,
+           47044,    45866,    44640,    43373,    42072,    40743,    39391,    38022,
+           36642,    35256,    33866,    32480,    31101,    29732,    28376,    27038
+    }
 };
 
 //  floor(fir_float.band_fir_x96[i] * (1 << 29) + 0.5), (i & 127) <  32
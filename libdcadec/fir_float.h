@@ -16,10 +16,15 @@
  * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
  */
 
-#define SCALE(x)    ((x) * M_SQRT2 * 128)
+// Tables are double unless included with FIR_FLOAT_TYPE defined
+#ifndef FIR_FLOAT_TYPE
+#define FIR_FLOAT_TYPE double
+#endif
+
+#define SCALE(x)    ((FIR_FLOAT_TYPE)((x) * M_SQRT2 * 128))
 
 // Annex D.8 - 32-band interpolation FIR, perfect reconstruction
-static const double band_fir_perfect[512] = {
+static const FIR_FLOAT_TYPE band_fir_perfect[512] = {
      SCALE( 1.140033200E-10),  SCALE( 7.138742100E-11),
      SCALE(-8.358679600E-09),  SCALE(-2.529296600E-08),
      SCALE(-9.130198800E-08),  SCALE(-2.771560000E-07),
@@ -279,7 +284,7 @@ static const double band_fir_perfect[512] = {
 };
 
 // Annex D.8 - 32-band interpolation FIR, non-perfect reconstruction
-static const double band_fir_nonperfect[512] = {
+static const FIR_FLOAT_TYPE band_fir_nonperfect[512] = {
      SCALE(-1.390191784E-07),  SCALE(-1.693738625E-07),
      SCALE(-2.030677564E-07),  SCALE(-2.404238444E-07),
      SCALE(-2.818143514E-07),  SCALE(-3.276689142E-07),
@@ -540,146 +545,170 @@ static const double band_fir_nonperfect[512] = {
 
 #undef SCALE
 
-// Annex D.8 - LFE interpolation FIR, 64x interpolation
-static const double lfe_fir_64[256] = {
-    2.658434387E-04, 9.029330686E-03, 7.939263433E-02, 2.425158769E-01,
-    3.430179358E-01, 2.398228943E-01, 7.746443897E-02, 8.622321300E-03,
-    8.179365250E-05, 9.450953454E-03, 8.134882897E-02, 2.451938838E-01,
-    3.429597318E-01, 2.371159792E-01, 7.556436211E-02, 8.229630999E-03,
-    9.439323912E-05, 9.887560271E-03, 8.333285898E-02, 2.478559017E-01,
-    3.428434134E-01, 2.343961596E-01, 7.369252294E-02, 7.850865833E-03,
-    1.082170274E-04, 1.033949479E-02, 8.534456789E-02, 2.505008876E-01,
-    3.426689506E-01, 2.316644788E-01, 7.184901088E-02, 7.485736627E-03,
-    1.233371440E-04, 1.080708485E-02, 8.738376945E-02, 2.531278133E-01,
-    3.424364924E-01, 2.289219648E-01, 7.003392279E-02, 7.133882027E-03,
-    1.397485757E-04, 1.129068248E-02, 8.945026249E-02, 2.557355762E-01,
-    3.421461284E-01, 2.261696160E-01, 6.824731827E-02, 6.794991903E-03,
-    1.575958013E-04, 1.179065090E-02, 9.154383838E-02, 2.583232224E-01,
-    3.417979777E-01, 2.234084606E-01, 6.648923457E-02, 6.468691397E-03,
-    1.769922383E-04, 1.230732165E-02, 9.366425127E-02, 2.608896792E-01,
-    3.413922191E-01, 2.206395119E-01, 6.475970894E-02, 6.154712290E-03,
-    1.981738606E-04, 1.284105983E-02, 9.581124038E-02, 2.634339035E-01,
-    3.409290314E-01, 2.178637981E-01, 6.305878609E-02, 5.852684379E-03,
-    2.211847313E-04, 1.339218579E-02, 9.798453748E-02, 2.659549415E-01,
-    3.404086530E-01, 2.150822729E-01, 6.138643622E-02, 5.562345497E-03,
-    2.460231190E-04, 1.396108977E-02, 1.001838669E-01, 2.684516609E-01,
-    3.398312926E-01, 2.122959495E-01, 5.974265561E-02, 5.283284001E-03,
-    2.726115927E-04, 1.454808749E-02, 1.024089083E-01, 2.709231377E-01,
-    3.391972482E-01, 2.095058411E-01, 5.812742189E-02, 5.015311297E-03,
-    3.013863170E-04, 1.515355054E-02, 1.046593264E-01, 2.733682692E-01,
-    3.385068178E-01, 2.067128718E-01, 5.654069409E-02, 4.758012015E-03,
-    3.328395542E-04, 1.577781141E-02, 1.069347933E-01, 2.757860720E-01,
-    3.377602994E-01, 2.039180547E-01, 5.498242006E-02, 4.511159845E-03,
-    3.658991191E-04, 1.642123051E-02, 1.092349365E-01, 2.781755328E-01,
-    3.369580209E-01, 2.011223286E-01, 5.345252529E-02, 4.274417181E-03,
-    4.018281470E-04, 1.708412915E-02, 1.115593687E-01, 2.805356979E-01,
-    3.361004293E-01, 1.983266175E-01, 5.195093155E-02, 4.047499038E-03,
-    4.401875485E-04, 1.776690222E-02, 1.139076948E-01, 2.828655839E-01,
-    3.351879120E-01, 1.955319196E-01, 5.047753453E-02, 3.830091329E-03,
-    4.812776169E-04, 1.846982725E-02, 1.162794977E-01, 2.851640880E-01,
-    3.342207968E-01, 1.927391142E-01, 4.903224111E-02, 3.621967277E-03,
-    5.252459669E-04, 1.919330470E-02, 1.186743453E-01, 2.874303460E-01,
-    3.331996202E-01, 1.899491698E-01, 4.761491716E-02, 3.422776936E-03,
-    5.721592461E-04, 1.993762329E-02, 1.210917681E-01, 2.896633744E-01,
-    3.321248591E-01, 1.871629506E-01, 4.622544348E-02, 3.232272575E-03,
-    6.222130032E-04, 2.070316114E-02, 1.235313043E-01, 2.918621898E-01,
-    3.309969604E-01, 1.843813360E-01, 4.486365616E-02, 3.050152911E-03,
-    6.755515351E-04, 2.149021253E-02, 1.259924471E-01, 2.940258980E-01,
-    3.298164308E-01, 1.816052496E-01, 4.352942482E-02, 2.876190469E-03,
-    7.324148901E-04, 2.229913883E-02, 1.284746826E-01, 2.961534858E-01,
-    3.285838962E-01, 1.788355410E-01, 4.222255200E-02, 2.710093278E-03,
-    7.928516716E-04, 2.313023806E-02, 1.309774816E-01, 2.982441187E-01,
-    3.272998929E-01, 1.760730892E-01, 4.094288871E-02, 2.551567042E-03,
-    8.570110658E-04, 2.398385666E-02, 1.335003078E-01, 3.002967536E-01,
-    3.259649575E-01, 1.733186990E-01, 3.969023004E-02, 2.400433412E-03,
-    9.251192096E-04, 2.486028522E-02, 1.360425949E-01, 3.023106754E-01,
-    3.245797157E-01, 1.705732346E-01, 3.846437484E-02, 2.256359672E-03,
-    9.974770946E-04, 2.575986087E-02, 1.386037618E-01, 3.042849004E-01,
-    3.231448531E-01, 1.678375006E-01, 3.726511076E-02, 2.119151875E-03,
-    1.073930296E-03, 2.668286115E-02, 1.411831975E-01, 3.062185347E-01,
-    3.216609657E-01, 1.651122719E-01, 3.609224036E-02, 1.988604199E-03,
-    1.155023579E-03, 2.762960829E-02, 1.437802613E-01, 3.081108034E-01,
-    3.201287389E-01, 1.623983532E-01, 3.494550660E-02, 1.864377526E-03,
-    1.240676851E-03, 2.860039286E-02, 1.463943720E-01, 3.099608123E-01,
-    3.185488880E-01, 1.596965194E-01, 3.382468969E-02, 1.746327500E-03,
-    1.331258914E-03, 2.959549613E-02, 1.490248144E-01, 3.117676973E-01,
-    3.169221282E-01, 1.570075154E-01, 3.272953629E-02, 1.634211512E-03,
-    1.426893868E-03, 3.061520495E-02, 1.516709626E-01, 3.135308027E-01,
-    3.152491748E-01, 1.543320864E-01, 3.165979683E-02, 1.527829794E-03
+// Annex D.8 - LFE interpolation FIR, 64x interpolation, indexed by [tap][output]
+static const FIR_FLOAT_TYPE lfe_fir_64[8][32] = {
+    {
+         2.658434387E-04,  8.179365250E-05,  9.439323912E-05,  1.082170274E-04,
+         1.233371440E-04,  1.397485757E-04,  1.575958013E-04,  1.769922383E-04,
+         1.981738606E-04,  2.211847313E-04,  2.460231190E-04,  2.726115927E-04,
+         3.013863170E-04,  3.328395542E-04,  3.658991191E-04,  4.018281470E-04,
+         4.401875485E-04,  4.812776169E-04,  5.252459669E-04,  5.721592461E-04,
+         6.222130032E-04,  6.755515351E-04,  7.324148901E-04,  7.928516716E-04,
+         8.570110658E-04,  9.251192096E-04,  9.974770946E-04,  1.073930296E-03,
+         1.155023579E-03,  1.240676851E-03,  1.331258914E-03,  1.426893868E-03
+    },
+    {
+         9.029330686E-03,  9.450953454E-03,  9.887560271E-03,  1.033949479E-02,
+         1.080708485E-02,  1.129068248E-02,  1.179065090E-02,  1.230732165E-02,
+         1.284105983E-02,  1.339218579E-02,  1.396108977E-02,  1.454808749E-02,
+         1.515355054E-02,  1.577781141E-02,  1.642123051E-02,  1.708412915E-02,
+         1.776690222E-02,  1.846982725E-02,  1.919330470E-02,  1.993762329E-02,
+         2.070316114E-02,  2.149021253E-02,  2.229913883E-02,  2.313023806E-02,
+         2.398385666E-02,  2.486028522E-02,  2.575986087E-02,  2.668286115E-02,
+         2.762960829E-02,  2.860039286E-02,  2.959549613E-02,  3.061520495E-02
+    },
+    {
+         7.939263433E-02,  8.134882897E-02,  8.333285898E-02,  8.534456789E-02,
+         8.738376945E-02,  8.945026249E-02,  9.154383838E-02,  9.366425127E-02,
+         9.581124038E-02,  9.798453748E-02,  1.001838669E-01,  1.024089083E-01,
+         1.046593264E-01,  1.069347933E-01,  1.092349365E-01,  1.115593687E-01,
+         1.139076948E-01,  1.162794977E-01,  1.186743453E-01,  1.210917681E-01,
+         1.235313043E-01,  1.259924471E-01,  1.284746826E-01,  1.309774816E-01,
+         1.335003078E-01,  1.360425949E-01,  1.386037618E-01,  1.411831975E-01,
+         1.437802613E-01,  1.463943720E-01,  1.490248144E-01,  1.516709626E-01
+    },
+    {
+         2.425158769E-01,  2.451938838E-01,  2.478559017E-01,  2.505008876E-01,
+         2.531278133E-01,  2.557355762E-01,  2.583232224E-01,  2.608896792E-01,
+         2.634339035E-01,  2.659549415E-01,  2.684516609E-01,  2.709231377E-01,
+         2.733682692E-01,  2.757860720E-01,  2.781755328E-01,  2.805356979E-01,
+         2.828655839E-01,  2.851640880E-01,  2.874303460E-01,  2.896633744E-01,
+         2.918621898E-01,  2.940258980E-01,  2.961534858E-01,  2.982441187E-01,
+         3.002967536E-01,  3.023106754E-01,  3.042849004E-01,  3.062185347E-01,
+         3.081108034E-01,  3.099608123E-01,  3.117676973E-01,  3.135308027E-01
+    },
+    {
+         3.430179358E-01,  3.429597318E-01,  3.428434134E-01,  3.426689506E-01,
+         3.424364924E-01,  3.421461284E-01,  3.417979777E-01,  3.413922191E-01,
+         3.409290314E-01,  3.404086530E-01,  3.398312926E-01,  3.391972482E-01,
+         3.385068178E-01,  3.377602994E-01,  3.369580209E-01,  3.361004293E-01,
+         3.351879120E-01,  3.342207968E-01,  3.331996202E-01,  3.321248591E-01,
+         3.309969604E-01,  3.298164308E-01,  3.285838962E-01,  3.272998929E-01,
+         3.259649575E-01,  3.245797157E-01,  3.231448531E-01,  3.216609657E-01,
+         3.201287389E-01,  3.185488880E-01,  3.169221282E-01,  3.152491748E-01
+    },
+    {
+         2.398228943E-01,  2.371159792E-01,  2.343961596E-01,  2.316644788E-01,
+         2.289219648E-01,  2.261696160E-01,  2.234084606E-01,  2.206395119E-01,
+         2.178637981E-01,  2.150822729E-01,  2.122959495E-01,  2.095058411E-01,
+         2.067128718E-01,  2.039180547E-01,  2.011223286E-01,  1.983266175E-01,
+         1.955319196E-01,  1.927391142E-01,  1.899491698E-01,  1.871629506E-01,
+         1.843813360E-01,  1.816052496E-01,  1.788355410E-01,  1.760730892E-01,
+         1.733186990E-01,  1.705732346E-01,  1.678375006E-01,  1.651122719E-01,
+         1.623983532E-01,  1.596965194E-01,  1.570075154E-01,  1.543320864E-01
+    },
+    {
+         7.746443897E-02,  7.556436211E-02,  7.369252294E-02,  7.184901088E-02,
+         7.003392279E-02,  6.824731827E-02,  6.648923457E-02,  6.475970894E-02,
+         6.305878609E-02,  6.138643622E-02,  5.974265561E-02,  5.812742189E-02,
+         5.654069409E-02,  5.498242006E-02,  5.345252529E-02,  5.195093155E-02,
+         5.047753453E-02,  4.903224111E-02,  4.761491716E-02,  4.622544348E-02,
+         4.486365616E-02,  4.352942482E-02,  4.222255200E-02,  4.094288871E-02,
+         3.969023004E-02,  3.846437484E-02,  3.726511076E-02,  3.609224036E-02,
+         3.494550660E-02,  3.382468969E-02,  3.272953629E-02,  3.165979683E-02
+    },
+    {
+         8.622321300E-03,  8.229630999E-03,  7.850865833E-03,  7.485736627E-03,
+         7.133882027E-03,  6.794991903E-03,  6.468691397E-03,  6.154712290E-03,
+         5.852684379E-03,  5.562345497E-03,  5.283284001E-03,  5.015311297E-03,
+         4.758012015E-03,  4.511159845E-03,  4.274417181E-03,  4.047499038E-03,
+         3.830091329E-03,  3.621967277E-03,  3.422776936E-03,  3.232272575E-03,
+         3.050152911E-03,  2.876190469E-03,  2.710093278E-03,  2.551567042E-03,
+         2.400433412E-03,  2.256359672E-03,  2.119151875E-03,  1.988604199E-03,
+         1.864377526E-03,  1.746327500E-03,  1.634211512E-03,  1.527829794E-03
+    }
 };
 
-// Annex D.8 - LFE interpolation FIR, 128x interpolation
-static const double lfe_fir_128[256] = {
-    5.316857100E-04, 1.587849557E-01, 6.860344410E-01, 1.549285650E-01,
-    1.635869100E-04, 1.626973301E-01, 6.859180331E-01, 1.511284113E-01,
-    1.887860900E-04, 1.666653752E-01, 6.856853962E-01, 1.473847479E-01,
-    2.164336300E-04, 1.706887931E-01, 6.853365302E-01, 1.436977387E-01,
-    2.466738200E-04, 1.747671962E-01, 6.848715544E-01, 1.400675476E-01,
-    2.794966000E-04, 1.789001823E-01, 6.842908263E-01, 1.364943385E-01,
-    3.151909600E-04, 1.830873191E-01, 6.835945249E-01, 1.329781860E-01,
-    3.539837500E-04, 1.873281151E-01, 6.827830076E-01, 1.295191795E-01,
-    3.963469100E-04, 1.916220933E-01, 6.818566918E-01, 1.261173040E-01,
-    4.423685900E-04, 1.959686577E-01, 6.808158755E-01, 1.227726117E-01,
-    4.920452500E-04, 2.003673166E-01, 6.796611548E-01, 1.194850579E-01,
-    5.452220800E-04, 2.048173845E-01, 6.783930659E-01, 1.162546203E-01,
-    6.027714100E-04, 2.093182206E-01, 6.770122051E-01, 1.130811572E-01,
-    6.656776500E-04, 2.138691545E-01, 6.755192280E-01, 1.099646092E-01,
-    7.317967800E-04, 2.184694260E-01, 6.739146709E-01, 1.069048345E-01,
-    8.036546600E-04, 2.231182903E-01, 6.721994877E-01, 1.039016470E-01,
-    8.803732300E-04, 2.278149277E-01, 6.703743935E-01, 1.009548605E-01,
-    9.625531400E-04, 2.325585187E-01, 6.684402227E-01, 9.806428105E-02,
-    1.050489840E-03, 2.373482138E-01, 6.663978696E-01, 9.522963315E-02,
-    1.144316160E-03, 2.421830446E-01, 6.642482877E-01, 9.245070815E-02,
-    1.244423330E-03, 2.470620573E-01, 6.619924903E-01, 8.972713351E-02,
-    1.351100280E-03, 2.519843280E-01, 6.596315503E-01, 8.705867827E-02,
-    1.464826870E-03, 2.569487989E-01, 6.571664810E-01, 8.444493264E-02,
-    1.585700080E-03, 2.619544268E-01, 6.545983553E-01, 8.188561350E-02,
-    1.714018640E-03, 2.670000792E-01, 6.519285440E-01, 7.938029617E-02,
-    1.850234690E-03, 2.720846236E-01, 6.491580606E-01, 7.692859322E-02,
-    1.994950230E-03, 2.772069275E-01, 6.462883353E-01, 7.453006506E-02,
-    2.147856400E-03, 2.823657692E-01, 6.433205605E-01, 7.218432426E-02,
-    2.310042500E-03, 2.875599265E-01, 6.402561665E-01, 6.989086419E-02,
-    2.481348810E-03, 2.927881181E-01, 6.370964646E-01, 6.764923781E-02,
-    2.662512240E-03, 2.980490029E-01, 6.338429451E-01, 6.545893103E-02,
-    2.853781920E-03, 3.033412695E-01, 6.304970384E-01, 6.331945211E-02,
-    3.055653300E-03, 3.086635172E-01, 6.270602942E-01, 6.123027951E-02,
-    3.268416510E-03, 3.140144050E-01, 6.235341430E-01, 5.919086933E-02,
-    3.492647550E-03, 3.193923831E-01, 6.199202538E-01, 5.720067024E-02,
-    3.728747140E-03, 3.247960210E-01, 6.162202954E-01, 5.525910854E-02,
-    3.977200480E-03, 3.302238286E-01, 6.124358177E-01, 5.336561054E-02,
-    4.238294900E-03, 3.356742859E-01, 6.085684896E-01, 5.151961371E-02,
-    4.512710030E-03, 3.411457539E-01, 6.046201587E-01, 4.972046614E-02,
-    4.800856580E-03, 3.466366828E-01, 6.005923152E-01, 4.796761274E-02,
-    5.103122910E-03, 3.521454632E-01, 5.964869261E-01, 4.626038298E-02,
-    5.420174920E-03, 3.576703668E-01, 5.923057795E-01, 4.459818453E-02,
-    5.752369300E-03, 3.632097244E-01, 5.880505443E-01, 4.298033938E-02,
-    6.100293250E-03, 3.687619269E-01, 5.837231875E-01, 4.140623659E-02,
-    6.464532110E-03, 3.743250966E-01, 5.793255568E-01, 3.987516090E-02,
-    6.845539900E-03, 3.798975349E-01, 5.748594403E-01, 3.838652745E-02,
-    7.243919190E-03, 3.854774535E-01, 5.703269839E-01, 3.693958372E-02,
-    7.660165890E-03, 3.910630047E-01, 5.657299161E-01, 3.553372994E-02,
-    8.094980380E-03, 3.966524303E-01, 5.610702634E-01, 3.416819125E-02,
-    8.548815730E-03, 4.022437930E-01, 5.563499928E-01, 3.284239396E-02,
-    9.022301060E-03, 4.078352153E-01, 5.515710115E-01, 3.155555204E-02,
-    9.516004470E-03, 4.134248793E-01, 5.467353463E-01, 3.030703776E-02,
-    1.003060210E-02, 4.190107882E-01, 5.418450832E-01, 2.909611352E-02,
-    1.056654565E-02, 4.245910645E-01, 5.369022489E-01, 2.792212367E-02,
-    1.112466771E-02, 4.301636219E-01, 5.319088101E-01, 2.678431384E-02,
-    1.170534454E-02, 4.357266724E-01, 5.268667936E-01, 2.568206564E-02,
-    1.230939943E-02, 4.412781000E-01, 5.217782855E-01, 2.461459488E-02,
-    1.293735672E-02, 4.468160272E-01, 5.166453719E-01, 2.358125709E-02,
-    1.358995494E-02, 4.523383081E-01, 5.114701390E-01, 2.258131653E-02,
-    1.426773332E-02, 4.578429461E-01, 5.062545538E-01, 2.161412500E-02,
-    1.497144438E-02, 4.633280039E-01, 5.010007620E-01, 2.067894675E-02,
-    1.570170000E-02, 4.687913656E-01, 4.957108200E-01, 1.977507770E-02,
-    1.645922661E-02, 4.742309451E-01, 4.903867543E-01, 1.890186779E-02,
-    1.724460535E-02, 4.796448052E-01, 4.850307405E-01, 1.805862412E-02
+// Annex D.8 - LFE interpolation FIR, 128x interpolation, indexed by [tap][output]
+static const FIR_FLOAT_TYPE lfe_fir_128[4][64] = {
+    {
+         5.316857100E-04,  1.635869100E-04,  1.887860900E-04,  2.164336300E-04,
+         2.466738200E-04,  2.794966000E-04,  3.151909600E-04,  3.539837500E-04,
+         3.963469100E-04,  4.423685900E-04,  4.920452500E-04,  5.452220800E-04,
+         6.027714100E-04,  6.656776500E-04,  7.317967800E-04,  8.036546600E-04,
+         8.803732300E-04,  9.625531400E-04,  1.050489840E-03,  1.144316160E-03,
+         1.244423330E-03,  1.351100280E-03,  1.464826870E-03,  1.585700080E-03,
+         1.714018640E-03,  1.850234690E-03,  1.994950230E-03,  2.147856400E-03,
+         2.310042500E-03,  2.481348810E-03,  2.662512240E-03,  2.853781920E-03,
+         3.055653300E-03,  3.268416510E-03,  3.492647550E-03,  3.728747140E-03,
+         3.977200480E-03,  4.238294900E-03,  4.512710030E-03,  4.800856580E-03,
+         5.103122910E-03,  5.420174920E-03,  5.752369300E-03,  6.100293250E-03,
+         6.464532110E-03,  6.845539900E-03,  7.243919190E-03,  7.660165890E-03,
+         8.094980380E-03,  8.548815730E-03,  9.022301060E-03,  9.516004470E-03,
+         1.003060210E-02,  1.056654565E-02,  1.112466771E-02,  1.170534454E-02,
+         1.230939943E-02,  1.293735672E-02,  1.358995494E-02,  1.426773332E-02,
+         1.497144438E-02,  1.570170000E-02,  1.645922661E-02,  1.724460535E-02
+    },
+    {
+         1.587849557E-01,  1.626973301E-01,  1.666653752E-01,  1.706887931E-01,
+         1.747671962E-01,  1.789001823E-01,  1.830873191E-01,  1.873281151E-01,
+         1.916220933E-01,  1.959686577E-01,  2.003673166E-01,  2.048173845E-01,
+         2.093182206E-01,  2.138691545E-01,  2.184694260E-01,  2.231182903E-01,
+         2.278149277E-01,  2.325585187E-01,  2.373482138E-01,  2.421830446E-01,
+         2.470620573E-01,  2.519843280E-01,  2.569487989E-01,  2.619544268E-01,
+         2.670000792E-01,  2.720846236E-01,  2.772069275E-01,  2.823657692E-01,
+         2.875599265E-01,  2.927881181E-01,  2.980490029E-01,  3.033412695E-01,
+         3.086635172E-01,  3.140144050E-01,  3.193923831E-01,  3.247960210E-01,
+         3.302238286E-01,  3.356742859E-01,  3.411457539E-01,  3.466366828E-01,
+         3.521454632E-01,  3.576703668E-01,  3.632097244E-01,  3.687619269E-01,
+         3.743250966E-01,  3.798975349E-01,  3.854774535E-01,  3.910630047E-01,
+         3.966524303E-01,  4.022437930E-01,  4.078352153E-01,  4.134248793E-01,
+         4.190107882E-01,  4.245910645E-01,  4.301636219E-01,  4.357266724E-01,
+         4.412781000E-01,  4.468160272E-01,  4.523383081E-01,  4.578429461E-01,
+         4.633280039E-01,  4.687913656E-01,  4.742309451E-01,  4.796448052E-01
+    },
+    {
+         6.860344410E-01,  6.859180331E-01,  6.856853962E-01,  6.853365302E-01,
+         6.848715544E-01,  6.842908263E-01,  6.835945249E-01,  6.827830076E-01,
+         6.818566918E-01,  6.808158755E-01,  6.796611548E-01,  6.783930659E-01,
+         6.770122051E-01,  6.755192280E-01,  6.739146709E-01,  6.721994877E-01,
+         6.703743935E-01,  6.684402227E-01,  6.663978696E-01,  6.642482877E-01,
+         6.619924903E-01,  6.596315503E-01,  6.571664810E-01,  6.545983553E-01,
+         6.519285440E-01,  6.491580606E-01,  6.462883353E-01,  6.433205605E-01,
+         6.402561665E-01,  6.370964646E-01,  6.338429451E-01,  6.304970384E-01,
+         6.270602942E-01,  6.235341430E-01,  6.199202538E-01,  6.162202954E-01,
+         6.124358177E-01,  6.085684896E-01,  6.046201587E-01,  6.005923152E-01,
+         5.964869261E-01,  5.923057795E-01,  5.880505443E-01,  5.837231875E-01,
+         5.793255568E-01,  5.748594403E-01,  5.703269839E-01,  5.657299161E-01,
+         5.610702634E-01,  5.563499928E-01,  5.515710115E-01,  5.467353463E-01,
+         5.418450832E-01,  5.369022489E-01,  5.319088101E-01,  5.268667936E-01,
+         5.217782855E-01,  5.166453719E-01,  5.114701390E-01,  5.062545538E-01,
+         5.010007620E-01,  4.957108200E-01,  4.903867543E-01,  4.850307405E-01
+    },
+    {
+         1.549285650E-01,  1.511284113E-01,  1.473847479E-01,  1.436977387E-01,
+         1.400675476E-01,  1.364943385E-01,  1.329781860E-01,  1.295191795E-01,
+         1.261173040E-01,  1.227726117E-01,  1.194850579E-01,  1.162546203E-01,
+         1.130811572E-01,  1.099646092E-01,  1.069048345E-01,  1.039016470E-01,
+         1.009548605E-01,  9.806428105E-02,  9.522963315E-02,  9.245070815E-02,
+         8.972713351E-02,  8.705867827E-02,  8.444493264E-02,  8.188561350E-02,
+         7.938029617E-02,  7.692859322E-02,  7.453006506E-02,  7.218432426E-02,
+         6.989086419E-02,  6.764923781E-02,  6.545893103E-02,  6.331945211E-02,
+         6.123027951E-02,  5.919086933E-02,  5.720067024E-02,  5.525910854E-02,
+         5.336561054E-02,  5.151961371E-02,  4.972046614E-02,  4.796761274E-02,
+         4.626038298E-02,  4.459818453E-02,  4.298033938E-02,  4.140623659E-02,
+         3.987516090E-02,  3.838652745E-02,  3.693958372E-02,  3.553372994E-02,
+         3.416819125E-02,  3.284239396E-02,  3.155555204E-02,  3.030703776E-02,
+         2.909611352E-02,  2.792212367E-02,  2.678431384E-02,  2.568206564E-02,
+         2.461459488E-02,  2.358125709E-02,  2.258131653E-02,  2.161412500E-02,
+         2.067894675E-02,  1.977507770E-02,  1.890186779E-02,  1.805862412E-02
+    }
 };
 
-#define SCALE(x)    ((x) * M_SQRT2 * 256)
+#define SCALE(x)    ((FIR_FLOAT_TYPE)((x) * M_SQRT2 * 256))
 
 // Annex D.9 - 1024 tap FIR for X96 synthesis QMF
-static const double band_fir_x96[1024] = {
+static const FIR_FLOAT_TYPE band_fir_x96[1024] = {
      SCALE(-7.127938986604168E-08),  SCALE(-7.095090315087499E-08),
      SCALE(-7.952503432137510E-08),  SCALE(-8.932687128137479E-08),
      SCALE(-9.748319049487465E-08),  SCALE(-1.058665951072195E-07),
@@ -0,0 +1,101 @@
+/*
+ * This file is part of libdcadec.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation; either version 2.1 of the License, or (at your
+ * option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef FIXED_MATH_SSE2_H
+#define FIXED_MATH_SSE2_H
+
+#if HAVE_SSE2
+
+#include <emmintrin.h>
+
+// Bit exact 4-way equivalents of the fixed_math.h primitives
+
+// Constant multiplier prepared for mul__coeff_sse2()
+struct coeff_sse2 {
+    __m128i     coeff;  ///< Magnitude of the coefficient
+    __m128i     sign;   ///< All ones if the coefficient is negative
+    __m128i     bias;   ///< Rounding term combined with sign corrections
+};
+
+static inline struct coeff_sse2 coeff_sse2_init(int32_t b, int bits)
+{
+    // SSE2 only has an unsigned 32x32->64 multiply. Offsetting a by 2^31
+    // makes it unsigned, the resulting error is a constant that is folded
+    // into the bias together with the rounding term and the negation of
+    // the product for negative coefficients.
+    uint32_t m = b < 0 ? 0u - (uint32_t)b : (uint32_t)b;
+    int64_t bias = bits > 0 ? INT64_C(1) << (bits - 1) : 0;
+    if (b < 0)
+        bias += ((int64_t)m << 31) + 1;
+    else
+        bias -= (int64_t)m << 31;
+
+    struct coeff_sse2 c;
+    c.coeff = _mm_set1_epi32((int)m);
+    c.sign = _mm_set1_epi32(b < 0 ? -1 : 0);
+    c.bias = _mm_set_epi32((int)(bias >> 32), (int)bias, (int)(bias >> 32), (int)bias);
+    return c;
+}
+
+// Only the low 32 bits of the shifted result are kept, so a logical shift
+// of the 64-bit product gives the same result as the arithmetic one
+static inline __m128i mul__coeff_sse2(__m128i a, const struct coeff_sse2 *c, int bits)
+{
+    const __m128i mask = _mm_set_epi32(0, -1, 0, -1);
+    a = _mm_xor_si128(a, _mm_set1_epi32(INT32_MIN));
+    __m128i lo = _mm_mul_epu32(a, c->coeff);
+    __m128i hi = _mm_mul_epu32(_mm_shuffle_epi32(a, _MM_SHUFFLE(3, 3, 1, 1)), c->coeff);
+    lo = _mm_add_epi64(_mm_xor_si128(lo, c->sign), c->bias);
+    hi = _mm_add_epi64(_mm_xor_si128(hi, c->sign), c->bias);
+    lo = _mm_srli_epi64(lo, bits);
+    hi = _mm_slli_epi64(hi, 32 - bits);
+    return _mm_or_si128(_mm_and_si128(mask, lo), _mm_andnot_si128(mask, hi));
+}
+
+// Accumulate exact 64-bit products of even and odd lanes. The sign
+// correction is constant and left out, the accumulators should start from
+// the sum of biases of all multipliers prepared with zero bits.
+static inline void mac_coeff_sse2(__m128i *lo, __m128i *hi, __m128i a, const struct coeff_sse2 *c)
+{
+    a = _mm_xor_si128(a, _mm_set1_epi32(INT32_MIN));
+    *lo = _mm_add_epi64(*lo, _mm_xor_si128(_mm_mul_epu32(a, c->coeff), c->sign));
+    *hi = _mm_add_epi64(*hi, _mm_xor_si128(_mm_mul_epu32(_mm_shuffle_epi32(a, _MM_SHUFFLE(3, 3, 1, 1)), c->coeff), c->sign));
+}
+
+static inline __m128i norm__sse2(__m128i lo, __m128i hi, int bits)
+{
+    const __m128i round = _mm_set_epi32(0, 1 << (bits - 1), 0, 1 << (bits - 1));
+    const __m128i mask = _mm_set_epi32(0, -1, 0, -1);
+    lo = _mm_srli_epi64(_mm_add_epi64(lo, round), bits);
+    hi = _mm_slli_epi64(_mm_add_epi64(hi, round), 32 - bits);
+    return _mm_or_si128(_mm_and_si128(mask, lo), _mm_andnot_si128(mask, hi));
+}
+
+static inline __m128i clip23_sse2(__m128i a)
+{
+    const __m128i max = _mm_set1_epi32((1 << 23) - 1);
+    const __m128i min = _mm_set1_epi32(-(1 << 23));
+    __m128i gt = _mm_cmpgt_epi32(a, max);
+    __m128i lt = _mm_cmplt_epi32(a, min);
+    a = _mm_or_si128(_mm_andnot_si128(gt, a), _mm_and_si128(gt, max));
+    return _mm_or_si128(_mm_andnot_si128(lt, a), _mm_and_si128(lt, min));
+}
+
+#endif
+
+#endif
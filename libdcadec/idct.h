@@ -22,16 +22,29 @@
 #define IDCT_BITS   7
 #define IDCT_SIZE   (1 << IDCT_BITS)
 
+// Twiddle tables are static and shared by all contexts, a context only
+// selects the transform size and output scale
+//
+// The floating point transforms are not bit identical to the ones computing
+// their twiddles with cos() at init: double precision output differs by up to
+// about 2e-14 of the peak. After rounding, core PCM samples rarely change but
+// LBR samples can differ by 1.
 struct idct_context {
-    double cs[IDCT_SIZE / 2];
-    double ac[IDCT_SIZE / 2];
-    double as[IDCT_SIZE / 2];
-    uint8_t permute[IDCT_SIZE / 2];
+    const double *cs;
+    const double *ac;
+    const double *as;
+    const float *cs32;
+    const float *ac32;
+    const float *as32;
+    const uint8_t *permute;
+    double scale;
+    float scale32;
     int nbits;
 };
 
 struct idct_context *idct_init(void *parent, int nbits, double scale) __attribute__((cold));
 void idct_fast(const struct idct_context *s, const double *input, double *output);
+void idct_fast_float32(const struct idct_context *s, const float *input, float *output);
 void imdct_fast(const struct idct_context *s, const float *input, float *output);
 
 void idct_fixed32(int * restrict input, int * restrict output);
@@ -18,12 +18,16 @@
 
 #include "common.h"
 #include "idct.h"
-#include "cos.h"
+#include "idct_tables.h"
+
+#if HAVE_SSE2
+#include <emmintrin.h>
+#elif HAVE_SSE
+#include <xmmintrin.h>
+#endif
 
 struct idct_context *idct_init(void *parent, int nbits, double scale)
 {
-    int i, j, k, p, base;
-
     if (nbits < 2 || nbits > IDCT_BITS)
         return NULL;
 
@@ -31,36 +35,200 @@ struct idct_context *idct_init(void *parent, int nbits, double scale)
     if (!s)
         return NULL;
 
-    int m = nbits;
+    s->cs = idct_cs;
+    s->ac = idct_ac[nbits - 2];
+    s->as = idct_as[nbits - 2];
+    s->cs32 = idct_cs32;
+    s->ac32 = idct_ac32[nbits - 2];
+    s->as32 = idct_as32[nbits - 2];
+    s->permute = idct_permute[nbits - 2];
+    s->scale = scale;
+    s->scale32 = (float)scale;
+    s->nbits = nbits;
+    return s;
+}
+
+static void proc(const struct idct_context *s, double *x, int flag)
+{
+    double y[IDCT_SIZE / 2], tmp;
+    int i, j, k, p, q, base;
+
+    int m = s->nbits - 1;
     int n = 1 << m;
     int n2 = n >> 1;
-    int n4 = n >> 2;
 
-    for (i = base = 0; i < m - 1; i++, base += p) {
+    for (i = 0; i < n; i++)
+        y[i] = x[i];
+
+    for (i = m - 2; i >= 0; i--) {
+        int f0 = n >> i;
+        int f1 = f0 >> 1;
+        int f2 = f1 >> 1;
+        int f3 = ((1 << i) - 1) << 1;
+        for (j = f2; j > 0; j--) {
+            for (k = f3; k >= 0; k--) {
+                p = f0 - j + k * f1;
+                q = f1 - j + k * f1;
+                y[q] -= y[p];
+                y[p] += y[p];
+            }
+        }
+    }
+
+    for (i = 1; i < n - 1; i++) {
+        k = s->permute[i];
+        if (i < k) {
+            tmp = y[i];
+            y[i] = y[k];
+            y[k] = tmp;
+        }
+    }
+
+    for (i = base = 0; i < m; i++, base += p) {
         p = 1 << i;
-        for (j = 0; j < p; j++)
-            s->cs[base + j] = cos(M_PI * (4 * j + 1) * (n4 >> i) / n);
+        q = 2 << i;
+        for (j = 0; j < p; j++) {
+            for (k = j; k < n; k += q) {
+                tmp = y[k + p] * s->cs[base + j];
+                y[k + p] = y[k] - tmp;
+                y[k] += tmp;
+            }
+        }
     }
 
     for (i = 0; i < n2; i++) {
-        double a = M_PI * (1.0 / (n << 2) + 1.0 * i / (n << 1));
-        s->ac[i] = scale * cos(a);
-        s->as[i] = scale * sin(a);
+        x[2 * i] = y[i];
+        if (flag)
+            x[2 * i + 1] = -y[n - 1 - i];
+        else
+            x[2 * i + 1] =  y[n - 1 - i];
     }
+}
 
-    for (i = 1; i < n2 - 1; i++) {
-        for (j = k = 0; j < m - 1; j++)
-            k = (k << 1) | ((i >> j) & 1);
-        s->permute[i] = k;
+#if HAVE_SSE2
+// Both halves of the transform go through identical butterflies. The first
+// half is computed in the low lane and the second one in the high lane.
+static void proc_sse2(const struct idct_context *s, __m128d *y)
+{
+    __m128d tmp;
+    int i, j, k, p, q, base;
+
+    int m = s->nbits - 1;
+    int n = 1 << m;
+
+    for (i = m - 2; i >= 0; i--) {
+        int f1 = n >> (i + 1);
+        int f2 = f1 >> 1;
+        for (k = ((1 << i) - 1) << 1; k >= 0; k--) {
+            for (j = k * f1 + f2; j < (k + 1) * f1; j++) {
+                y[j     ] = _mm_sub_pd(y[j], y[j + f1]);
+                y[j + f1] = _mm_add_pd(y[j + f1], y[j + f1]);
+            }
+        }
     }
 
-    s->nbits = nbits;
-    return s;
+    for (i = 1; i < n - 1; i++) {
+        k = s->permute[i];
+        if (i < k) {
+            tmp = y[i];
+            y[i] = y[k];
+            y[k] = tmp;
+        }
+    }
+
+    for (i = base = 0; i < m; i++, base += p) {
+        p = 1 << i;
+        q = 2 << i;
+        for (j = 0; j < p; j++) {
+            __m128d c = _mm_set1_pd(s->cs[base + j]);
+            for (k = j; k < n; k += q) {
+                tmp = _mm_mul_pd(y[k + p], c);
+                y[k + p] = _mm_sub_pd(y[k], tmp);
+                y[k    ] = _mm_add_pd(y[k], tmp);
+            }
+        }
+    }
 }
 
-static void proc(const struct idct_context *s, double *x, int flag)
+// Deinterleave outputs 2 * i and 2 * i + 1 of proc_sse2() into vectors of
+// the first and second halves
+static inline void load_proc_sse2(const __m128d *y, int n, int i, __m128d *a, __m128d *b)
 {
-    double y[IDCT_SIZE / 2], tmp;
+    const __m128d neg = _mm_set_pd(-0.0, 0.0);
+    __m128d lo = y[i];
+    __m128d hi = _mm_xor_pd(y[n - 1 - i], neg);
+    *a = _mm_unpacklo_pd(lo, hi);
+    *b = _mm_unpackhi_pd(lo, hi);
+}
+
+static void idct_fast_sse2(const struct idct_context *s, const double *input, double *output)
+{
+    const __m128d neg = _mm_set_pd(-0.0, 0.0);
+    const __m128d scale = _mm_set1_pd(s->scale);
+    __m128d y[IDCT_SIZE / 2];
+    int i;
+
+    int m = s->nbits;
+    int n = 1 << m;
+    int n2 = n >> 1;
+
+    y[0] = _mm_set_pd(input[n - 1], input[0]);
+    for (i = 1; i < n2; i++) {
+        __m128d lo = _mm_loadu_pd(&input[2 *       i  - 1]);
+        __m128d hi = _mm_loadu_pd(&input[2 * (n2 - i) - 1]);
+        y[i] = _mm_add_pd(_mm_unpacklo_pd(lo, hi), _mm_xor_pd(_mm_unpackhi_pd(lo, hi), neg));
+    }
+
+    proc_sse2(s, y);
+
+    for (i = 0; i < n2; i += 2) {
+        __m128d a, b;
+        load_proc_sse2(y, n2, i / 2, &a, &b);
+        __m128d ac = _mm_mul_pd(_mm_loadu_pd(&s->ac[i]), scale);
+        __m128d as = _mm_mul_pd(_mm_loadu_pd(&s->as[i]), scale);
+        __m128d res1 = _mm_add_pd(_mm_mul_pd(a, ac), _mm_mul_pd(b, as));
+        __m128d res2 = _mm_sub_pd(_mm_mul_pd(a, as), _mm_mul_pd(b, ac));
+        _mm_storeu_pd(&output[i], res1);
+        _mm_storeu_pd(&output[n - 2 - i], _mm_shuffle_pd(res2, res2, 1));
+    }
+}
+#endif
+
+void idct_fast(const struct idct_context *s, const double *input, double *output)
+{
+#if HAVE_SSE2
+    idct_fast_sse2(s, input, output);
+#else
+    double a[IDCT_SIZE / 2];
+    double b[IDCT_SIZE / 2];
+    int i;
+
+    int m = s->nbits;
+    int n = 1 << m;
+    int n2 = n >> 1;
+
+    a[0] = input[0];
+    b[0] = input[n - 1];
+    for (i = 1; i < n2; i++) {
+        a[     i] = input[2 * i - 1] + input[2 * i];
+        b[n2 - i] = input[2 * i - 1] - input[2 * i];
+    }
+
+    proc(s, a, 0);
+    proc(s, b, 1);
+
+    for (i = 0; i < n2; i++) {
+        double ac = s->ac[i] * s->scale;
+        double as = s->as[i] * s->scale;
+        output[    i    ] = a[i] * ac + b[i] * as;
+        output[n - i - 1] = a[i] * as - b[i] * ac;
+    }
+#endif
+}
+
+static void proc32(const struct idct_context *s, float *x, int flag)
+{
+    float y[IDCT_SIZE / 2], tmp;
     int i, j, k, p, q, base;
 
     int m = s->nbits - 1;
@@ -99,7 +267,7 @@ static void proc(const struct idct_context *s, double *x, int flag)
         q = 2 << i;
         for (j = 0; j < p; j++) {
             for (k = j; k < n; k += q) {
-                tmp = y[k + p] * s->cs[base + j];
+                tmp = y[k + p] * s->cs32[base + j];
                 y[k + p] = y[k] - tmp;
                 y[k] += tmp;
             }
@@ -115,10 +283,141 @@ static void proc(const struct idct_context *s, double *x, int flag)
     }
 }
 
-void idct_fast(const struct idct_context *s, const double *input, double *output)
+#if HAVE_SSE
+static inline __m128 reverse_ps(__m128 a)
 {
-    double a[IDCT_SIZE / 2];
-    double b[IDCT_SIZE / 2];
+    return _mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 1, 2, 3));
+}
+
+// Same as proc32() with butterflies vectorized along the data. Requires at
+// least 16-point transform.
+static void proc32_sse(const struct idct_context *s, float *x, int flag)
+{
+    float y[IDCT_SIZE / 2];
+    int i, j, k, p, base;
+
+    int m = s->nbits - 1;
+    int n = 1 << m;
+
+    // Runs of independent differences get long enough to vectorize for
+    // the last stages only
+    for (i = m - 2; i >= 0; i--) {
+        int f1 = n >> (i + 1);
+        int f2 = f1 >> 1;
+        for (k = ((1 << i) - 1) << 1; k >= 0; k--) {
+            int end = (k + 1) * f1;
+            for (j = k * f1 + f2; j < end - 3; j += 4) {
+                __m128 a = _mm_loadu_ps(&x[j     ]);
+                __m128 b = _mm_loadu_ps(&x[j + f1]);
+                _mm_storeu_ps(&x[j     ], _mm_sub_ps(a, b));
+                _mm_storeu_ps(&x[j + f1], _mm_add_ps(b, b));
+            }
+            for (; j < end; j++) {
+                x[j     ] -= x[j + f1];
+                x[j + f1] += x[j + f1];
+            }
+        }
+    }
+
+    for (i = 0; i < n; i++)
+        y[i] = x[s->permute[i]];
+
+    // First two stages operate within groups of 4 and are done together
+    // on pairs of groups
+    const __m128 c0 = _mm_set1_ps(s->cs32[0]);
+    const __m128 c1 = _mm_set_ps(s->cs32[2], s->cs32[1], s->cs32[2], s->cs32[1]);
+    for (k = 0; k < n; k += 8) {
+        __m128 v0 = _mm_loadu_ps(&y[k    ]);
+        __m128 v1 = _mm_loadu_ps(&y[k + 4]);
+        __m128 a = _mm_shuffle_ps(v0, v1, _MM_SHUFFLE(2, 0, 2, 0));
+        __m128 b = _mm_mul_ps(_mm_shuffle_ps(v0, v1, _MM_SHUFFLE(3, 1, 3, 1)), c0);
+        __m128 sum = _mm_add_ps(a, b);
+        __m128 dif = _mm_sub_ps(a, b);
+        v0 = _mm_unpacklo_ps(sum, dif);
+        v1 = _mm_unpackhi_ps(sum, dif);
+        a = _mm_movelh_ps(v0, v1);
+        b = _mm_mul_ps(_mm_movehl_ps(v1, v0), c1);
+        sum = _mm_add_ps(a, b);
+        dif = _mm_sub_ps(a, b);
+        _mm_storeu_ps(&y[k    ], _mm_movelh_ps(sum, dif));
+        _mm_storeu_ps(&y[k + 4], _mm_movehl_ps(dif, sum));
+    }
+
+    for (i = 2, base = 3; i < m; i++, base += p) {
+        p = 1 << i;
+        for (k = 0; k < n; k += 2 * p) {
+            for (j = 0; j < p; j += 4) {
+                __m128 c = _mm_loadu_ps(&s->cs32[base + j]);
+                __m128 a = _mm_loadu_ps(&y[k + j    ]);
+                __m128 b = _mm_mul_ps(_mm_loadu_ps(&y[k + j + p]), c);
+                _mm_storeu_ps(&y[k + j    ], _mm_add_ps(a, b));
+                _mm_storeu_ps(&y[k + j + p], _mm_sub_ps(a, b));
+            }
+        }
+    }
+
+    const __m128 sign = _mm_set1_ps(flag ? -0.0f : 0.0f);
+    for (i = 0; i < n / 2; i += 4) {
+        __m128 lo = _mm_loadu_ps(&y[i]);
+        __m128 hi = _mm_xor_ps(reverse_ps(_mm_loadu_ps(&y[n - 4 - i])), sign);
+        _mm_storeu_ps(&x[2 * i    ], _mm_unpacklo_ps(lo, hi));
+        _mm_storeu_ps(&x[2 * i + 4], _mm_unpackhi_ps(lo, hi));
+    }
+}
+
+static void idct_fast_float32_sse(const struct idct_context *s, const float *input, float *output)
+{
+    const __m128 scale = _mm_set1_ps(s->scale32);
+    float a[IDCT_SIZE / 2];
+    float b[IDCT_SIZE / 2];
+    int i;
+
+    int m = s->nbits;
+    int n = 1 << m;
+    int n2 = n >> 1;
+
+    a[0] = input[0];
+    b[0] = input[n - 1];
+    for (i = 1; i < n2 - 3; i += 4) {
+        __m128 v0 = _mm_loadu_ps(&input[2 * i - 1]);
+        __m128 v1 = _mm_loadu_ps(&input[2 * i + 3]);
+        __m128 odd = _mm_shuffle_ps(v0, v1, _MM_SHUFFLE(2, 0, 2, 0));
+        __m128 even = _mm_shuffle_ps(v0, v1, _MM_SHUFFLE(3, 1, 3, 1));
+        _mm_storeu_ps(&a[i], _mm_add_ps(odd, even));
+        _mm_storeu_ps(&b[n2 - i - 3], reverse_ps(_mm_sub_ps(odd, even)));
+    }
+    for (; i < n2; i++) {
+        a[     i] = input[2 * i - 1] + input[2 * i];
+        b[n2 - i] = input[2 * i - 1] - input[2 * i];
+    }
+
+    proc32_sse(s, a, 0);
+    proc32_sse(s, b, 1);
+
+    for (i = 0; i < n2; i += 4) {
+        __m128 va = _mm_loadu_ps(&a[i]);
+        __m128 vb = _mm_loadu_ps(&b[i]);
+        __m128 ac = _mm_mul_ps(_mm_loadu_ps(&s->ac32[i]), scale);
+        __m128 as = _mm_mul_ps(_mm_loadu_ps(&s->as32[i]), scale);
+        __m128 res1 = _mm_add_ps(_mm_mul_ps(va, ac), _mm_mul_ps(vb, as));
+        __m128 res2 = _mm_sub_ps(_mm_mul_ps(va, as), _mm_mul_ps(vb, ac));
+        _mm_storeu_ps(&output[i], res1);
+        _mm_storeu_ps(&output[n - 4 - i], reverse_ps(res2));
+    }
+}
+#endif
+
+void idct_fast_float32(const struct idct_context *s, const float *input, float *output)
+{
+#if HAVE_SSE
+    if (s->nbits >= 4) {
+        idct_fast_float32_sse(s, input, output);
+        return;
+    }
+#endif
+
+    float a[IDCT_SIZE / 2];
+    float b[IDCT_SIZE / 2];
     int i;
 
     int m = s->nbits;
@@ -132,17 +431,72 @@ void idct_fast(const struct idct_context *s, const double *input, double *output
         b[n2 - i] = input[2 * i - 1] - input[2 * i];
     }
 
-    proc(s, a, 0);
-    proc(s, b, 1);
+    proc32(s, a, 0);
+    proc32(s, b, 1);
 
     for (i = 0; i < n2; i++) {
-        output[    i    ] = a[i] * s->ac[i] + b[i] * s->as[i];
-        output[n - i - 1] = a[i] * s->as[i] - b[i] * s->ac[i];
+        float ac = s->ac32[i] * s->scale32;
+        float as = s->as32[i] * s->scale32;
+        output[    i    ] = a[i] * ac + b[i] * as;
+        output[n - i - 1] = a[i] * as - b[i] * ac;
+    }
+}
+
+#if HAVE_SSE2
+// Input and output may be the same buffer
+static void imdct_fast_sse2(const struct idct_context *s, const float *input, float *output)
+{
+    const __m128d neg = _mm_set_pd(-0.0, 0.0);
+    const __m128d scale = _mm_set1_pd(s->scale);
+    const __m128 sign = _mm_set1_ps(-0.0f);
+    __m128d y[IDCT_SIZE / 2];
+    int i;
+
+    int m = s->nbits + 1;
+    int n = 1 << m;
+    int n2 = n >> 1;
+    int n4 = n >> 2;
+
+    y[0] = _mm_set_pd(input[n2 - 1], input[0]);
+    for (i = 1; i < n4; i++) {
+        __m128d lo = _mm_set_pd(input[2 * (n4 - i) - 1], input[2 * i - 1]);
+        __m128d hi = _mm_set_pd(input[2 * (n4 - i)    ], input[2 * i    ]);
+        y[i] = _mm_add_pd(lo, _mm_xor_pd(hi, neg));
+    }
+
+    proc_sse2(s, y);
+
+    // Mirrored halves of the output are written at the same time
+    for (i = 0; i < n4; i += 4) {
+        __m128d a1, b1, a2, b2;
+        load_proc_sse2(y, n4, i / 2,     &a1, &b1);
+        load_proc_sse2(y, n4, i / 2 + 1, &a2, &b2);
+        __m128d ac1 = _mm_mul_pd(_mm_loadu_pd(&s->ac[i    ]), scale);
+        __m128d ac2 = _mm_mul_pd(_mm_loadu_pd(&s->ac[i + 2]), scale);
+        __m128d as1 = _mm_mul_pd(_mm_loadu_pd(&s->as[i    ]), scale);
+        __m128d as2 = _mm_mul_pd(_mm_loadu_pd(&s->as[i + 2]), scale);
+        __m128 res1 = _mm_movelh_ps(_mm_cvtpd_ps(_mm_sub_pd(_mm_mul_pd(b1, ac1), _mm_mul_pd(a1, as1))),
+                                    _mm_cvtpd_ps(_mm_sub_pd(_mm_mul_pd(b2, ac2), _mm_mul_pd(a2, as2))));
+        __m128 res2 = _mm_movelh_ps(_mm_cvtpd_ps(_mm_add_pd(_mm_mul_pd(a1, ac1), _mm_mul_pd(b1, as1))),
+                                    _mm_cvtpd_ps(_mm_add_pd(_mm_mul_pd(a2, ac2), _mm_mul_pd(b2, as2))));
+        res2 = _mm_xor_ps(res2, sign);
+        _mm_storeu_ps(&output[n4 + i], res1);
+        _mm_storeu_ps(&output[n4 - 4 - i], _mm_xor_ps(reverse_ps(res1), sign));
+        _mm_storeu_ps(&output[n - n4 - 4 - i], reverse_ps(res2));
+        _mm_storeu_ps(&output[n - n4 + i], res2);
     }
 }
+#endif
 
 void imdct_fast(const struct idct_context *s, const float *input, float *output)
 {
+#if HAVE_SSE2
+    if (s->nbits >= 3) {
+        imdct_fast_sse2(s, input, output);
+        return;
+    }
+#endif
+
     double a[IDCT_SIZE / 2];
     double b[IDCT_SIZE / 2];
     int i;
@@ -163,8 +517,10 @@ void imdct_fast(const struct idct_context *s, const float *input, float *output)
     proc(s, b, 1);
 
     for (i = 0; i < n4; i++) {
-        output[    n4 + i    ] = -a[i] * s->as[i] + b[i] * s->ac[i];
-        output[n - n4 - i - 1] = -a[i] * s->ac[i] - b[i] * s->as[i];
+        double ac = s->ac[i] * s->scale;
+        double as = s->as[i] * s->scale;
+        output[    n4 + i    ] = -a[i] * as + b[i] * ac;
+        output[n - n4 - i - 1] = -a[i] * ac - b[i] * as;
     }
 
     for (i = 0; i < n4; i++) {
@@ -0,0 +1,286 @@
+/*
+ * This file is part of libdcadec.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation; either version 2.1 of the License, or (at your
+ * option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+// Generated by tablegen.c, do not edit
+
+#ifndef IDCT_TABLES_H
+#define IDCT_TABLES_H
+
+// Butterfly twiddles of all stages, stage i occupies 2^i entries starting
+// at 2^i - 1. Stages do not depend on the transform size.
+//
+// cos((4 * j + 1) * PI / (4 << i)), j = 0 .. 2^i
+static const double idct_cs[IDCT_SIZE / 2] = {
+     7.07106781186547573e-01,  9.23879532511286738e-01, -3.82683432365089726e-01,  9.80785280403230431e-01,
+     5.55570233019602289e-01, -1.95090322016128193e-01, -8.31469612302545347e-01,  9.95184726672196929e-01,
+     8.81921264348355050e-01,  6.34393284163645488e-01,  2.90284677254462331e-01, -9.80171403295606453e-02,
+    -4.71396736825997698e-01, -7.73010453362736993e-01, -9.56940335732208824e-01,  9.98795456205172405e-01,
+     9.70031253194543974e-01,  9.03989293123443338e-01,  8.03207531480644943e-01,  6.71558954847018330e-01,
+     5.14102744193221661e-01,  3.36889853392220051e-01,  1.46730474455361748e-01, -4.90676743274180080e-02,
+    -2.42980179903263871e-01, -4.27555093430281863e-01, -5.95699304492433357e-01, -7.40951125354958884e-01,
+    -8.57728610000272007e-01, -9.41544065183020695e-01, -9.89176509964781014e-01,  9.99698818696204250e-01,
+     9.92479534598709967e-01,  9.75702130038528570e-01,  9.49528180593036675e-01,  9.14209755703530691e-01,
+     8.70086991108711461e-01,  8.17584813151583711e-01,  7.57208846506484567e-01,  6.89540544737066941e-01,
+     6.15231590580626819e-01,  5.34997619887097264e-01,  4.49611329654606595e-01,  3.59895036534988277e-01,
+     2.66712757474898421e-01,  1.70961888760301356e-01,  7.35645635996674541e-02, -2.45412285229121424e-02,
+    -1.22410675199216154e-01, -2.19101240156869659e-01, -3.13681740398891407e-01, -4.05241314004989750e-01,
+    -4.92898192229783982e-01, -5.75808191417845339e-01, -6.53172842953776533e-01, -7.24247082951466781e-01,
+    -7.88346427626606228e-01, -8.44853565249707117e-01, -8.93224301195515213e-01, -9.32992798834738846e-01,
+    -9.63776065795439840e-01, -9.85277642388941222e-01, -9.97290456678690207e-01,
+};
+
+// Single precision version of idct_cs[]
+static const float idct_cs32[IDCT_SIZE / 2] = {
+     7.071067691e-01f,  9.238795042e-01f, -3.826834261e-01f,  9.807852507e-01f,
+     5.555702448e-01f, -1.950903237e-01f, -8.314695954e-01f,  9.951847196e-01f,
+     8.819212914e-01f,  6.343932748e-01f,  2.902846634e-01f, -9.801714122e-02f,
+    -4.713967443e-01f, -7.730104327e-01f, -9.569403529e-01f,  9.987954497e-01f,
+     9.700312614e-01f,  9.039893150e-01f,  8.032075167e-01f,  6.715589762e-01f,
+     5.141027570e-01f,  3.368898630e-01f,  1.467304677e-01f, -4.906767607e-02f,
+    -2.429801822e-01f, -4.275550842e-01f, -5.956993103e-01f, -7.409511209e-01f,
+    -8.577286005e-01f, -9.415440559e-01f, -9.891765118e-01f,  9.996988177e-01f,
+     9.924795628e-01f,  9.757021070e-01f,  9.495281577e-01f,  9.142097831e-01f,
+     8.700869679e-01f,  8.175848126e-01f,  7.572088242e-01f,  6.895405650e-01f,
+     6.152315736e-01f,  5.349976420e-01f,  4.496113360e-01f,  3.598950505e-01f,
+     2.667127550e-01f,  1.709618866e-01f,  7.356456667e-02f, -2.454122901e-02f,
+    -1.224106774e-01f, -2.191012353e-01f, -3.136817515e-01f, -4.052413106e-01f,
+    -4.928981960e-01f, -5.758081675e-01f, -6.531728506e-01f, -7.242470980e-01f,
+    -7.883464098e-01f, -8.448535800e-01f, -8.932242990e-01f, -9.329928160e-01f,
+    -9.637760520e-01f, -9.852776527e-01f, -9.972904325e-01f,
+};
+
+// Output rotations for n = 2^nbits, row nbits - 2
+//
+// cos((2 * i + 1) * PI / (4 * n)), i = 0 .. n / 2
+static const double idct_ac[IDCT_BITS - 1][IDCT_SIZE / 2] = {
+    {
+         9.80785280403230431e-01,  8.31469612302545236e-01,
+    },
+    {
+         9.95184726672196929e-01,  9.56940335732208824e-01,  8.81921264348355050e-01,  7.73010453362736993e-01,
+    },
+    {
+         9.98795456205172405e-01,  9.89176509964781014e-01,  9.70031253194543974e-01,  9.41544065183020806e-01,
+         9.03989293123443338e-01,  8.57728610000272118e-01,  8.03207531480644943e-01,  7.40951125354959106e-01,
+    },
+    {
+         9.99698818696204250e-01,  9.97290456678690207e-01,  9.92479534598709967e-01,  9.85277642388941222e-01,
+         9.75702130038528570e-01,  9.63776065795439840e-01,  9.49528180593036675e-01,  9.32992798834738957e-01,
+         9.14209755703530691e-01,  8.93224301195515324e-01,  8.70086991108711461e-01,  8.44853565249707117e-01,
+         8.17584813151583711e-01,  7.88346427626606339e-01,  7.57208846506484567e-01,  7.24247082951467003e-01,
+    },
+    {
+         9.99924701839144503e-01,  9.99322384588349544e-01,  9.98118112900149179e-01,  9.96312612182778001e-01,
+         9.93906970002356061e-01,  9.90902635427780010e-01,  9.87301418157858435e-01,  9.83105487431216285e-01,
+         9.78317370719627655e-01,  9.72939952205560177e-01,  9.66976471044852071e-01,  9.60430519415565787e-01,
+         9.53306040354193862e-01,  9.45607325380521280e-01,  9.37339011912574960e-01,  9.28506080473215589e-01,
+         9.19113851690057770e-01,  9.09167983090522380e-01,  8.98674465693953817e-01,  8.87639620402853935e-01,
+         8.76070094195406601e-01,  8.63972856121586807e-01,  8.51355193105265196e-01,  8.38224705554838079e-01,
+         8.24589302785025291e-01,  8.10457198252594768e-01,  7.95836904608883566e-01,  7.80737228572094488e-01,
+         7.65167265622458959e-01,  7.49136394523459370e-01,  7.32654271672412816e-01,  7.15730825283818595e-01,
+    },
+    {
+         9.99981175282601109e-01,  9.99830581795823403e-01,  9.99529417501093143e-01,  9.99077727752645361e-01,
+         9.98475580573294774e-01,  9.97723066644191636e-01,  9.96820299291165668e-01,  9.95767414467659817e-01,
+         9.94564570734255415e-01,  9.93211949234794500e-01,  9.91709753669099525e-01,  9.90058210262297123e-01,
+         9.88257567730749464e-01,  9.86308097244598669e-01,  9.84210092386929025e-01,  9.81963869109555243e-01,
+         9.79569765685440519e-01,  9.77028142657754395e-01,  9.74339382785575858e-01,  9.71503890986251784e-01,
+         9.68522094274417378e-01,  9.65394441697689398e-01,  9.62121404269041580e-01,  9.58703474895871599e-01,
+         9.55141168305770782e-01,  9.51435020969008338e-01,  9.47585591017741091e-01,  9.43593458161960386e-01,
+         9.39459223602189919e-01,  9.35183509938947610e-01,  9.30766961078983712e-01,  9.26210242138311379e-01,
+         9.21514039342042013e-01,  9.16679059921042705e-01,  9.11706032005429878e-01,  9.06595704514915335e-01,
+         9.01348847046022028e-01,  8.95966249756185218e-01,  8.90448723244757878e-01,  8.84797098430937790e-01,
+         8.79012226428633525e-01,  8.73094978418290091e-01,  8.67046245515692648e-01,  8.60866938637767309e-01,
+         8.54557988365400534e-01,  8.48120344803297233e-01,  8.41554977436898444e-01,  8.34862874986380010e-01,
+         8.28045045257755796e-01,  8.21102514991104648e-01,  8.14036329705948414e-01,  8.06847553543799334e-01,
+         7.99537269107905013e-01,  7.92106577300212389e-01,  7.84556597155575242e-01,  7.76888465673232442e-01,
+         7.69103337645579699e-01,  7.61202385484261779e-01,  7.53186799043612520e-01,  7.45057785441466058e-01,
+         7.36816568877369904e-01,  7.28464390448225196e-01,  7.20002507961381655e-01,  7.11432195745216434e-01,
+    },
+};
+
+// sin((2 * i + 1) * PI / (4 * n)), i = 0 .. n / 2
+static const double idct_as[IDCT_BITS - 1][IDCT_SIZE / 2] = {
+    {
+         1.95090322016128248e-01,  5.55570233019602178e-01,
+    },
+    {
+         9.80171403295606036e-02,  2.90284677254462331e-01,  4.71396736825997642e-01,  6.34393284163645488e-01,
+    },
+    {
+         4.90676743274180149e-02,  1.46730474455361748e-01,  2.42980179903263871e-01,  3.36889853392220051e-01,
+         4.27555093430282085e-01,  5.14102744193221661e-01,  5.95699304492433357e-01,  6.71558954847018330e-01,
+    },
+    {
+         2.45412285229122881e-02,  7.35645635996674263e-02,  1.22410675199216196e-01,  1.70961888760301217e-01,
+         2.19101240156869798e-01,  2.66712757474898365e-01,  3.13681740398891518e-01,  3.59895036534988111e-01,
+         4.05241314004989861e-01,  4.49611329654606540e-01,  4.92898192229784038e-01,  5.34997619887097153e-01,
+         5.75808191417845339e-01,  6.15231590580626819e-01,  6.53172842953776756e-01,  6.89540544737066829e-01,
+    },
+    {
+         1.22715382857199254e-02,  3.68072229413588317e-02,  6.13207363022085783e-02,  8.57973123444398938e-02,
+         1.10222207293883059e-01,  1.34580708507126168e-01,  1.58858143333861446e-01,  1.83039887955140951e-01,
+         2.07111376192218560e-01,  2.31058108280671110e-01,  2.54865659604514572e-01,  2.78519689385053060e-01,
+         3.02005949319228084e-01,  3.25310292162262926e-01,  3.48418680249434565e-01,  3.71317193951837543e-01,
+         3.93992040061048099e-01,  4.16429560097637153e-01,  4.38616238538527659e-01,  4.60538710958240005e-01,
+         4.82183772079122719e-01,  5.03538383725717575e-01,  5.24589682678468949e-01,  5.45324988422046464e-01,
+         5.65731810783613120e-01,  5.85797857456438864e-01,  6.05511041404325545e-01,  6.24859488142386343e-01,
+         6.43831542889791386e-01,  6.62415777590171784e-01,  6.80600997795453022e-01,  6.98376249408972916e-01,
+    },
+    {
+         6.13588464915447527e-03,  1.84067299058048202e-02,  3.06748031766366260e-02,  4.29382569349408202e-02,
+         5.51952443496899342e-02,  6.74439195636640509e-02,  7.96824379714301256e-02,  9.19089564971327239e-02,
+         1.04121633872054586e-01,  1.16318630911904752e-01,  1.28498110793793169e-01,  1.40658239332849211e-01,
+         1.52797185258443435e-01,  1.64913120489969922e-01,  1.77004220412148749e-01,  1.89068664149806193e-01,
+         2.01104634842091901e-01,  2.13110319916091362e-01,  2.25083911359792832e-01,  2.37023605994367198e-01,
+         2.48927605745720149e-01,  2.60794117915275514e-01,  2.72621355449948977e-01,  2.84407537211271877e-01,
+         2.96150888243623789e-01,  3.07849640041534867e-01,  3.19502030816015692e-01,  3.31106305759876429e-01,
+         3.42660717311994378e-01,  3.54163525420490344e-01,  3.65612997804773854e-01,  3.77007410216418259e-01,
+         3.88345046698826246e-01,  3.99624199845646788e-01,  4.10843171057903911e-01,  4.22000270799799682e-01,
+         4.33093818853151957e-01,  4.44122144570429200e-01,  4.55083587126343836e-01,  4.65976495767966181e-01,
+         4.76799230063322088e-01,  4.87550160148435996e-01,  4.98227666972781869e-01,  5.08830142543106989e-01,
+         5.19355990165589643e-01,  5.29803624686294605e-01,  5.40171472729892854e-01,  5.50457972936604811e-01,
+         5.60661576197336031e-01,  5.70780745886967256e-01,  5.80813958095764526e-01,  5.90759701858874164e-01,
+         6.00616479383868973e-01,  6.10382806276309475e-01,  6.20057211763289096e-01,  6.29638238914926984e-01,
+         6.39124444863775731e-01,  6.48514401022112441e-01,  6.57806693297078637e-01,  6.66999922303637471e-01,
+         6.76092703575315923e-01,  6.85083667772700355e-01,  6.93971460889654002e-01,  7.02754744457225300e-01,
+    },
+};
+
+// Single precision versions of idct_ac[] and idct_as[]
+static const float idct_ac32[IDCT_BITS - 1][IDCT_SIZE / 2] = {
+    {
+         9.807852507e-01f,  8.314695954e-01f,
+    },
+    {
+         9.951847196e-01f,  9.569403529e-01f,  8.819212914e-01f,  7.730104327e-01f,
+    },
+    {
+         9.987954497e-01f,  9.891765118e-01f,  9.700312614e-01f,  9.415440559e-01f,
+         9.039893150e-01f,  8.577286005e-01f,  8.032075167e-01f,  7.409511209e-01f,
+    },
+    {
+         9.996988177e-01f,  9.972904325e-01f,  9.924795628e-01f,  9.852776527e-01f,
+         9.757021070e-01f,  9.637760520e-01f,  9.495281577e-01f,  9.329928160e-01f,
+         9.142097831e-01f,  8.932242990e-01f,  8.700869679e-01f,  8.448535800e-01f,
+         8.175848126e-01f,  7.883464098e-01f,  7.572088242e-01f,  7.242470980e-01f,
+    },
+    {
+         9.999247193e-01f,  9.993223548e-01f,  9.981181026e-01f,  9.963126183e-01f,
+         9.939069748e-01f,  9.909026623e-01f,  9.873014092e-01f,  9.831054807e-01f,
+         9.783173800e-01f,  9.729399681e-01f,  9.669764638e-01f,  9.604305029e-01f,
+         9.533060193e-01f,  9.456073046e-01f,  9.373390079e-01f,  9.285060763e-01f,
+         9.191138744e-01f,  9.091680050e-01f,  8.986744881e-01f,  8.876396418e-01f,
+         8.760700822e-01f,  8.639728427e-01f,  8.513551950e-01f,  8.382247090e-01f,
+         8.245893121e-01f,  8.104571700e-01f,  7.958369255e-01f,  7.807372212e-01f,
+         7.651672363e-01f,  7.491363883e-01f,  7.326542735e-01f,  7.157308459e-01f,
+    },
+    {
+         9.999811649e-01f,  9.998306036e-01f,  9.995294213e-01f,  9.990777373e-01f,
+         9.984755516e-01f,  9.977230430e-01f,  9.968202710e-01f,  9.957674146e-01f,
+         9.945645928e-01f,  9.932119250e-01f,  9.917097688e-01f,  9.900581837e-01f,
+         9.882575870e-01f,  9.863080978e-01f,  9.842100739e-01f,  9.819638729e-01f,
+         9.795697927e-01f,  9.770281315e-01f,  9.743393660e-01f,  9.715039134e-01f,
+         9.685220718e-01f,  9.653944373e-01f,  9.621214271e-01f,  9.587034583e-01f,
+         9.551411867e-01f,  9.514350295e-01f,  9.475855827e-01f,  9.435934424e-01f,
+         9.394592047e-01f,  9.351835251e-01f,  9.307669401e-01f,  9.262102246e-01f,
+         9.215140343e-01f,  9.166790843e-01f,  9.117060304e-01f,  9.065957069e-01f,
+         9.013488293e-01f,  8.959662318e-01f,  8.904487491e-01f,  8.847970963e-01f,
+         8.790122271e-01f,  8.730949759e-01f,  8.670462370e-01f,  8.608669639e-01f,
+         8.545579910e-01f,  8.481203318e-01f,  8.415549994e-01f,  8.348628879e-01f,
+         8.280450702e-01f,  8.211025000e-01f,  8.140363097e-01f,  8.068475723e-01f,
+         7.995372415e-01f,  7.921065688e-01f,  7.845565677e-01f,  7.768884897e-01f,
+         7.691033483e-01f,  7.612023950e-01f,  7.531868219e-01f,  7.450577617e-01f,
+         7.368165851e-01f,  7.284643650e-01f,  7.200025320e-01f,  7.114322186e-01f,
+    },
+};
+
+static const float idct_as32[IDCT_BITS - 1][IDCT_SIZE / 2] = {
+    {
+         1.950903237e-01f,  5.555702448e-01f,
+    },
+    {
+         9.801714122e-02f,  2.902846634e-01f,  4.713967443e-01f,  6.343932748e-01f,
+    },
+    {
+         4.906767607e-02f,  1.467304677e-01f,  2.429801822e-01f,  3.368898630e-01f,
+         4.275550842e-01f,  5.141027570e-01f,  5.956993103e-01f,  6.715589762e-01f,
+    },
+    {
+         2.454122901e-02f,  7.356456667e-02f,  1.224106774e-01f,  1.709618866e-01f,
+         2.191012353e-01f,  2.667127550e-01f,  3.136817515e-01f,  3.598950505e-01f,
+         4.052413106e-01f,  4.496113360e-01f,  4.928981960e-01f,  5.349976420e-01f,
+         5.758081675e-01f,  6.152315736e-01f,  6.531728506e-01f,  6.895405650e-01f,
+    },
+    {
+         1.227153838e-02f,  3.680722415e-02f,  6.132073700e-02f,  8.579730988e-02f,
+         1.102222055e-01f,  1.345807016e-01f,  1.588581502e-01f,  1.830398887e-01f,
+         2.071113735e-01f,  2.310581058e-01f,  2.548656464e-01f,  2.785196900e-01f,
+         3.020059466e-01f,  3.253102899e-01f,  3.484186828e-01f,  3.713172078e-01f,
+         3.939920366e-01f,  4.164295495e-01f,  4.386162460e-01f,  4.605387151e-01f,
+         4.821837842e-01f,  5.035383701e-01f,  5.245896578e-01f,  5.453249812e-01f,
+         5.657318234e-01f,  5.857978463e-01f,  6.055110693e-01f,  6.248595119e-01f,
+         6.438315511e-01f,  6.624158025e-01f,  6.806010008e-01f,  6.983762383e-01f,
+    },
+    {
+         6.135884672e-03f,  1.840673015e-02f,  3.067480400e-02f,  4.293825850e-02f,
+         5.519524589e-02f,  6.744392216e-02f,  7.968243957e-02f,  9.190895408e-02f,
+         1.041216329e-01f,  1.163186282e-01f,  1.284981072e-01f,  1.406582445e-01f,
+         1.527971923e-01f,  1.649131179e-01f,  1.770042181e-01f,  1.890686601e-01f,
+         2.011046410e-01f,  2.131103128e-01f,  2.250839174e-01f,  2.370236069e-01f,
+         2.489276081e-01f,  2.607941031e-01f,  2.726213634e-01f,  2.844075263e-01f,
+         2.961508930e-01f,  3.078496456e-01f,  3.195020258e-01f,  3.311063051e-01f,
+         3.426607251e-01f,  3.541635275e-01f,  3.656129837e-01f,  3.770074248e-01f,
+         3.883450329e-01f,  3.996241987e-01f,  4.108431637e-01f,  4.220002592e-01f,
+         4.330938160e-01f,  4.441221356e-01f,  4.550835788e-01f,  4.659765065e-01f,
+         4.767992198e-01f,  4.875501692e-01f,  4.982276559e-01f,  5.088301301e-01f,
+         5.193560123e-01f,  5.298036337e-01f,  5.401714444e-01f,  5.504579544e-01f,
+         5.606615543e-01f,  5.707807541e-01f,  5.808139443e-01f,  5.907596946e-01f,
+         6.006164551e-01f,  6.103827953e-01f,  6.200572252e-01f,  6.296382546e-01f,
+         6.391244531e-01f,  6.485143900e-01f,  6.578066945e-01f,  6.669999361e-01f,
+         6.760926843e-01f,  6.850836873e-01f,  6.939714551e-01f,  7.027547359e-01f,
+    },
+};
+
+// Bit reversal permutation of nbits - 1 bit indices, row nbits - 2
+static const uint8_t idct_permute[IDCT_BITS - 1][IDCT_SIZE / 2] = {
+    {
+         0,  1,
+    },
+    {
+         0,  2,  1,  3,
+    },
+    {
+         0,  4,  2,  6,  1,  5,  3,  7,
+    },
+    {
+         0,  8,  4, 12,  2, 10,  6, 14,  1,  9,  5, 13,  3, 11,  7, 15,
+    },
+    {
+         0, 16,  8, 24,  4, 20, 12, 28,  2, 18, 10, 26,  6, 22, 14, 30,
+         1, 17,  9, 25,  5, 21, 13, 29,  3, 19, 11, 27,  7, 23, 15, 31,
+    },
+    {
+         0, 32, 16, 48,  8, 40, 24, 56,  4, 36, 20, 52, 12, 44, 28, 60,
+         2, 34, 18, 50, 10, 42, 26, 58,  6, 38, 22, 54, 14, 46, 30, 62,
+         1, 33, 17, 49,  9, 41, 25, 57,  5, 37, 21, 53, 13, 45, 29, 61,
+         3, 35, 19, 51, 11, 43, 27, 59,  7, 39, 23, 55, 15, 47, 31, 63,
+    },
+};
+
+#endif
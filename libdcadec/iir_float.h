@@ -0,0 +1,464 @@
+/*
+ * This file is part of libdcadec.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation; either version 2.1 of the License, or (at your
+ * option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+// Generated by tablegen.c, do not edit
+
+#ifndef IIR_FLOAT_H
+#define IIR_FLOAT_H
+
+// LFE interpolation IIR in state-space form. Between two decimated samples
+// the input is zero, so one block of 64 or 128 interpolated samples and the
+// filter history after it are linear functions of the history before it
+// (rows 0-5) and of the decimated input sample (row 6).
+//
+// Response of the cascade of three biquad sections in tablegen.c to a unit
+// value in each row, with the input scale folded into row 6.
+
+static const double lfe_iir_64_output[7][64] = {
+    {
+         3.01469133563009306e-02, -5.76571205956270122e-03, -3.96233291625115586e-02, -7.17394307127212361e-02,
+        -1.02411769838912481e-01, -1.31923222793904393e-01, -1.60542618478560883e-01, -1.88525535585463588e-01,
+        -2.16115068198597271e-01, -2.43542560670395147e-01, -2.71028312582885178e-01, -2.98782254585105989e-01,
+        -3.27004595884611504e-01, -3.55886444156821469e-01, -3.85610398621899719e-01, -4.16351117025008932e-01,
+        -4.48275857242531828e-01, -4.81544994222613099e-01, -5.16312512956112357e-01, -5.52726478160053603e-01,
+        -5.90929481343252405e-01, -6.31059065910811512e-01, -6.73248130951741075e-01, -7.17625314341134413e-01,
+        -7.64315355776545857e-01, -8.13439440355935517e-01, -8.65115523292189437e-01, -9.19458636348082337e-01,
+        -9.76581176563470876e-01, -1.03659317783497329e+00, -1.09960256589771177e+00, -1.16571539724637319e+00,
+        -1.23503608252318031e+00, -1.30766759488804496e+00, -1.38371166387707945e+00, -1.46326895524325096e+00,
+        -1.54643923726450794e+00, -1.63332153399235835e+00, -1.72401426590559481e+00, -1.81861537842274856e+00,
+        -1.91722245871733321e+00, -2.01993284127007655e+00, -2.12684370258318722e+00, -2.23805214547189735e+00,
+        -2.35365527333914315e+00, -2.47375025483057698e+00, -2.59843437925746912e+00, -2.72780510316579239e+00,
+        -2.86196008842421179e+00, -3.00099723218977488e+00, -3.14501468910350468e+00, -3.29411088606661906e+00,
+        -3.44838452992541988e+00, -3.60793460839954605e+00, -3.77286038457236828e+00, -3.94326138525150327e+00,
+        -4.11923738351424618e+00, -4.30088837572111515e+00, -4.48831455330116569e+00, -4.68161626958135457e+00,
+        -4.88089400193780421e+00, -5.08624830953658602e+00, -5.29777978693073237e+00, -5.51558901375028654e+00,
+    },
+    {
+         5.26825034982714158e-03,  4.04085935301745150e-02,  7.37475626946672014e-02,  1.05592576243848102e-01,
+         1.36235703425123811e-01,  1.65954519694369695e-01,  1.95012928692983589e-01,  2.23661951702634809e-01,
+         2.52140485424548366e-01,  2.80676028915055831e-01,  3.09485380494167295e-01,  3.38775305429102502e-01,
+         3.68743175180256344e-01,  3.99577578982462711e-01,  4.31458908520362172e-01,  4.64559916442581766e-01,
+         4.99046249445502355e-01,  5.35076956643834478e-01,  5.72804973931518191e-01,  6.12377585023359927e-01,
+         6.53936859854312047e-01,  6.97620071000720543e-01,  7.43560088774749772e-01,  7.91885755630460153e-01,
+         8.42722240507995934e-01,  8.96191373729195107e-01,  9.52411963046856158e-01,  1.01150009143681530e+00,
+         1.07356939721066169e+00,  1.13873133701576990e+00,  1.20709543227624749e+00,  1.27876949961938635e+00,
+         1.35385986581783868e+00,  1.43247156777024998e+00,  1.51470853802973693e+00,  1.60067377637889763e+00,
+         1.69046950794091799e+00,  1.78419732830502653e+00,  1.88195833613355035e+00,  1.98385325370907140e+00,
+         2.08998253586958072e+00,  2.20044646776779018e+00,  2.31534525188681073e+00,  2.43477908472505078e+00,
+         2.55884822356557606e+00,  2.68765304372556102e+00,  2.82129408667702819e+00,  2.95987209942290974e+00,
+         3.10348806549995970e+00,  3.25224322796975684e+00,  3.40623910475824232e+00,  3.56557749668581891e+00,
+         3.73036048853248303e+00,  3.90069044345750626e+00,  4.07666999111165751e+00,  4.25840200973800620e+00,
+         4.44598960258520037e+00,  4.63953606891527670e+00,  4.83914486991125159e+00,  5.04491958975791022e+00,
+         5.25696389217500837e+00,  5.47538147267505337e+00,  5.70027600680009527e+00,  5.93175109459934902e+00,
+    },
+    {
+         2.12061461279183794e-02,  1.61685012831862193e-02,  1.13075074944373327e-02,  6.60951971459167176e-03,
+         2.06121164980016536e-03, -2.35042578523070311e-03, -6.63808608650812149e-03, -1.08141488528429308e-02,
+        -1.48906815490633671e-02, -1.88794413385991455e-02, -2.27918769837328061e-02, -2.66391308118388848e-02,
+        -3.04320407458761322e-02, -3.41811423975232898e-02, -3.78966712212050194e-02, -4.15885647274385206e-02,
+        -4.52664647538010279e-02, -4.89397197919285709e-02, -5.26173873688773330e-02, -5.63082364813205505e-02,
+        -6.00207500809040173e-02, -6.37631276092367472e-02, -6.75432875809525157e-02, -7.13688702132126984e-02,
+        -7.52472401002544089e-02, -7.91854889313317045e-02, -8.31904382505452844e-02, -8.72686422571415932e-02,
+        -9.14263906447914110e-02, -9.56697114781821512e-02, -1.00004374105825633e-01, -1.04435892107275663e-01,
+        -1.08969526273538619e-01, -1.13610287619254180e-01, -1.18362940425114971e-01, -1.23232005309283466e-01,
+        -1.28221762326361954e-01, -1.33336254092622397e-01, -1.38579288935964939e-01, -1.43954444069631649e-01,
+        -1.49465068787964839e-01, -1.55114287683215224e-01, -1.60905003881957498e-01, -1.66839902299955156e-01,
+        -1.72921452914039264e-01, -1.79151914050024175e-01, -1.85533335685256873e-01, -1.92067562764648869e-01,
+        -1.98756238528808638e-01, -2.05600807853819845e-01, -2.12602520600228218e-01, -2.19762434971443099e-01,
+        -2.27081420879514440e-01, -2.34560163317603099e-01, -2.42199165737815747e-01, -2.49998753433573029e-01,
+        -2.57959076925132536e-01, -2.66080115347449464e-01, -2.74361679839472572e-01, -2.82803416933120388e-01,
+        -2.91404811942271635e-01, -3.00165192349084009e-01, -3.09083731188394495e-01, -3.18159450427614843e-01,
+    },
+    {
+        -1.66301484575850367e-02, -1.16120420496634846e-02, -6.76084749587665956e-03, -2.06295885088686459e-03,
+         2.49490590602818862e-03,  6.92570652620058680e-03,  1.12420822211838356e-02,  1.54563534649527767e-02,
+         1.95805238669519155e-02,  2.36262821142532442e-02,  2.76050039810266934e-02,  3.15277544037030205e-02,
+         3.54052896199996969e-02,  3.92480593702111413e-02,  4.30662091589602003e-02,  4.68695825758836948e-02,
+         5.06677236734309755e-02,  5.44698794002216324e-02,  5.82850020883058928e-02,  6.21217519926782202e-02,
+         6.59884998814415091e-02,  6.98933296750281485e-02,  7.38440411329586155e-02,  7.78481525862897428e-02,
+         8.19129037147314776e-02,  8.60452583661892589e-02,  9.02519074178478320e-02,  9.45392716768704844e-02,
+         9.89135048193574562e-02,  1.03380496366060726e-01,  1.07945874693399446e-01,  1.12615010078242150e-01,
+         1.17393017775174968e-01,  1.22284761124525687e-01,  1.27294854690152448e-01,  1.32427667425162099e-01,
+         1.37687325864483512e-01,  1.43077717342777078e-01,  1.48602493236392519e-01,  1.54265072228003675e-01,
+         1.60068643592531146e-01,  1.66016170503226590e-01,  1.72110393356419422e-01,  1.78353833113789051e-01,
+         1.84748794660848148e-01,  1.91297370180365078e-01,  1.98001442539535333e-01,  2.04862688689708250e-01,
+         2.11882583077361630e-01,  2.19062401065293955e-01,  2.26403222362726808e-01,  2.33905934463280119e-01,
+         2.41571236089534125e-01,  2.49399640643247267e-01,  2.57391479659986544e-01,  2.65546906267161376e-01,
+         2.73865898644160666e-01,  2.82348263484138329e-01,  2.90993639455550124e-01,  2.99801500663051002e-01,
+         3.08771160106601883e-01,  3.17901773137634791e-01,  3.27192340911551582e-01,  3.36641713835220457e-01,
+    },
+    {
+         7.49038629235043718e-03,  5.10085470330401414e-03,  2.72804381717728361e-03,  3.72376282824937732e-04,
+        -1.96573237518116173e-03, -4.28587379914446842e-03, -6.58764683883461544e-03, -8.87065759014760147e-03,
+        -1.11345194317706842e-02, -1.33788530599154853e-02, -1.56032865210757876e-02, -1.78074552428650890e-02,
+        -1.99910020629197049e-02, -2.21535772558425492e-02, -2.42948385582728577e-02, -2.64144511920072489e-02,
+        -2.85120878852502813e-02, -3.05874288919412152e-02, -3.26401620092298117e-02, -3.46699825930372185e-02,
+        -3.66765935718191827e-02, -3.86597054584107980e-02, -4.06190363600771320e-02, -4.25543119866986785e-02,
+        -4.44652656571982163e-02, -4.63516383040776248e-02, -4.82131784762245275e-02, -5.00496423399603430e-02,
+        -5.18607936782196077e-02, -5.36464038880914984e-02, -5.54062519765743389e-02, -5.71401245545501979e-02,
+        -5.88478158291749764e-02, -6.05291275944424001e-02, -6.21838692201350796e-02, -6.38118576391057957e-02,
+        -6.54129173329067726e-02, -6.69868803157598336e-02, -6.85335861169029670e-02, -7.00528817613985666e-02,
+        -7.15446217492825554e-02, -7.30086680331538673e-02, -7.44448899943037645e-02, -7.58531644170901131e-02,
+        -7.72333754621143953e-02, -7.85854146375868368e-02, -7.99091807693628198e-02, -8.12045799695084725e-02,
+        -8.24715256034949107e-02, -8.37099382556800720e-02, -8.49197456937176298e-02, -8.61008828313885033e-02,
+        -8.72532916901249678e-02, -8.83769213590923641e-02, -8.94717279540842014e-02, -9.05376745749961742e-02,
+        -9.15747312619927811e-02, -9.25828749504873372e-02, -9.35620894248359036e-02, -9.45123652707167139e-02,
+        -9.54336998263727310e-02, -9.63260971327315474e-02, -9.71895678821326214e-02, -9.80241293661308077e-02,
+    },
+    {
+        -5.13935042326596481e-03, -2.74863213363385483e-03, -3.75186575205077588e-04,  1.98056759152098749e-03,
+         4.31821892700057219e-03,  6.63736325356545365e-03,  8.93760369434648538e-03,  1.12185507102324777e-02,
+         1.34798221348582103e-02,  1.57210432076180240e-02,  1.79418466047334135e-02,  2.01418724683612993e-02,
+         2.23207684337527468e-02,  2.44781896545234190e-02,  2.66137988259220748e-02,  2.87272662062623141e-02,
+         3.08182696363843434e-02,  3.28864945572640011e-02,  3.49316340257104230e-02,  3.69533887281967566e-02,
+         3.89514669928381352e-02,  4.09255847994636213e-02,  4.28754657879153456e-02,  4.48008412645002352e-02,
+         4.67014502065303816e-02,  4.85770392652611349e-02,  5.04273627667899405e-02,  5.22521827113386905e-02,
+         5.40512687707774830e-02,  5.58243982842583364e-02,  5.75713562522572886e-02,  5.92919353288152706e-02,
+         6.09859358120736772e-02,  6.26531656331614784e-02,  6.42934403433415014e-02,  6.59065830995295698e-02,
+         6.74924246481829471e-02,  6.90508033074763716e-02,  7.05815649479859530e-02,  7.20845629716535541e-02,
+         7.35596582892839024e-02,  7.50067192963399521e-02,  7.64256218473562399e-02,  7.78162492286682550e-02,
+         7.91784921296923017e-02,  8.05122486127274328e-02,  8.18174240813434039e-02,  8.30939312470917457e-02,
+         8.43416900950373361e-02,  8.55606278477196724e-02,  8.67506789276930590e-02,  8.79117849188162381e-02,
+         8.90438945260640935e-02,  9.01469635340319542e-02,  9.12209547641325003e-02,  9.22658380304213210e-02,
+         9.32815900942642884e-02,  9.42681946176051611e-02,  9.52256421150963206e-02,  9.61539299049007923e-02,
+         9.70530620584000303e-02,  9.79230493486653586e-02,  9.87639091977712269e-02,  9.95756656229360715e-02,
+    },
+    {
+         1.98581611401998188e-03, -3.27684452343561874e-05,  5.17263779757212369e-05,  1.32278246920223413e-04,
+         2.09523825535412253e-04,  2.84068668246715075e-04,  3.56488921927760119e-04,  4.27332961707667380e-04,
+         4.97122962335262708e-04,  5.66356406778364962e-04,  6.35507533706426708e-04,  7.05028725474989015e-04,
+         7.75351838201092380e-04,  8.46889475489852328e-04,  9.20036207343828683e-04,  9.95169735758638652e-04,
+         1.07265200848016828e-03,  1.15283028237164742e-03,  1.23603813781118788e-03,  1.32259644551395439e-03,
+         1.41281428714633284e-03,  1.50698983107397377e-03,  1.60541116455867328e-03,  1.70835708369490580e-03,
+         1.81609784235112204e-03,  1.92889586135494562e-03,  2.04700639914007221e-03,  2.17067818504501631e-03,
+         2.30015401643246520e-03,  2.43567132077227022e-03,  2.57746268381270349e-03,  2.72575634493404939e-03,
+         2.88077666076291816e-03,  3.04274453810143841e-03,  3.21187783720261466e-03,  3.38839174639815610e-03,
+         3.57249912907642297e-03,  3.76441084396716974e-03,  3.96433603968993076e-03,  4.17248242448708950e-03,
+         4.38905651204857250e-03,  4.61426384431806724e-03,  4.84830919214329636e-03,  5.09139673462222220e-03,
+         5.34373021797118763e-03,  5.60551309472612225e-03,  5.87694864407017903e-03,  6.15824007405518792e-03,
+         6.44959060648186977e-03,  6.75120354516844934e-03,  7.06328232833186576e-03,  7.38603056578424066e-03,
+         7.71965206163205409e-03,  8.06435082314571616e-03,  8.42033105645767499e-03,  8.78779714971789083e-03,
+         9.16695364434150228e-03,  9.55800519493754663e-03,  9.96115651853202166e-03,  1.03766123336352933e-02,
+         1.08045772897309433e-02,  1.12452558877373932e-02,  1.16988523919463461e-02,  1.21655707340000419e-02,
+    },
+};
+
+static const double lfe_iir_64_state[7][6] = {
+    {
+        -2.33655801930883058e+01, -2.33666878603180983e+01, -6.10429127288074710e+02, -6.31558017235434590e+02,
+        -1.19078402931210144e+03, -1.25484793005316260e+03,
+    },
+    {
+         2.40930179860353277e+01,  2.40881261510171960e+01,  6.52116563747266127e+02,  6.74139457774970310e+02,
+         1.29826890978597817e+03,  1.36704002442328806e+03,
+    },
+    {
+         0.00000000000000000e+00,  0.00000000000000000e+00, -2.91306860170978936e+01, -2.91962044593687935e+01,
+        -9.17212769146021287e+01, -9.57025500102652984e+01,
+    },
+    {
+         0.00000000000000000e+00,  0.00000000000000000e+00,  2.98287574486389850e+01,  2.98871385432593932e+01,
+         9.87147496656913574e+01,  1.02870675770533836e+02,
+    },
+    {
+         0.00000000000000000e+00,  0.00000000000000000e+00,  0.00000000000000000e+00,  0.00000000000000000e+00,
+        -4.27006726153046330e+01, -4.30044089636675793e+01,
+    },
+    {
+         0.00000000000000000e+00,  0.00000000000000000e+00,  0.00000000000000000e+00,  0.00000000000000000e+00,
+         4.33289596087841744e+01,  4.36226910932030165e+01,
+    },
+    {
+         4.78420353555125133e-02,  4.78443033520412689e-02,  1.31081863398730936e+00,  1.35421800771135858e+00,
+         2.72005377685575578e+00,  2.86019600815655028e+00,
+    },
+};
+
+static const double lfe_iir_128_output[7][128] = {
+    {
+         3.01469133563009306e-02, -5.76571205956270122e-03, -3.96233291625115586e-02, -7.17394307127212361e-02,
+        -1.02411769838912481e-01, -1.31923222793904393e-01, -1.60542618478560883e-01, -1.88525535585463588e-01,
+        -2.16115068198597271e-01, -2.43542560670395147e-01, -2.71028312582885178e-01, -2.98782254585105989e-01,
+        -3.27004595884611504e-01, -3.55886444156821469e-01, -3.85610398621899719e-01, -4.16351117025008932e-01,
+        -4.48275857242531828e-01, -4.81544994222613099e-01, -5.16312512956112357e-01, -5.52726478160053603e-01,
+        -5.90929481343252405e-01, -6.31059065910811512e-01, -6.73248130951741075e-01, -7.17625314341134413e-01,
+        -7.64315355776545857e-01, -8.13439440355935517e-01, -8.65115523292189437e-01, -9.19458636348082337e-01,
+        -9.76581176563470876e-01, -1.03659317783497329e+00, -1.09960256589771177e+00, -1.16571539724637319e+00,
+        -1.23503608252318031e+00, -1.30766759488804496e+00, -1.38371166387707945e+00, -1.46326895524325096e+00,
+        -1.54643923726450794e+00, -1.63332153399235835e+00, -1.72401426590559481e+00, -1.81861537842274856e+00,
+        -1.91722245871733321e+00, -2.01993284127007655e+00, -2.12684370258318722e+00, -2.23805214547189735e+00,
+        -2.35365527333914315e+00, -2.47375025483057698e+00, -2.59843437925746912e+00, -2.72780510316579239e+00,
+        -2.86196008842421179e+00, -3.00099723218977488e+00, -3.14501468910350468e+00, -3.29411088606661906e+00,
+        -3.44838452992541988e+00, -3.60793460839954605e+00, -3.77286038457236828e+00, -3.94326138525150327e+00,
+        -4.11923738351424618e+00, -4.30088837572111515e+00, -4.48831455330116569e+00, -4.68161626958135457e+00,
+        -4.88089400193780421e+00, -5.08624830953658602e+00, -5.29777978693073237e+00, -5.51558901375028654e+00,
+        -5.73977650075653401e+00, -5.97044263247516938e+00, -6.20768760666555863e+00, -6.45161137083277936e+00,
+        -6.70231355601777068e+00, -6.95989340807454937e+00, -7.22444971663753677e+00, -7.49608074199613839e+00,
+        -7.77488414005165396e+00, -8.06095688556797541e+00, -8.35439519388637564e+00, -8.65529444128969772e+00,
+        -8.96374908418374616e+00, -9.27985257727959834e+00, -9.60369729090916735e+00, -9.93537442766819368e+00,
+        -1.02749739385094472e+01, -1.06225844384448465e+01, -1.09782931220079263e+01, -1.13421856785862474e+01,
+        -1.17143462077915501e+01, -1.20948571349690610e+01, -1.24837991269728263e+01, -1.28812510083416782e+01,
+        -1.32872896779708753e+01, -1.37019900263940144e+01, -1.41254248537979947e+01, -1.45576647888328807e+01,
+        -1.49987782083680941e+01, -1.54488311582308597e+01, -1.59078872750569644e+01, -1.63760077093338623e+01,
+        -1.68532510496943360e+01, -1.73396732485562097e+01, -1.78353275491808745e+01, -1.83402644142397548e+01,
+        -1.88545314558896280e+01, -1.93781733675195937e+01, -1.99112318571369542e+01, -2.04537455825138750e+01,
+        -2.10057500881111991e+01, -2.15672777438485355e+01, -2.21383576857633670e+01, -2.27190157585882844e+01,
+        -2.33092744603372921e+01, -2.39091528888729954e+01, -2.45186666905392485e+01, -2.51378280108674517e+01,
+        -2.57666454474074271e+01, -2.64051240047156170e+01, -2.70532650514651323e+01, -2.77110662797877012e+01,
+        -2.83785216668220528e+01, -2.90556214384723717e+01, -2.97423520354568609e+01, -3.04386960815463681e+01,
+        -3.11446323541513266e+01, -3.18601357571569679e+01, -3.25851772960213566e+01, -3.33197240552253788e+01,
+        -3.40637391779946483e+01, -3.48171818482915114e+01, -3.55800072751735570e+01, -3.63521666794003977e+01,
+    },
+    {
+         5.26825034982714158e-03,  4.04085935301745150e-02,  7.37475626946672014e-02,  1.05592576243848102e-01,
+         1.36235703425123811e-01,  1.65954519694369695e-01,  1.95012928692983589e-01,  2.23661951702634809e-01,
+         2.52140485424548366e-01,  2.80676028915055831e-01,  3.09485380494167295e-01,  3.38775305429102502e-01,
+         3.68743175180256344e-01,  3.99577578982462711e-01,  4.31458908520362172e-01,  4.64559916442581766e-01,
+         4.99046249445502355e-01,  5.35076956643834478e-01,  5.72804973931518191e-01,  6.12377585023359927e-01,
+         6.53936859854312047e-01,  6.97620071000720543e-01,  7.43560088774749772e-01,  7.91885755630460153e-01,
+         8.42722240507995934e-01,  8.96191373729195107e-01,  9.52411963046856158e-01,  1.01150009143681530e+00,
+         1.07356939721066169e+00,  1.13873133701576990e+00,  1.20709543227624749e+00,  1.27876949961938635e+00,
+         1.35385986581783868e+00,  1.43247156777024998e+00,  1.51470853802973693e+00,  1.60067377637889763e+00,
+         1.69046950794091799e+00,  1.78419732830502653e+00,  1.88195833613355035e+00,  1.98385325370907140e+00,
+         2.08998253586958072e+00,  2.20044646776779018e+00,  2.31534525188681073e+00,  2.43477908472505078e+00,
+         2.55884822356557606e+00,  2.68765304372556102e+00,  2.82129408667702819e+00,  2.95987209942290974e+00,
+         3.10348806549995970e+00,  3.25224322796975684e+00,  3.40623910475824232e+00,  3.56557749668581891e+00,
+         3.73036048853248303e+00,  3.90069044345750626e+00,  4.07666999111165751e+00,  4.25840200973800620e+00,
+         4.44598960258520037e+00,  4.63953606891527670e+00,  4.83914486991125159e+00,  5.04491958975791022e+00,
+         5.25696389217500837e+00,  5.47538147267505337e+00,  5.70027600680009527e+00,  5.93175109459934902e+00,
+         6.16991020159002801e+00,  6.41485659644240513e+00,  6.66669328563261843e+00,  6.92552294527217782e+00,
+         7.19144785035405221e+00,  7.46456980162020045e+00,  7.74499005026063969e+00,  8.03280922064618608e+00,
+         8.32812723129063670e+00,  8.63104321423952570e+00,  8.94165543305734900e+00,  9.26006119959947682e+00,
+         9.58635678974860639e+00,  9.92063735826741322e+00,  1.02629968529422513e+01,  1.06135279281702424e+01,
+         1.09723218581443689e+01,  1.13394684497725393e+01,  1.17150559554956999e+01,  1.20991709861018535e+01,
+         1.24918984237187942e+01,  1.28933213350633196e+01,  1.33035208851056268e+01,  1.37225762512421170e+01,
+         1.41505645381057548e+01,  1.45875606931103903e+01,  1.50336374228490968e+01,  1.54888651104211021e+01,
+         1.59533117338251031e+01,  1.64270427854444279e+01,  1.69101211928027624e+01,  1.74026072405740706e+01,
+         1.79045584940195113e+01,  1.84160297238504427e+01,  1.89370728326539393e+01,  1.94677367828917340e+01,
+         2.00080675265971877e+01,  2.05581079367811981e+01,  2.11178977406316335e+01,  2.16874734545717729e+01,
+         2.22668683211932148e+01,  2.28561122481432903e+01,  2.34552317490260975e+01,  2.40642498862998764e+01,
+         2.46831862162844118e+01,  2.53120567362584552e+01,  2.59508738337171962e+01,  2.65996462378188880e+01,
+         2.72583789729869750e+01,  2.79270733148350701e+01,  2.86057267482628959e+01,  2.92943329279041791e+01,
+         2.99928816407955310e+01,  3.07013587714482128e+01,  3.14197462691900000e+01,  3.21480221178662759e+01,
+         3.28861603078858025e+01,  3.36341308106548240e+01,  3.43918995553394780e+01,  3.51594284080365469e+01,
+         3.59366751532561466e+01,  3.67235934778655064e+01,  3.75201329573046678e+01,  3.83262390442469041e+01,
+    },
+    {
+         2.12061461279183794e-02,  1.61685012831862193e-02,  1.13075074944373327e-02,  6.60951971459167176e-03,
+         2.06121164980016536e-03, -2.35042578523070311e-03, -6.63808608650812149e-03, -1.08141488528429308e-02,
+        -1.48906815490633671e-02, -1.88794413385991455e-02, -2.27918769837328061e-02, -2.66391308118388848e-02,
+        -3.04320407458761322e-02, -3.41811423975232898e-02, -3.78966712212050194e-02, -4.15885647274385206e-02,
+        -4.52664647538010279e-02, -4.89397197919285709e-02, -5.26173873688773330e-02, -5.63082364813205505e-02,
+        -6.00207500809040173e-02, -6.37631276092367472e-02, -6.75432875809525157e-02, -7.13688702132126984e-02,
+        -7.52472401002544089e-02, -7.91854889313317045e-02, -8.31904382505452844e-02, -8.72686422571415932e-02,
+        -9.14263906447914110e-02, -9.56697114781821512e-02, -1.00004374105825633e-01, -1.04435892107275663e-01,
+        -1.08969526273538619e-01, -1.13610287619254180e-01, -1.18362940425114971e-01, -1.23232005309283466e-01,
+        -1.28221762326361954e-01, -1.33336254092622397e-01, -1.38579288935964939e-01, -1.43954444069631649e-01,
+        -1.49465068787964839e-01, -1.55114287683215224e-01, -1.60905003881957498e-01, -1.66839902299955156e-01,
+        -1.72921452914039264e-01, -1.79151914050024175e-01, -1.85533335685256873e-01, -1.92067562764648869e-01,
+        -1.98756238528808638e-01, -2.05600807853819845e-01, -2.12602520600228218e-01, -2.19762434971443099e-01,
+        -2.27081420879514440e-01, -2.34560163317603099e-01, -2.42199165737815747e-01, -2.49998753433573029e-01,
+        -2.57959076925132536e-01, -2.66080115347449464e-01, -2.74361679839472572e-01, -2.82803416933120388e-01,
+        -2.91404811942271635e-01, -3.00165192349084009e-01, -3.09083731188394495e-01, -3.18159450427614843e-01,
+        -3.27391224342918008e-01, -3.36777782888745492e-01, -3.46317715061928766e-01, -3.56009472257511561e-01,
+        -3.65851371616983556e-01, -3.75841599366864898e-01, -3.85978214147911558e-01, -3.96259150332809895e-01,
+        -4.06682221332943072e-01, -4.17245122891841902e-01, -4.27945436366940157e-01, -4.38780631995371095e-01,
+        -4.49748072146491040e-01, -4.60845014558572075e-01, -4.72068615558924876e-01, -4.83415933267423270e-01,
+        -4.94883930782293646e-01, -5.06469479347686047e-01, -5.18169361502231141e-01, -5.29980274207815683e-01,
+        -5.41898831958320670e-01, -5.53921569867611652e-01, -5.66044946735502208e-01, -5.78265348092202203e-01,
+        -5.90579089219687603e-01, -6.02982418150389776e-01, -6.15471518641214743e-01, -6.28042513124171364e-01,
+        -6.40691465631761048e-01, -6.53414384697015294e-01, -6.66207226227584215e-01, -6.79065896353904463e-01,
+        -6.91986254250195998e-01, -7.04964114928372965e-01, -7.17995252004811846e-01, -7.31075400437703138e-01,
+        -7.44200259237402406e-01, -7.57365494146597484e-01, -7.70566740292906616e-01, -7.83799604809416905e-01,
+        -7.97059669427198969e-01, -8.10342493037296663e-01, -8.23643614220259224e-01, -8.36958553747422229e-01,
+        -8.50282817048309880e-01, -8.63611896648251331e-01, -8.76941274572459406e-01, -8.90266424720664418e-01,
+        -9.03582815205936640e-01, -9.16885910662813330e-01, -9.30171174523593436e-01, -9.43434071258081985e-01,
+        -9.56670068584401179e-01, -9.69874639642114289e-01, -9.83043265134710964e-01, -9.96171435437361197e-01,
+        -1.00925465266971059e+00, -1.02228843273536540e+00, -1.03526830732766939e+00, -1.04818982589932830e+00,
+        -1.06104855759929251e+00, -1.07384009317382834e+00, -1.08656004683376750e+00, -1.09920405808537680e+00,
+    },
+    {
+        -1.66301484575850367e-02, -1.16120420496634846e-02, -6.76084749587665956e-03, -2.06295885088686459e-03,
+         2.49490590602818862e-03,  6.92570652620058680e-03,  1.12420822211838356e-02,  1.54563534649527767e-02,
+         1.95805238669519155e-02,  2.36262821142532442e-02,  2.76050039810266934e-02,  3.15277544037030205e-02,
+         3.54052896199996969e-02,  3.92480593702111413e-02,  4.30662091589602003e-02,  4.68695825758836948e-02,
+         5.06677236734309755e-02,  5.44698794002216324e-02,  5.82850020883058928e-02,  6.21217519926782202e-02,
+         6.59884998814415091e-02,  6.98933296750281485e-02,  7.38440411329586155e-02,  7.78481525862897428e-02,
+         8.19129037147314776e-02,  8.60452583661892589e-02,  9.02519074178478320e-02,  9.45392716768704844e-02,
+         9.89135048193574562e-02,  1.03380496366060726e-01,  1.07945874693399446e-01,  1.12615010078242150e-01,
+         1.17393017775174968e-01,  1.22284761124525687e-01,  1.27294854690152448e-01,  1.32427667425162099e-01,
+         1.37687325864483512e-01,  1.43077717342777078e-01,  1.48602493236392519e-01,  1.54265072228003675e-01,
+         1.60068643592531146e-01,  1.66016170503226590e-01,  1.72110393356419422e-01,  1.78353833113789051e-01,
+         1.84748794660848148e-01,  1.91297370180365078e-01,  1.98001442539535333e-01,  2.04862688689708250e-01,
+         2.11882583077361630e-01,  2.19062401065293955e-01,  2.26403222362726808e-01,  2.33905934463280119e-01,
+         2.41571236089534125e-01,  2.49399640643247267e-01,  2.57391479659986544e-01,  2.65546906267161376e-01,
+         2.73865898644160666e-01,  2.82348263484138329e-01,  2.90993639455550124e-01,  2.99801500663051002e-01,
+         3.08771160106601883e-01,  3.17901773137634791e-01,  3.27192340911551582e-01,  3.36641713835220457e-01,
+         3.46248595009001292e-01,  3.56011543661907126e-01,  3.65928978579432851e-01,  3.75999181522558956e-01,
+         3.86220300637958758e-01,  3.96590353857448008e-01,  4.07107232286705312e-01,  4.17768703581771206e-01,
+         4.28572415313539068e-01,  4.39515898317807796e-01,  4.50596570031478905e-01,  4.61811737813832224e-01,
+         4.73158602251714910e-01,  4.84634260448245868e-01,  4.96235709294069238e-01,  5.07959848720673790e-01,
+         5.19803484935181359e-01,  5.31763333635552726e-01,  5.43836023205443553e-01,  5.56018097889221963e-01,
+         5.68306020944476131e-01,  5.80696177773518230e-01,  5.93184879032065737e-01,  6.05768363714133784e-01,
+         6.18442802214218545e-01,  6.31204299364242161e-01,  6.44048897446310775e-01,  6.56972579179949889e-01,
+         6.69971270683021203e-01,  6.83040844406775705e-01,  6.96177122043422969e-01,  7.09375877407580901e-01,
+         7.22632839287825846e-01,  7.35943694272179982e-01,  7.49304089543329610e-01,  7.62709635645592243e-01,
+         7.76155909221586171e-01,  7.89638455720080401e-01,  8.03152792072239663e-01,  8.16694409338310834e-01,
+         8.30258775322647580e-01,  8.43841337157584803e-01,  8.57437523855764994e-01,  8.71042748830291202e-01,
+         8.84652412382365583e-01,  8.98261904157152458e-01,  9.11866605566103772e-01,  9.25461892175917455e-01,
+         9.39043136065265571e-01,  9.52605708146791130e-01,  9.66144980455851510e-01,  9.79656328405326349e-01,
+         9.93135133005750959e-01,  1.00657678305117315e+00,  1.01997667727141561e+00,  1.03333022644773109e+00,
+         1.04663285549463581e+00,  1.05988000550746619e+00,  1.07306713577304436e+00,  1.08618972574623740e+00,
+         1.09924327699110336e+00,  1.11222331508582783e+00,  1.12512539149230406e+00,  1.13794508539132266e+00,
+    },
+    {
+         7.49038629235043718e-03,  5.10085470330401414e-03,  2.72804381717728361e-03,  3.72376282824937732e-04,
+        -1.96573237518116173e-03, -4.28587379914446842e-03, -6.58764683883461544e-03, -8.87065759014760147e-03,
+        -1.11345194317706842e-02, -1.33788530599154853e-02, -1.56032865210757876e-02, -1.78074552428650890e-02,
+        -1.99910020629197049e-02, -2.21535772558425492e-02, -2.42948385582728577e-02, -2.64144511920072489e-02,
+        -2.85120878852502813e-02, -3.05874288919412152e-02, -3.26401620092298117e-02, -3.46699825930372185e-02,
+        -3.66765935718191827e-02, -3.86597054584107980e-02, -4.06190363600771320e-02, -4.25543119866986785e-02,
+        -4.44652656571982163e-02, -4.63516383040776248e-02, -4.82131784762245275e-02, -5.00496423399603430e-02,
+        -5.18607936782196077e-02, -5.36464038880914984e-02, -5.54062519765743389e-02, -5.71401245545501979e-02,
+        -5.88478158291749764e-02, -6.05291275944424001e-02, -6.21838692201350796e-02, -6.38118576391057957e-02,
+        -6.54129173329067726e-02, -6.69868803157598336e-02, -6.85335861169029670e-02, -7.00528817613985666e-02,
+        -7.15446217492825554e-02, -7.30086680331538673e-02, -7.44448899943037645e-02, -7.58531644170901131e-02,
+        -7.72333754621143953e-02, -7.85854146375868368e-02, -7.99091807693628198e-02, -8.12045799695084725e-02,
+        -8.24715256034949107e-02, -8.37099382556800720e-02, -8.49197456937176298e-02, -8.61008828313885033e-02,
+        -8.72532916901249678e-02, -8.83769213590923641e-02, -8.94717279540842014e-02, -9.05376745749961742e-02,
+        -9.15747312619927811e-02, -9.25828749504873372e-02, -9.35620894248359036e-02, -9.45123652707167139e-02,
+        -9.54336998263727310e-02, -9.63260971327315474e-02, -9.71895678821326214e-02, -9.80241293661308077e-02,
+        -9.88298054220990707e-02, -9.96066263785522210e-02, -1.00354628999696160e-01, -1.01073856428577358e-01,
+        -1.01764358129479149e-01, -1.02426189829024850e-01, -1.03059413456527693e-01, -1.03664097083125739e-01,
+        -1.04240314860092553e-01, -1.04788146956209971e-01, -1.05307679494167417e-01, -1.05799004486001991e-01,
+        -1.06262219767863542e-01, -1.06697428933692606e-01, -1.07104741268273074e-01, -1.07484271679254562e-01,
+        -1.07836140628592148e-01, -1.08160474063112133e-01, -1.08457403344296210e-01, -1.08727065177461668e-01,
+        -1.08969601540131578e-01, -1.09185159609729965e-01, -1.09373891690708547e-01, -1.09535955140941610e-01,
+        -1.09671512297587981e-01, -1.09780730402164295e-01, -1.09863781525426418e-01, -1.09920842491227688e-01,
+        -1.09952094800263467e-01, -1.09957724553012781e-01, -1.09937922372402852e-01, -1.09892883325841240e-01,
+        -1.09822806846949561e-01, -1.09727896656757196e-01, -1.09608360684553929e-01, -1.09464410988408645e-01,
+        -1.09296263675211947e-01, -1.09104138820484309e-01, -1.08888260387807634e-01, -1.08648856148036543e-01,
+        -1.08386157598125976e-01, -1.08100399879809572e-01, -1.07791821698000945e-01, -1.07460665238946262e-01,
+        -1.07107176088291567e-01, -1.06731603148851661e-01, -1.06334198558307946e-01, -1.05915217606820988e-01,
+        -1.05474918654323346e-01, -1.05013563048046876e-01, -1.04531415039645026e-01, -1.04028741702570926e-01,
+        -1.03505812849100209e-01, -1.02962900947673575e-01, -1.02400281039976448e-01, -1.01818230658217601e-01,
+        -1.01217029742372233e-01, -1.00596960557510329e-01, -9.99583076111889568e-02, -9.93013575709795759e-02,
+        -9.86263991820806041e-02, -9.79337231851289403e-02, -9.72236222340114864e-02, -9.64963908141029947e-02,
+    },
+    {
+        -5.13935042326596481e-03, -2.74863213363385483e-03, -3.75186575205077588e-04,  1.98056759152098749e-03,
+         4.31821892700057219e-03,  6.63736325356545365e-03,  8.93760369434648538e-03,  1.12185507102324777e-02,
+         1.34798221348582103e-02,  1.57210432076180240e-02,  1.79418466047334135e-02,  2.01418724683612993e-02,
+         2.23207684337527468e-02,  2.44781896545234190e-02,  2.66137988259220748e-02,  2.87272662062623141e-02,
+         3.08182696363843434e-02,  3.28864945572640011e-02,  3.49316340257104230e-02,  3.69533887281967566e-02,
+         3.89514669928381352e-02,  4.09255847994636213e-02,  4.28754657879153456e-02,  4.48008412645002352e-02,
+         4.67014502065303816e-02,  4.85770392652611349e-02,  5.04273627667899405e-02,  5.22521827113386905e-02,
+         5.40512687707774830e-02,  5.58243982842583364e-02,  5.75713562522572886e-02,  5.92919353288152706e-02,
+         6.09859358120736772e-02,  6.26531656331614784e-02,  6.42934403433415014e-02,  6.59065830995295698e-02,
+         6.74924246481829471e-02,  6.90508033074763716e-02,  7.05815649479859530e-02,  7.20845629716535541e-02,
+         7.35596582892839024e-02,  7.50067192963399521e-02,  7.64256218473562399e-02,  7.78162492286682550e-02,
+         7.91784921296923017e-02,  8.05122486127274328e-02,  8.18174240813434039e-02,  8.30939312470917457e-02,
+         8.43416900950373361e-02,  8.55606278477196724e-02,  8.67506789276930590e-02,  8.79117849188162381e-02,
+         8.90438945260640935e-02,  9.01469635340319542e-02,  9.12209547641325003e-02,  9.22658380304213210e-02,
+         9.32815900942642884e-02,  9.42681946176051611e-02,  9.52256421150963206e-02,  9.61539299049007923e-02,
+         9.70530620584000303e-02,  9.79230493486653586e-02,  9.87639091977712269e-02,  9.95756656229360715e-02,
+         1.00358349181583151e-01,  1.01111996915371094e-01,  1.01836652292966789e-01,  1.02532365151930094e-01,
+         1.03199191639461674e-01,  1.03837194152241352e-01,  1.04446441275136692e-01,  1.05027007719044718e-01,
+         1.05578974257781510e-01,  1.06102427663934407e-01,  1.06597460644017872e-01,  1.07064171772506711e-01,
+         1.07502665425187161e-01,  1.07913051711577168e-01,  1.08295446406529550e-01,  1.08649970881153024e-01,
+         1.08976752032710067e-01,  1.09275922214145282e-01,  1.09547619162412957e-01,  1.09791985926520397e-01,
+         1.10009170794668876e-01,  1.10199327220755094e-01,  1.10362613750183414e-01,  1.10499193945223340e-01,
+         1.10609236309642256e-01,  1.10692914212698668e-01,  1.10750405812801489e-01,  1.10781893980366419e-01,
+         1.10787566220409417e-01,  1.10767614594408315e-01,  1.10722235641965483e-01,  1.10651630301809689e-01,
+         1.10556003832407157e-01,  1.10435565732316832e-01,  1.10290529659962999e-01,  1.10121113353180533e-01,
+         1.09927538548376447e-01,  1.09710030899400124e-01,  1.09468819896029856e-01,  1.09204138782338589e-01,
+         1.08916224474633339e-01,  1.08605317479323560e-01,  1.08271661810434239e-01,  1.07915504906976878e-01,
+         1.07537097550256533e-01,  1.07136693780816472e-01,  1.06714550815425468e-01,  1.06270928963908773e-01,
+         1.05806091545815661e-01,  1.05320304807079879e-01,  1.04813837836744028e-01,  1.04286962483357115e-01,
+         1.03739953271620777e-01,  1.03173087318964463e-01,  1.02586644252106396e-01,  1.01980906123699810e-01,
+         1.01356157329021812e-01,  1.00712684522797247e-01,  1.00050776536093622e-01,  9.93707242931947121e-02,
+         9.86728207289431225e-02,  9.79573607058910056e-02,  9.72246409318202609e-02,  9.64749598774474748e-02,
+    },
+    {
+         1.98581611401998188e-03, -3.27684452343561874e-05,  5.17263779757212369e-05,  1.32278246920223413e-04,
+         2.09523825535412253e-04,  2.84068668246715075e-04,  3.56488921927760119e-04,  4.27332961707667380e-04,
+         4.97122962335262708e-04,  5.66356406778364962e-04,  6.35507533706426708e-04,  7.05028725474989015e-04,
+         7.75351838201092380e-04,  8.46889475489852328e-04,  9.20036207343828683e-04,  9.95169735758638652e-04,
+         1.07265200848016828e-03,  1.15283028237164742e-03,  1.23603813781118788e-03,  1.32259644551395439e-03,
+         1.41281428714633284e-03,  1.50698983107397377e-03,  1.60541116455867328e-03,  1.70835708369490580e-03,
+         1.81609784235112204e-03,  1.92889586135494562e-03,  2.04700639914007221e-03,  2.17067818504501631e-03,
+         2.30015401643246520e-03,  2.43567132077227022e-03,  2.57746268381270349e-03,  2.72575634493404939e-03,
+         2.88077666076291816e-03,  3.04274453810143841e-03,  3.21187783720261466e-03,  3.38839174639815610e-03,
+         3.57249912907642297e-03,  3.76441084396716974e-03,  3.96433603968993076e-03,  4.17248242448708950e-03,
+         4.38905651204857250e-03,  4.61426384431806724e-03,  4.84830919214329636e-03,  5.09139673462222220e-03,
+         5.34373021797118763e-03,  5.60551309472612225e-03,  5.87694864407017903e-03,  6.15824007405518792e-03,
+         6.44959060648186977e-03,  6.75120354516844934e-03,  7.06328232833186576e-03,  7.38603056578424066e-03,
+         7.71965206163205409e-03,  8.06435082314571616e-03,  8.42033105645767499e-03,  8.78779714971789083e-03,
+         9.16695364434150228e-03,  9.55800519493754663e-03,  9.96115651853202166e-03,  1.03766123336352933e-02,
+         1.08045772897309433e-02,  1.12452558877373932e-02,  1.16988523919463461e-02,  1.21655707340000419e-02,
+         1.26456144093545220e-02,  1.31391863667804643e-02,  1.36464888913194748e-02,  1.41677234812087605e-02,
+         1.47030907191889604e-02,  1.52527901386472209e-02,  1.58170200850218379e-02,  1.63959775728779178e-02,
+         1.69898581390492964e-02,  1.75988556922428430e-02,  1.82231623594795167e-02,  1.88629683297305561e-02,
+         1.95184616951094014e-02,  2.01898282899675152e-02,  2.08772515282023008e-02,  2.15809122391261710e-02,
+         2.23009885021898668e-02,  2.30376554808646716e-02,  2.37910852559650721e-02,  2.45614466587191771e-02,
+         2.53489051038018331e-02,  2.61536224226599501e-02,  2.69757566973272134e-02,  2.78154620949884190e-02,
+         2.86728887035341273e-02,  2.95481823683108047e-02,  3.04414845302893866e-02,  3.13529320658858524e-02,
+         3.22826571285688146e-02,  3.32307869924992616e-02,  3.41974438983623230e-02,  3.51827449015811311e-02,
+         3.61868017230424499e-02,  3.72097206025294724e-02,  3.82516021549861307e-02,  3.93125412297941068e-02,
+         4.03926267731389288e-02,  4.14919416936641028e-02,  4.26105627314647961e-02,  4.37485603306200233e-02,
+         4.49059985152757690e-02,  4.60829347694655667e-02,  4.72794199207342558e-02,  4.84954980276395275e-02,
+         4.97312062712396141e-02,  5.09865748506470595e-02,  5.22616268826467945e-02,  5.35563783056751674e-02,
+         5.48708377878632803e-02,  5.62050066395300973e-02,  5.75588787299743387e-02,  5.89324404087712139e-02,
+         6.03256704314212300e-02,  6.17385398895784476e-02,  6.31710121457622620e-02,  6.46230427726628420e-02,
+         6.60945794970118072e-02,  6.75855621480181412e-02,  6.90959226105363200e-02,  7.06255847826575689e-02,
+         7.21744645382393912e-02,  7.37424696937374335e-02,  7.53294999799187792e-02,  7.69354470181440320e-02,
+    },
+};
+
+static const double lfe_iir_128_state[7][6] = {
+    {
+        -1.70236931330676953e+01, -1.68835058636488959e+01, -2.03114513591812283e+03, -2.04893513681416698e+03,
+        -1.23916134794603058e+04, -1.27030037804814528e+04,
+    },
+    {
+         1.74083127601084868e+01,  1.72637905745908462e+01,  2.11332561721657930e+03,  2.13138847927563165e+03,
+         1.31132944495541287e+04,  1.34389998998439787e+04,
+    },
+    {
+         0.00000000000000000e+00,  0.00000000000000000e+00, -2.22896334126363378e+01, -2.20855426176128020e+01,
+        -4.40324001972566464e+02, -4.45935820109443455e+02,
+    },
+    {
+         0.00000000000000000e+00,  0.00000000000000000e+00,  2.25640389242766339e+01,  2.23545490645927636e+01,
+         4.56462825169804944e+02,  4.62148233637675332e+02,
+    },
+    {
+         0.00000000000000000e+00,  0.00000000000000000e+00,  0.00000000000000000e+00,  0.00000000000000000e+00,
+        -3.99888571869136342e+01, -3.96508596955511763e+01,
+    },
+    {
+         0.00000000000000000e+00,  0.00000000000000000e+00,  0.00000000000000000e+00,  0.00000000000000000e+00,
+         3.99501013873627571e+01,  3.96028792265749274e+01,
+    },
+    {
+         3.48567474902481481e-02,  3.45697079969206483e-02,  4.20548523961957255e+00,  4.24148409693291040e+00,
+         2.63777641214989416e+01,  2.70263762145777307e+01,
+    },
+};
+
+#endif
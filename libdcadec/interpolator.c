@@ -25,9 +25,16 @@ struct interpolator *interpolator_create(struct idct_context *parent, int flags)
     if (!dsp)
         return NULL;
 
+    size_t size;
+    if (flags & DCADEC_FLAG_CORE_BIT_EXACT)
+        size = sizeof(int);
+    else if (flags & DCADEC_FLAG_CORE_FLOAT32)
+        size = sizeof(float);
+    else
+        size = sizeof(double);
+
     dsp->idct = parent;
-    dsp->history = ta_znew_array_size(dsp,
-        (flags & DCADEC_FLAG_CORE_BIT_EXACT) ? sizeof(int) : sizeof(double),
+    dsp->history = ta_znew_array_size(dsp, size,
         (flags & DCADEC_FLAG_CORE_SYNTH_X96) ? 1024 : 512);
     if (!dsp->history) {
         ta_free(dsp);
@@ -39,6 +46,11 @@ struct interpolator *interpolator_create(struct idct_context *parent, int flags)
             dsp->interpolate = interpolate_sub64_fixed;
         else
             dsp->interpolate = interpolate_sub32_fixed;
+    } else if (flags & DCADEC_FLAG_CORE_FLOAT32) {
+        if (flags & DCADEC_FLAG_CORE_SYNTH_X96)
+            dsp->interpolate = interpolate_sub64_float32;
+        else
+            dsp->interpolate = interpolate_sub32_float32;
     } else {
         if (flags & DCADEC_FLAG_CORE_SYNTH_X96)
             dsp->interpolate = interpolate_sub64_float;
@@ -27,9 +27,11 @@ struct idct_context;
 typedef void (*interpolate_lfe_cb)(int *pcm_samples, int *lfe_samples,
                                    int npcmblocks, bool dec_select);
 
+// Subband samples are stored in blocks of 32 (lo) or 64 (hi) samples per
+// subband sample period
 typedef void (*interpolate_sub_cb)(struct interpolator *dsp, int *pcm_samples,
-                                   int **subband_samples_lo,
-                                   int **subband_samples_hi,
+                                   int *subband_samples_lo,
+                                   int *subband_samples_hi,
                                    int nsamples, bool perfect);
 
 struct interpolator {
@@ -48,8 +50,8 @@ void interpolator_clear(struct interpolator *dsp) __attribute__((cold));
 
 #define INTERPOLATE_SUB(x) \
     void interpolate_##x(struct interpolator *dsp, int *pcm_samples, \
-                         int **subband_samples_lo, \
-                         int **subband_samples_hi, \
+                         int *subband_samples_lo, \
+                         int *subband_samples_hi, \
                          int nsamples, bool perfect)
 
 INTERPOLATE_LFE(lfe_float_fir);
@@ -58,6 +60,11 @@ INTERPOLATE_LFE(lfe_float_iir);
 INTERPOLATE_SUB(sub32_float);
 INTERPOLATE_SUB(sub64_float);
 
+INTERPOLATE_LFE(lfe_float32_fir);
+INTERPOLATE_LFE(lfe_float32_fir_2x);
+INTERPOLATE_SUB(sub32_float32);
+INTERPOLATE_SUB(sub64_float32);
+
 INTERPOLATE_LFE(lfe_fixed_fir);
 INTERPOLATE_SUB(sub32_fixed);
 INTERPOLATE_SUB(sub64_fixed);
@@ -20,6 +20,7 @@
 #include "interpolator.h"
 #include "idct.h"
 #include "fixed_math.h"
+#include "fixed_math_sse2.h"
 #include "fir_fixed.h"
 
 INTERPOLATE_LFE(lfe_fixed_fir)
@@ -33,17 +34,46 @@ INTERPOLATE_LFE(lfe_fixed_fir)
     // Interpolation
     for (int i = 0; i < nlfesamples; i++) {
         int *src = lfe_samples + MAX_LFE_HISTORY + i;
+        int j = 0, k;
+
+        // One decimated sample generates 64 interpolated ones. Second half
+        // of the outputs uses the mirrored filter, which is the same table
+        // read backwards.
+#if HAVE_SSE2
+        struct coeff_sse2 coeff[8];
+        __m128i bias = _mm_setzero_si128();
+        for (k = 0; k < 8; k++) {
+            coeff[k] = coeff_sse2_init(src[-k], 0);
+            bias = _mm_add_epi64(bias, coeff[k].bias);
+        }
+
+        for (; j < 32; j += 4) {
+            __m128i lo1 = bias, hi1 = bias;
+            __m128i lo2 = bias, hi2 = bias;
+
+            // Accumulate
+            for (k = 0; k < 8; k++) {
+                mac_coeff_sse2(&lo1, &hi1, _mm_loadu_si128((const __m128i *)&lfe_fir_64[    k][     j]), &coeff[k]);
+                mac_coeff_sse2(&lo2, &hi2, _mm_loadu_si128((const __m128i *)&lfe_fir_64[7 - k][28 - j]), &coeff[k]);
+            }
+
+            // Save interpolated samples
+            __m128i res1 = clip23_sse2(norm__sse2(lo1, hi1, 23));
+            __m128i res2 = clip23_sse2(norm__sse2(lo2, hi2, 23));
+            _mm_storeu_si128((__m128i *)&pcm_samples[     j], res1);
+            _mm_storeu_si128((__m128i *)&pcm_samples[32 + j], _mm_shuffle_epi32(res2, _MM_SHUFFLE(0, 1, 2, 3)));
+        }
+#endif
 
-        // One decimated sample generates 64 interpolated ones
-        for (int j = 0; j < 32; j++) {
+        for (; j < 32; j++) {
             // Clear accumulation
             int64_t res1 = INT64_C(0);
             int64_t res2 = INT64_C(0);
 
             // Accumulate
-            for (int k = 0; k < 8; k++) {
-                res1 += (int64_t)lfe_fir_64[      j * 8 + k] * src[-k];
-                res2 += (int64_t)lfe_fir_64[255 - j * 8 - k] * src[-k];
+            for (k = 0; k < 8; k++) {
+                res1 += (int64_t)lfe_fir_64[    k][     j] * src[-k];
+                res2 += (int64_t)lfe_fir_64[7 - k][31 - j] * src[-k];
             }
 
             // Save interpolated samples
@@ -78,7 +108,7 @@ INTERPOLATE_SUB(sub32_fixed)
         // Load in one sample from each subband
         int input[32];
         for (i = 0; i < 32; i++)
-            input[i] = subband_samples_lo[i][sample];
+            input[i] = subband_samples_lo[sample * 32 + i];
 
         // Inverse DCT
         int output[32];
@@ -140,13 +170,13 @@ INTERPOLATE_SUB(sub64_fixed)
         if (subband_samples_hi) {
             // Full 64 subbands, first 32 are residual coded
             for (i =  0; i < 32; i++)
-                input[i] = subband_samples_lo[i][sample] + subband_samples_hi[i][sample];
+                input[i] = subband_samples_lo[sample * 32 + i] + subband_samples_hi[sample * 64 + i];
             for (i = 32; i < 64; i++)
-                input[i] = subband_samples_hi[i][sample];
+                input[i] = subband_samples_hi[sample * 64 + i];
         } else {
             // Only first 32 subbands
             for (i =  0; i < 32; i++)
-                input[i] = subband_samples_lo[i][sample];
+                input[i] = subband_samples_lo[sample * 32 + i];
             for (i = 32; i < 64; i++)
                 input[i] = 0;
         }
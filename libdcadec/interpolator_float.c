@@ -20,16 +20,9 @@
 #include "interpolator.h"
 #include "idct.h"
 #include "fixed_math.h"
+#include "fixed_math_sse2.h"
 #include "fir_float.h"
-
-static const double lfe_iir_scale = 0.001985816114019982;
-
-static const double lfe_iir[12] = {
-    -0.9698530866436986,  1.9696040724997900,  0.9999999999999996,
-    -1.9643358221499630, -0.9787938538720836,  1.9785545764679620,
-     1.0000000000000020, -1.9951847249255470, -0.9925096137076496,
-     1.9922787089263100,  1.0000000000000000, -1.9974180593495760
-};
+#include "iir_float.h"
 
 static inline int convert(double a)
 {
@@ -43,26 +36,56 @@ static void interpolate_lfe(int *pcm_samples, int *lfe_samples, int npcmblocks,
     int factor = 64 << dec_select;
     int ncoeffs = 8 >> dec_select;
     int nlfesamples = npcmblocks >> (dec_select + 1);
+    int noutputs = factor / 2;
 
     // Interpolation
     for (int i = 0; i < nlfesamples; i++) {
         int *src = lfe_samples + MAX_LFE_HISTORY + i;
+        int j = 0, k;
+
+        // One decimated sample generates 64 or 128 interpolated ones. Second
+        // half of the outputs uses the mirrored filter, which is the same
+        // table read backwards.
+#if HAVE_SSE2
+        for (; j < noutputs; j += 4) {
+            __m128d res1a = _mm_setzero_pd(), res1b = _mm_setzero_pd();
+            __m128d res2a = _mm_setzero_pd(), res2b = _mm_setzero_pd();
+
+            // Accumulate
+            for (k = 0; k < ncoeffs; k++) {
+                const double *coeff1 = &filter_coeff[               k  * noutputs + j];
+                const double *coeff2 = &filter_coeff[(ncoeffs - 1 - k) * noutputs + noutputs - 4 - j];
+                __m128d in = _mm_set1_pd(src[-k]);
+                res1a = _mm_add_pd(res1a, _mm_mul_pd(_mm_loadu_pd(coeff1 + 0), in));
+                res1b = _mm_add_pd(res1b, _mm_mul_pd(_mm_loadu_pd(coeff1 + 2), in));
+                res2a = _mm_add_pd(res2a, _mm_mul_pd(_mm_loadu_pd(coeff2 + 2), in));
+                res2b = _mm_add_pd(res2b, _mm_mul_pd(_mm_loadu_pd(coeff2 + 0), in));
+            }
+
+            // Save interpolated samples
+            res2a = _mm_shuffle_pd(res2a, res2a, 1);
+            res2b = _mm_shuffle_pd(res2b, res2b, 1);
+            __m128i res1 = _mm_unpacklo_epi64(_mm_cvtpd_epi32(res1a), _mm_cvtpd_epi32(res1b));
+            __m128i res2 = _mm_unpacklo_epi64(_mm_cvtpd_epi32(res2a), _mm_cvtpd_epi32(res2b));
+            _mm_storeu_si128((__m128i *)&pcm_samples[           j], clip23_sse2(res1));
+            _mm_storeu_si128((__m128i *)&pcm_samples[noutputs + j], clip23_sse2(res2));
+        }
+#endif
 
-        // One decimated sample generates 64 or 128 interpolated ones
-        for (int j = 0; j < factor / 2; j++) {
+        for (; j < noutputs; j++) {
             // Clear accumulation
             double res1 = 0.0;
             double res2 = 0.0;
 
             // Accumulate
-            for (int k = 0; k < ncoeffs; k++) {
-                res1 += filter_coeff[      j * ncoeffs + k] * src[-k];
-                res2 += filter_coeff[255 - j * ncoeffs - k] * src[-k];
+            for (k = 0; k < ncoeffs; k++) {
+                res1 += filter_coeff[               k  * noutputs +            j] * src[-k];
+                res2 += filter_coeff[(ncoeffs - 1 - k) * noutputs + noutputs - 1 - j] * src[-k];
             }
 
             // Save interpolated samples
-            pcm_samples[             j] = convert(res1);
-            pcm_samples[factor / 2 + j] = convert(res2);
+            pcm_samples[           j] = convert(res1);
+            pcm_samples[noutputs + j] = convert(res2);
         }
 
         // Advance output pointer
@@ -79,7 +102,7 @@ INTERPOLATE_LFE(lfe_float_fir)
     (void)dec_select;
     assert(!dec_select);
 
-    interpolate_lfe(pcm_samples, lfe_samples, npcmblocks, lfe_fir_64, false);
+    interpolate_lfe(pcm_samples, lfe_samples, npcmblocks, lfe_fir_64[0], false);
 }
 
 INTERPOLATE_LFE(lfe_float_fir_2x)
@@ -87,7 +110,7 @@ INTERPOLATE_LFE(lfe_float_fir_2x)
     (void)dec_select;
     assert(dec_select);
 
-    interpolate_lfe(pcm_samples, lfe_samples, npcmblocks, lfe_fir_128, true);
+    interpolate_lfe(pcm_samples, lfe_samples, npcmblocks, lfe_fir_128[0], true);
 }
 
 INTERPOLATE_LFE(lfe_float_iir)
@@ -96,39 +119,65 @@ INTERPOLATE_LFE(lfe_float_iir)
     int factor = 64 << dec_select;
     int nlfesamples = npcmblocks >> (dec_select + 1);
 
+    // Select state-space matrices
+    const double *output_coeff = dec_select ? lfe_iir_128_output[0] : lfe_iir_64_output[0];
+    const double (*state_coeff)[6] = dec_select ? lfe_iir_128_state : lfe_iir_64_state;
+
     // Load history
-    double lfe_history[6];
+    double input[7];
     for (int i = 0; i < 6; i++)
-        lfe_history[i] = ((double *)lfe_samples)[i];
+        input[i] = ((double *)lfe_samples)[i];
 
     // Interpolation
     for (int i = 0; i < nlfesamples; i++) {
-        double res1 = lfe_samples[MAX_LFE_HISTORY + i] * lfe_iir_scale;
-        double res2;
-
-        // One decimated sample generates 64 or 128 interpolated ones
-        for (int j = 0; j < factor; j++) {
-            // Filter
-            for (int k = 0; k < 3; k++) {
-                double tmp1 = lfe_history[k * 2 + 0];
-                double tmp2 = lfe_history[k * 2 + 1];
-
-                res2 = tmp1 * lfe_iir[k * 4 + 0] + tmp2 * lfe_iir[k * 4 + 1] + res1;
-                res1 = tmp1 * lfe_iir[k * 4 + 2] + tmp2 * lfe_iir[k * 4 + 3] + res2;
-
-                lfe_history[k * 2 + 0] = tmp2;
-                lfe_history[k * 2 + 1] = res2;
+        int j, k;
+
+        input[6] = lfe_samples[MAX_LFE_HISTORY + i];
+
+        // One decimated sample generates 64 or 128 interpolated ones, all
+        // of them independent of each other
+#if HAVE_SSE2
+        for (j = 0; j < factor; j += 4) {
+            __m128d res0 = _mm_setzero_pd();
+            __m128d res1 = _mm_setzero_pd();
+            for (k = 0; k < 7; k++) {
+                __m128d in = _mm_set1_pd(input[k]);
+                res0 = _mm_add_pd(res0, _mm_mul_pd(_mm_loadu_pd(&output_coeff[k * factor + j + 0]), in));
+                res1 = _mm_add_pd(res1, _mm_mul_pd(_mm_loadu_pd(&output_coeff[k * factor + j + 2]), in));
             }
 
             // Save interpolated samples
-            *pcm_samples++ = convert(res1);
-            res1 = 0.0;
+            __m128i res = _mm_unpacklo_epi64(_mm_cvtpd_epi32(res0), _mm_cvtpd_epi32(res1));
+            _mm_storeu_si128((__m128i *)pcm_samples, clip23_sse2(res));
+            pcm_samples += 4;
+        }
+#else
+        double res[128];
+        for (j = 0; j < factor; j++)
+            res[j] = output_coeff[j] * input[0];
+        for (k = 1; k < 7; k++)
+            for (j = 0; j < factor; j++)
+                res[j] += output_coeff[k * factor + j] * input[k];
+
+        // Save interpolated samples
+        for (j = 0; j < factor; j++)
+            *pcm_samples++ = convert(res[j]);
+#endif
+
+        // Advance filter history
+        double history[6];
+        for (j = 0; j < 6; j++) {
+            history[j] = state_coeff[0][j] * input[0];
+            for (k = 1; k < 7; k++)
+                history[j] += state_coeff[k][j] * input[k];
         }
+        for (j = 0; j < 6; j++)
+            input[j] = history[j];
     }
 
     // Store history
     for (int i = 0; i < 6; i++)
-        ((double *)lfe_samples)[i] = lfe_history[i];
+        ((double *)lfe_samples)[i] = input[i];
 }
 
 INTERPOLATE_SUB(sub32_float)
@@ -149,7 +198,7 @@ INTERPOLATE_SUB(sub32_float)
         // Load in one sample from each subband
         double input[32];
         for (i = 0; i < 32; i++)
-            input[i] = subband_samples_lo[i][sample];
+            input[i] = subband_samples_lo[sample * 32 + i];
 
         // Inverse DCT
         double output[32];
@@ -208,13 +257,13 @@ INTERPOLATE_SUB(sub64_float)
         if (subband_samples_hi) {
             // Full 64 subbands, first 32 are residual coded
             for (i =  0; i < 32; i++)
-                input[i] = subband_samples_lo[i][sample] + subband_samples_hi[i][sample];
+                input[i] = subband_samples_lo[sample * 32 + i] + subband_samples_hi[sample * 64 + i];
             for (i = 32; i < 64; i++)
-                input[i] = subband_samples_hi[i][sample];
+                input[i] = subband_samples_hi[sample * 64 + i];
         } else {
             // Only first 32 subbands
             for (i =  0; i < 32; i++)
-                input[i] = subband_samples_lo[i][sample];
+                input[i] = subband_samples_lo[sample * 32 + i];
             for (i = 32; i < 64; i++)
                 input[i] = 0;
         }
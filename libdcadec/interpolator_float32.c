@@ -0,0 +1,272 @@
+/*
+ * This file is part of libdcadec.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation; either version 2.1 of the License, or (at your
+ * option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "common.h"
+#include "interpolator.h"
+#include "idct.h"
+#include "fixed_math.h"
+#include "fixed_math_sse2.h"
+#include "fir_float32.h"
+
+#if HAVE_SSE && !HAVE_SSE2
+#include <xmmintrin.h>
+#endif
+
+static inline int convert(float a)
+{
+    return clip23(lrintf(a));
+}
+
+#if HAVE_SSE
+static inline void convert_sse(int *output, __m128 a)
+{
+#if HAVE_SSE2
+    _mm_storeu_si128((__m128i *)output, clip23_sse2(_mm_cvtps_epi32(a)));
+#else
+    float tmp[4];
+    _mm_storeu_ps(tmp, a);
+    for (int i = 0; i < 4; i++)
+        output[i] = convert(tmp[i]);
+#endif
+}
+
+static inline __m128 reverse_ps(__m128 a)
+{
+    return _mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 1, 2, 3));
+}
+#endif
+
+static void interpolate_lfe(int *pcm_samples, int *lfe_samples, int npcmblocks,
+                            const float *filter_coeff, bool dec_select)
+{
+    // Select decimation factor
+    int factor = 64 << dec_select;
+    int ncoeffs = 8 >> dec_select;
+    int nlfesamples = npcmblocks >> (dec_select + 1);
+    int noutputs = factor / 2;
+
+    // Interpolation
+    for (int i = 0; i < nlfesamples; i++) {
+        int *src = lfe_samples + MAX_LFE_HISTORY + i;
+        int j = 0, k;
+
+        // One decimated sample generates 64 or 128 interpolated ones. Second
+        // half of the outputs uses the mirrored filter, which is the same
+        // table read backwards.
+#if HAVE_SSE
+        for (; j < noutputs; j += 4) {
+            __m128 res1 = _mm_setzero_ps();
+            __m128 res2 = _mm_setzero_ps();
+
+            // Accumulate
+            for (k = 0; k < ncoeffs; k++) {
+                __m128 in = _mm_set1_ps((float)src[-k]);
+                res1 = _mm_add_ps(res1, _mm_mul_ps(_mm_loadu_ps(&filter_coeff[               k  * noutputs +                j]), in));
+                res2 = _mm_add_ps(res2, _mm_mul_ps(_mm_loadu_ps(&filter_coeff[(ncoeffs - 1 - k) * noutputs + noutputs - 4 - j]), in));
+            }
+
+            // Save interpolated samples
+            convert_sse(&pcm_samples[           j], res1);
+            convert_sse(&pcm_samples[noutputs + j], reverse_ps(res2));
+        }
+#endif
+
+        for (; j < noutputs; j++) {
+            // Clear accumulation
+            float res1 = 0.0f;
+            float res2 = 0.0f;
+
+            // Accumulate
+            for (k = 0; k < ncoeffs; k++) {
+                res1 += filter_coeff[               k  * noutputs +            j] * src[-k];
+                res2 += filter_coeff[(ncoeffs - 1 - k) * noutputs + noutputs - 1 - j] * src[-k];
+            }
+
+            // Save interpolated samples
+            pcm_samples[           j] = convert(res1);
+            pcm_samples[noutputs + j] = convert(res2);
+        }
+
+        // Advance output pointer
+        pcm_samples += factor;
+    }
+
+    // Update history
+    for (int n = MAX_LFE_HISTORY - 1; n >= MAX_LFE_HISTORY - 8; n--)
+        lfe_samples[n] = lfe_samples[nlfesamples + n];
+}
+
+INTERPOLATE_LFE(lfe_float32_fir)
+{
+    (void)dec_select;
+    assert(!dec_select);
+
+    interpolate_lfe(pcm_samples, lfe_samples, npcmblocks, lfe_fir_64[0], false);
+}
+
+INTERPOLATE_LFE(lfe_float32_fir_2x)
+{
+    (void)dec_select;
+    assert(dec_select);
+
+    interpolate_lfe(pcm_samples, lfe_samples, npcmblocks, lfe_fir_128[0], true);
+}
+
+// Polyphase filter for nbands subbands. History layout and summation are the
+// same as in interpolator_float.c.
+static inline void filter_bands(int *pcm_samples, const float *history,
+                                const float *filter_coeff, int nbands)
+{
+    int nhalf = nbands / 2;
+    int ntaps = nbands * 16;
+    int i = 0, j, k;
+
+#if HAVE_SSE
+    for (; i < nhalf; i += 4) {
+        __m128 res1 = _mm_setzero_ps();
+        __m128 res2 = _mm_setzero_ps();
+        k = nhalf - 4 - i;
+
+        // Accumulate
+        for (j = 0; j < ntaps; j += 2 * nbands) {
+            res1 = _mm_add_ps(res1, _mm_mul_ps(_mm_loadu_ps(&history[i + j]), _mm_loadu_ps(&filter_coeff[i + j])));
+            res2 = _mm_add_ps(res2, _mm_mul_ps(reverse_ps(_mm_loadu_ps(&history[k + j])), _mm_loadu_ps(&filter_coeff[nhalf + i + j])));
+        }
+
+        for (j = nbands; j < ntaps; j += 2 * nbands) {
+            res1 = _mm_add_ps(res1, _mm_mul_ps(_mm_loadu_ps(&history[nhalf + i + j]), _mm_loadu_ps(&filter_coeff[i + j])));
+            res2 = _mm_add_ps(res2, _mm_mul_ps(reverse_ps(_mm_loadu_ps(&history[nhalf + k + j])), _mm_loadu_ps(&filter_coeff[nhalf + i + j])));
+        }
+
+        // Save interpolated samples
+        convert_sse(&pcm_samples[        i], res1);
+        convert_sse(&pcm_samples[nhalf + i], res2);
+    }
+#endif
+
+    for (; i < nhalf; i++) {
+        // Clear accumulation
+        float res1 = 0.0f;
+        float res2 = 0.0f;
+        k = nhalf - 1 - i;
+
+        // Accumulate
+        for (j = 0; j < ntaps; j += 2 * nbands) {
+            res1 += history[i + j] * filter_coeff[        i + j];
+            res2 += history[k + j] * filter_coeff[nhalf + i + j];
+        }
+
+        for (j = nbands; j < ntaps; j += 2 * nbands) {
+            res1 += history[nhalf + i + j] * filter_coeff[        i + j];
+            res2 += history[nhalf + k + j] * filter_coeff[nhalf + i + j];
+        }
+
+        // Save interpolated samples
+        pcm_samples[        i] = convert(res1);
+        pcm_samples[nhalf + i] = convert(res2);
+    }
+}
+
+INTERPOLATE_SUB(sub32_float32)
+{
+    (void)subband_samples_hi;
+    assert(!subband_samples_hi);
+
+    // Get history pointer
+    float *history = dsp->history;
+
+    // Select filter
+    const float *filter_coeff = perfect ? band_fir_perfect : band_fir_nonperfect;
+
+    // Interpolation begins
+    for (int sample = 0; sample < nsamples; sample++) {
+        int i, k;
+
+        // Load in one sample from each subband
+        float input[32];
+        for (i = 0; i < 32; i++)
+            input[i] = (float)subband_samples_lo[sample * 32 + i];
+
+        // Inverse DCT
+        float output[32];
+        idct_fast_float32(dsp->idct, input, output);
+
+        // Store history
+        for (i = 0, k = 31; i < 16; i++, k--) {
+            history[     i] = output[i] - output[k];
+            history[16 + i] = output[i] + output[k];
+        }
+
+        // One subband sample generates 32 interpolated ones
+        filter_bands(pcm_samples, history, filter_coeff, 32);
+
+        // Advance output pointer
+        pcm_samples += 32;
+
+        // Shift history
+        memmove(history + 32, history, 480 * sizeof(float));
+    }
+}
+
+INTERPOLATE_SUB(sub64_float32)
+{
+    (void)perfect;
+
+    // Get history pointer
+    float *history = dsp->history;
+
+    // Interpolation begins
+    for (int sample = 0; sample < nsamples; sample++) {
+        int i, k;
+
+        // Load in one sample from each subband
+        float input[64];
+        if (subband_samples_hi) {
+            // Full 64 subbands, first 32 are residual coded
+            for (i =  0; i < 32; i++)
+                input[i] = (float)(subband_samples_lo[sample * 32 + i] + subband_samples_hi[sample * 64 + i]);
+            for (i = 32; i < 64; i++)
+                input[i] = (float)subband_samples_hi[sample * 64 + i];
+        } else {
+            // Only first 32 subbands
+            for (i =  0; i < 32; i++)
+                input[i] = (float)subband_samples_lo[sample * 32 + i];
+            for (i = 32; i < 64; i++)
+                input[i] = 0.0f;
+        }
+
+        // Inverse DCT
+        float output[64];
+        idct_fast_float32(dsp->idct, input, output);
+
+        // Store history
+        for (i = 0, k = 63; i < 32; i++, k--) {
+            history[     i] = output[i] - output[k];
+            history[32 + i] = output[i] + output[k];
+        }
+
+        // One subband sample generates 64 interpolated ones
+        filter_bands(pcm_samples, history, band_fir_x96, 64);
+
+        // Advance output pointer
+        pcm_samples += 64;
+
+        // Shift history
+        memmove(history + 64, history, 960 * sizeof(float));
+    }
+}
@@ -17,17 +17,24 @@
  */
 
 #include "common.h"
-#include "cos.h"
 #include "exss_parser.h"
 #include "lbr_decoder.h"
 #include "idct.h"
 
 #include "lbr_bitstream.h"
 #include "lbr_tables.h"
+#include "lbr_trig_tables.h"
+#include "lbr_iir_tables.h"
 #include "lbr_huffman.h"
 
 #include "fixed_math.h"
 
+#if HAVE_SSE2
+#include <emmintrin.h>
+#elif HAVE_SSE
+#include <xmmintrin.h>
+#endif
+
 enum LBRHeader {
     LBR_HEADER_SYNC_ONLY    = 1,
     LBR_HEADER_DECODER_INIT = 2
@@ -811,7 +818,7 @@ static int parse_lpc(struct lbr_decoder *lbr, int ch1, int ch2, int start_sb, in
             for (int i = 0; i < ncodes; i++)
                 codes[i] = bits2_get(&lbr->bits, 4);
             for (int i = 0; i < ncodes / 8; i++)
-                convert_lpc(lbr->lpc_coeff[ch][sb][f][i], &codes[i * 8], lbr->lpc_tab);
+                convert_lpc(lbr->lpc_coeff[ch][sb][f][i], &codes[i * 8], lpc_tab);
         }
     }
 
@@ -960,7 +967,8 @@ static int parse_ts2_chunk(struct lbr_decoder *lbr, struct lbr_chunk *chunk, int
 
 static int init_tables(struct lbr_decoder *lbr)
 {
-    float scale = 256.0 * 0.25 * sqrt(1 << (2 - lbr->limited_range));
+    static const double range_scale[3] = { 2.0, M_SQRT2, 1.0 };
+    float scale = 256.0 * 0.25 * range_scale[lbr->limited_range];
     int i;
 
     ta_free(lbr->imdct);
@@ -968,11 +976,12 @@ static int init_tables(struct lbr_decoder *lbr)
     if (!(lbr->imdct = idct_init(lbr, lbr->freq_range + 5, scale)))
         return -1;
 
-    for (i = 0; i < 256; i++)
-        lbr->sin_tab[i] = cos(M_PI * i / 128);
-
-    for (i = 0; i < 16; i++)
-        lbr->lpc_tab[i] = sin((i - 8) * (M_PI / ((i < 8) ? 17 : 15)));
+    // Long window decimated to the output rate, second half reversed
+    int step = 1 << (2 - lbr->freq_range);
+    for (i = 0; i < (32 << lbr->freq_range); i++) {
+        lbr->window[0][i] = long_window[i * step];
+        lbr->window[1][i] = long_window[128 - (i + 1) * step];
+    }
 
     int br_per_ch = lbr->bit_rate_scaled / lbr->nchannels;
 
@@ -1637,8 +1646,8 @@ static void synth_tones(struct lbr_decoder *lbr, int ch, float *values,
 
         if (t->amp[ch]) {
             float amp = synth_env[synth_idx] * quant_amp[t->amp[ch]];
-            float s = amp * lbr->sin_tab[(t->phs[ch]     ) & 255];
-            float c = amp * lbr->sin_tab[(t->phs[ch] + 64) & 255];
+            float s = amp * sin_tab[(t->phs[ch]     ) & 255];
+            float c = amp * sin_tab[(t->phs[ch] + 64) & 255];
             const float *cf = corr_cf[t->f_delt];
             int x_freq = t->x_freq;
 
@@ -1706,41 +1715,155 @@ static void base_func_synth(struct lbr_decoder *lbr, int ch, float *values, int
 #define AL1     0.30865827
 #define AL2     0.038060233
 
+// Short window and 8 point forward MDCT
+static void forward_mdct(struct lbr_decoder *lbr, int ch, int sf, float (*values)[4])
+{
+    int i, nsubbands = lbr->nsubbands;
+
+#if HAVE_SSE
+    // Four subbands are transformed at once. Subband samples are transposed
+    // on load and the result is kept transposed until after aliasing
+    // cancellation, which then also works on whole vectors.
+    float cols[4][LBR_SUBBANDS];
+
+    const __m128 sw0 = _mm_set1_ps((float)SW0);
+    const __m128 sw1 = _mm_set1_ps((float)SW1);
+    const __m128 sw2 = _mm_set1_ps((float)SW2);
+    const __m128 sw3 = _mm_set1_ps((float)SW3);
+    const __m128 c1 = _mm_set1_ps((float)C1);
+    const __m128 c2 = _mm_set1_ps((float)C2);
+    const __m128 c3 = _mm_set1_ps((float)C3);
+    const __m128 c4 = _mm_set1_ps((float)C4);
+
+    for (i = 0; i < nsubbands; i += 4) {
+        const float *samples = &lbr->time_samples[ch][i][LBR_TIME_HISTORY + sf * 4];
+        const int stride = LBR_TIME_HISTORY + LBR_TIME_SAMPLES;
+
+        __m128 l0 = _mm_loadu_ps(samples - 4 + 0 * stride);
+        __m128 l1 = _mm_loadu_ps(samples - 4 + 1 * stride);
+        __m128 l2 = _mm_loadu_ps(samples - 4 + 2 * stride);
+        __m128 l3 = _mm_loadu_ps(samples - 4 + 3 * stride);
+        _MM_TRANSPOSE4_PS(l0, l1, l2, l3);
+
+        __m128 h0 = _mm_loadu_ps(samples + 0 * stride);
+        __m128 h1 = _mm_loadu_ps(samples + 1 * stride);
+        __m128 h2 = _mm_loadu_ps(samples + 2 * stride);
+        __m128 h3 = _mm_loadu_ps(samples + 3 * stride);
+        _MM_TRANSPOSE4_PS(h0, h1, h2, h3);
+
+        __m128 a = _mm_sub_ps(_mm_mul_ps(l0, sw0), _mm_mul_ps(l3, sw3));
+        __m128 b = _mm_sub_ps(_mm_mul_ps(l1, sw1), _mm_mul_ps(l2, sw2));
+        __m128 c = _mm_add_ps(_mm_mul_ps(h2, sw1), _mm_mul_ps(h1, sw2));
+        __m128 d = _mm_add_ps(_mm_mul_ps(h3, sw0), _mm_mul_ps(h0, sw3));
+
+        _mm_storeu_ps(&cols[0][i], _mm_sub_ps(_mm_add_ps(_mm_sub_ps(_mm_mul_ps(c1, b), _mm_mul_ps(c2, c)), _mm_mul_ps(c4, a)), _mm_mul_ps(c3, d)));
+        _mm_storeu_ps(&cols[1][i], _mm_sub_ps(_mm_sub_ps(_mm_sub_ps(_mm_mul_ps(c1, d), _mm_mul_ps(c2, a)), _mm_mul_ps(c4, b)), _mm_mul_ps(c3, c)));
+        _mm_storeu_ps(&cols[2][i], _mm_add_ps(_mm_sub_ps(_mm_add_ps(_mm_mul_ps(c3, b), _mm_mul_ps(c2, d)), _mm_mul_ps(c4, c)), _mm_mul_ps(c1, a)));
+        _mm_storeu_ps(&cols[3][i], _mm_sub_ps(_mm_add_ps(_mm_sub_ps(_mm_mul_ps(c3, a), _mm_mul_ps(c2, b)), _mm_mul_ps(c4, d)), _mm_mul_ps(c1, c)));
+    }
+
+    // Aliasing cancellation for high frequencies. Each iteration only touches
+    // its own pair of subbands, so they are all independent.
+    const __m128 al1 = _mm_set1_ps((float)AL1);
+    const __m128 al2 = _mm_set1_ps((float)AL2);
+
+    for (i = 12; i + 4 <= nsubbands - 1; i += 4) {
+        __m128 a = _mm_mul_ps(_mm_loadu_ps(&cols[3][i    ]), al1);
+        __m128 b = _mm_mul_ps(_mm_loadu_ps(&cols[0][i + 1]), al1);
+        _mm_storeu_ps(&cols[3][i    ], _mm_add_ps(_mm_loadu_ps(&cols[3][i    ]), _mm_sub_ps(b, a)));
+        _mm_storeu_ps(&cols[0][i + 1], _mm_sub_ps(_mm_loadu_ps(&cols[0][i + 1]), _mm_add_ps(b, a)));
+        a = _mm_mul_ps(_mm_loadu_ps(&cols[2][i    ]), al2);
+        b = _mm_mul_ps(_mm_loadu_ps(&cols[1][i + 1]), al2);
+        _mm_storeu_ps(&cols[2][i    ], _mm_add_ps(_mm_loadu_ps(&cols[2][i    ]), _mm_sub_ps(b, a)));
+        _mm_storeu_ps(&cols[1][i + 1], _mm_sub_ps(_mm_loadu_ps(&cols[1][i + 1]), _mm_add_ps(b, a)));
+    }
+
+    for (; i < nsubbands - 1; i++) {
+        float a = cols[3][i  ] * (float)AL1;
+        float b = cols[0][i+1] * (float)AL1;
+        cols[3][i  ] += b - a;
+        cols[0][i+1] -= b + a;
+        a = cols[2][i  ] * (float)AL2;
+        b = cols[1][i+1] * (float)AL2;
+        cols[2][i  ] += b - a;
+        cols[1][i+1] -= b + a;
+    }
+
+    for (i = 0; i < nsubbands; i += 4) {
+        __m128 v0 = _mm_loadu_ps(&cols[0][i]);
+        __m128 v1 = _mm_loadu_ps(&cols[1][i]);
+        __m128 v2 = _mm_loadu_ps(&cols[2][i]);
+        __m128 v3 = _mm_loadu_ps(&cols[3][i]);
+        _MM_TRANSPOSE4_PS(v0, v1, v2, v3);
+        _mm_storeu_ps(values[i + 0], v0);
+        _mm_storeu_ps(values[i + 1], v1);
+        _mm_storeu_ps(values[i + 2], v2);
+        _mm_storeu_ps(values[i + 3], v3);
+    }
+#else
+    for (i = 0; i < nsubbands; i++) {
+        float *samples = &lbr->time_samples[ch][i][LBR_TIME_HISTORY + sf * 4];
+
+        float a = samples[-4] * SW0 - samples[-1] * SW3;
+        float b = samples[-3] * SW1 - samples[-2] * SW2;
+        float c = samples[ 2] * SW1 + samples[ 1] * SW2;
+        float d = samples[ 3] * SW0 + samples[ 0] * SW3;
+
+        values[i][0] = C1 * b - C2 * c + C4 * a - C3 * d;
+        values[i][1] = C1 * d - C2 * a - C4 * b - C3 * c;
+        values[i][2] = C3 * b + C2 * d - C4 * c + C1 * a;
+        values[i][3] = C3 * a - C2 * b + C4 * d - C1 * c;
+    }
+
+    // Aliasing cancellation for high frequencies
+    for (i = 12; i < nsubbands - 1; i++) {
+        float a = values[i  ][3] * AL1;
+        float b = values[i+1][0] * AL1;
+        values[i  ][3] += b - a;
+        values[i+1][0] -= b + a;
+        a = values[i  ][2] * AL2;
+        b = values[i+1][1] * AL2;
+        values[i  ][2] += b - a;
+        values[i+1][1] -= b + a;
+    }
+#endif
+}
+
+// Long window and overlap-add
+static void overlap_add(struct lbr_decoder *lbr, int ch, int *output, const float *values)
+{
+    int i, n = 32 << lbr->freq_range;
+    const float *w1 = lbr->window[0];
+    const float *w2 = lbr->window[1];
+    float *history = lbr->imdct_history[ch];
+
+    i = 0;
+
+#if HAVE_SSE2
+    for (; i < n; i += 4) {
+        __m128 v1 = _mm_loadu_ps(&values[i]);
+        __m128 v2 = _mm_loadu_ps(&values[n + i]);
+        __m128 out = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(&w1[i]), v1), _mm_loadu_ps(&history[i]));
+        _mm_storeu_si128((__m128i *)&output[i], _mm_cvtps_epi32(out));
+        _mm_storeu_ps(&history[i], _mm_mul_ps(_mm_loadu_ps(&w2[i]), v2));
+    }
+#endif
+
+    for (; i < n; i++) {
+        output[i] = lrintf(w1[i] * values[i] + history[i]);
+        history[i] = w2[i] * values[n + i];
+    }
+}
+
 static void transform_channel(struct lbr_decoder *lbr, int ch)
 {
     float values[LBR_SUBBANDS * 2][4];
     int *output = lbr->channel_buffer[ch];
     int noutsubbands = 8 << lbr->freq_range;
-    int step = 1 << (2 - lbr->freq_range);
     int i, sf, nsubbands = lbr->nsubbands;
 
     for (sf = 0; sf < LBR_TIME_SAMPLES / 4; sf++) {
-        // Short window and 8 point forward MDCT
-        for (i = 0; i < nsubbands; i++) {
-            float *samples = &lbr->time_samples[ch][i][LBR_TIME_HISTORY + sf * 4];
-
-            float a = samples[-4] * SW0 - samples[-1] * SW3;
-            float b = samples[-3] * SW1 - samples[-2] * SW2;
-            float c = samples[ 2] * SW1 + samples[ 1] * SW2;
-            float d = samples[ 3] * SW0 + samples[ 0] * SW3;
-
-            values[i][0] = C1 * b - C2 * c + C4 * a - C3 * d;
-            values[i][1] = C1 * d - C2 * a - C4 * b - C3 * c;
-            values[i][2] = C3 * b + C2 * d - C4 * c + C1 * a;
-            values[i][3] = C3 * a - C2 * b + C4 * d - C1 * c;
-        }
-
-        // Aliasing cancellation for high frequencies
-        for (i = 12; i < nsubbands - 1; i++) {
-            float a = values[i  ][3] * AL1;
-            float b = values[i+1][0] * AL1;
-            values[i  ][3] += b - a;
-            values[i+1][0] -= b + a;
-            a = values[i  ][2] * AL2;
-            b = values[i+1][1] * AL2;
-            values[i  ][2] += b - a;
-            values[i+1][1] -= b + a;
-        }
+        forward_mdct(lbr, ch, sf, values);
 
         // Clear inactive subbands
         if (nsubbands < noutsubbands)
@@ -1750,26 +1873,8 @@ static void transform_channel(struct lbr_decoder *lbr, int ch)
 
         imdct_fast(lbr->imdct, values[0], values[0]);
 
-        // Long window and overlap-add
-        const float *w1 = &long_window[0];
-        const float *w2 = &long_window[128 - 4 * step];
-        float *history = lbr->imdct_history[ch];
-        for (i = 0; i < noutsubbands; i++) {
-            output[0] = lrintf(w1[0 * step] * values[i][0] + history[0]);
-            output[1] = lrintf(w1[1 * step] * values[i][1] + history[1]);
-            output[2] = lrintf(w1[2 * step] * values[i][2] + history[2]);
-            output[3] = lrintf(w1[3 * step] * values[i][3] + history[3]);
-
-            history[0] = w2[3 * step] * values[noutsubbands + i][0];
-            history[1] = w2[2 * step] * values[noutsubbands + i][1];
-            history[2] = w2[1 * step] * values[noutsubbands + i][2];
-            history[3] = w2[0 * step] * values[noutsubbands + i][3];
-
-            output  += 4;
-            history += 4;
-            w1 += 4 * step;
-            w2 -= 4 * step;
-        }
+        overlap_add(lbr, ch, output, values[0]);
+        output += noutsubbands * 4;
     }
 
     // Update history for LPC and forward MDCT
@@ -1779,36 +1884,82 @@ static void transform_channel(struct lbr_decoder *lbr, int ch)
     }
 }
 
-#define LFE_IIR_SCALE   (64 * 0x7fffff * 0.0000078265894)
-
+// The biquad cascade is evaluated in state-space form in double precision,
+// see lbr_iir_tables.h. Output differs from the single precision cascade by
+// the rounding error of the latter, about 1e-3 of the peak with its poles
+// this close to the unit circle.
 static void interpolate_lfe(struct lbr_decoder *lbr)
 {
     int *output = lbr->output_samples[SPEAKER_LFE1];
 
-    for (int i = 0; i < 64; i++) {
-        float res1 = lbr->lfe_data[i] * LFE_IIR_SCALE;
-        float res2;
-
-        for (int j = 0; j < 64; j++) {
-            for (int k = 0; k < 5; k++) {
-                float tmp1 = lbr->lfe_history[k][0];
-                float tmp2 = lbr->lfe_history[k][1];
+    // Load history
+    double input[11];
+    for (int i = 0; i < 10; i++)
+        input[i] = lbr->lfe_history[i];
 
-                res2 = tmp1 * lfe_iir[k][0] + tmp2 * lfe_iir[k][1] + res1;
-                res1 = tmp1 * lfe_iir[k][2] + tmp2 * lfe_iir[k][3] + res2;
-
-                lbr->lfe_history[k][0] = tmp2;
-                lbr->lfe_history[k][1] = res2;
+    // Interpolation
+    for (int i = 0; i < 64; i++) {
+        int j, k;
+
+        input[10] = lbr->lfe_data[i];
+
+        // One decimated sample generates 64 interpolated ones, all of them
+        // independent of each other
+#if HAVE_SSE2
+        for (j = 0; j < 64; j += 4) {
+            __m128d res0 = _mm_setzero_pd();
+            __m128d res1 = _mm_setzero_pd();
+            for (k = 0; k < 11; k++) {
+                __m128d in = _mm_set1_pd(input[k]);
+                res0 = _mm_add_pd(res0, _mm_mul_pd(_mm_loadu_pd(&lbr_lfe_iir_output[k][j + 0]), in));
+                res1 = _mm_add_pd(res1, _mm_mul_pd(_mm_loadu_pd(&lbr_lfe_iir_output[k][j + 2]), in));
             }
 
-            *output++ = lrintf(res1);
-            res1 = 0.0;
+            // Save interpolated samples
+            __m128i res = _mm_unpacklo_epi64(_mm_cvtpd_epi32(res0), _mm_cvtpd_epi32(res1));
+            _mm_storeu_si128((__m128i *)output, res);
+            output += 4;
+        }
+#else
+        double res[64];
+        for (j = 0; j < 64; j++)
+            res[j] = lbr_lfe_iir_output[0][j] * input[0];
+        for (k = 1; k < 11; k++)
+            for (j = 0; j < 64; j++)
+                res[j] += lbr_lfe_iir_output[k][j] * input[k];
+
+        // Save interpolated samples
+        for (j = 0; j < 64; j++)
+            *output++ = lrint(res[j]);
+#endif
+
+        // Advance filter history
+        double history[10];
+        for (j = 0; j < 10; j++) {
+            history[j] = lbr_lfe_iir_state[0][j] * input[0];
+            for (k = 1; k < 11; k++)
+                history[j] += lbr_lfe_iir_state[k][j] * input[k];
         }
+        for (j = 0; j < 10; j++)
+            input[j] = history[j];
     }
+
+    // Store history
+    for (int i = 0; i < 10; i++)
+        lbr->lfe_history[i] = input[i];
 }
 
 int lbr_filter(struct lbr_decoder *lbr)
 {
+    // Reallocate output buffer
+    int ret = ta_zalloc_fast(lbr, &lbr->output_buffer, lbr->nchannels * LBR_TIME_SAMPLES * LBR_SUBBANDS, sizeof(int));
+    if (ret < 0)
+        return -DCADEC_ENOMEM;
+    if (ret > 0) {
+        for (int ch = 0; ch < lbr->nchannels; ch++)
+            lbr->channel_buffer[ch] = lbr->output_buffer + ch * LBR_TIME_SAMPLES * LBR_SUBBANDS;
+    }
+
     if (lbr->undo_dmix) {
         random_ts(lbr, LBR_CHANNELS - 2);
         random_ts(lbr, LBR_CHANNELS - 1);
@@ -1885,5 +2036,18 @@ void lbr_clear(struct lbr_decoder *lbr)
         memset(lbr->lfe_history, 0, sizeof(lbr->lfe_history));
         lbr->framenum = 0;
         lbr->ntones = 0;
+        lbr->lbr_rand = 1;
+    }
+}
+
+void lbr_trim(struct lbr_decoder *lbr)
+{
+    // Time sample and IMDCT histories are kept, the output buffer is filled
+    // from scratch by every frame
+    if (lbr) {
+        ta_free(lbr->output_buffer);
+        lbr->output_buffer = NULL;
+        memset(lbr->channel_buffer, 0, sizeof(lbr->channel_buffer));
+        memset(lbr->output_samples, 0, sizeof(lbr->output_samples));
     }
 }
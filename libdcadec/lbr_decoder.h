@@ -116,13 +116,13 @@ struct lbr_decoder {
     int ntones;
 
     float lfe_data[64];
-    float lfe_history[5][2];
+    double lfe_history[10];
 
     struct idct_context *imdct;
-    float sin_tab[256];
-    float lpc_tab[16];
+    float window[2][LBR_SUBBANDS * 4];
 
-    int channel_buffer[LBR_CHANNELS][LBR_TIME_SAMPLES * LBR_SUBBANDS];
+    int *output_buffer;                     ///< Output of all channels, released by lbr_trim()
+    int *channel_buffer[LBR_CHANNELS];      ///< Output of each channel
 
     int *output_samples[SPEAKER_COUNT];
     int output_mask;
@@ -131,5 +131,6 @@ struct lbr_decoder {
 int lbr_parse(struct lbr_decoder *lbr, uint8_t *data, size_t size, struct exss_asset *asset);
 int lbr_filter(struct lbr_decoder *lbr);
 void lbr_clear(struct lbr_decoder *lbr) __attribute__((cold));
+void lbr_trim(struct lbr_decoder *lbr) __attribute__((cold));
 
 #endif
@@ -0,0 +1,292 @@
+/*
+ * This file is part of libdcadec.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation; either version 2.1 of the License, or (at your
+ * option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+// Generated by tablegen.c, do not edit
+
+#ifndef LBR_IIR_TABLES_H
+#define LBR_IIR_TABLES_H
+
+// LBR LFE interpolation IIR in state-space form, like the core one in
+// iir_float.h: one block of 64 interpolated samples and the filter history
+// after it are linear functions of the history before it (rows 0-9) and of
+// the decimated input sample (row 10).
+//
+// Response of the single precision cascade of five biquad sections in
+// tablegen.c to a unit value in each row, evaluated in double precision, with
+// the input scale folded into row 10.
+
+static const double lbr_lfe_iir_output[11][64] = {
+    {
+         1.38153433799743652e-02, -2.33257757467697502e-03, -1.78828057852452246e-02, -3.29001307047044611e-02,
+        -4.74472696372036581e-02, -6.15849531318964916e-02, -7.53720082583159146e-02, -8.88654398035602089e-02,
+        -1.02120509431090190e-01, -1.15190812840332502e-01, -1.28128354965837410e-01, -1.40983623254174795e-01,
+        -1.53805659056279964e-01, -1.66642127172369037e-01, -1.79539383586122092e-01, -1.92542541424244540e-01,
+        -2.05695535176991129e-01, -2.19041183214841340e-01, -2.32621248635787481e-01, -2.46476498477493422e-01,
+        -2.60646761327691934e-01, -2.75170983366084698e-01, -2.90087282870111096e-01, -3.05433003216780463e-01,
+        -3.21244764412121242e-01, -3.37558513179153863e-01, -3.54409571635017073e-01, -3.71832684587609208e-01,
+        -3.89862065480556907e-01, -4.08531441016457109e-01, -4.27874094486426770e-01, -4.47922907834310990e-01,
+        -4.68710402482955146e-01, -4.90268778949655371e-01, -5.12629955278455895e-01, -5.35825604313046711e-01,
+        -5.59887189839741950e-01, -5.84846001621343703e-01, -6.10733189350924022e-01, -6.37579795546400874e-01,
+        -6.65416787412425492e-01, -6.94275087691750059e-01, -7.24185604527662008e-01, -7.55179260364030824e-01,
+        -7.87287019900560381e-01, -8.20539917128002116e-01, -8.54969081462684244e-01, -8.90605763002383810e-01,
+        -9.27481356923465228e-01, -9.65627427039180475e-01, -1.00507572853774718e+00, -1.04585822992180510e+00,
+        -1.08800713416485451e+00, -1.13155489910559481e+00, -1.17653425709607973e+00, -1.22297823392284499e+00,
+        -1.27092016701561761e+00, -1.32039372296526381e+00, -1.37143291435955916e+00, -1.42407211596145089e+00,
+        -1.47834608023867986e+00, -1.53428995226204279e+00, -1.59193928399020024e+00, -1.65133004794927274e+00,
+    },
+    {
+         2.07495689392089844e-03,  1.78934710395424190e-02,  3.31705831787385066e-02,  4.79699424348425663e-02,
+         6.23531824129678891e-02,  7.63800056561170226e-02,  9.01082659939328456e-02,  1.03594048824392271e-01,
+         1.16891749368209785e-01,  1.30054148935276892e-01,  1.43132489241772021e-01,  1.56176544816249319e-01,
+         1.69234693532303027e-01,  1.82353985305018895e-01,  1.95580208987847115e-01,  2.08957957505957026e-01,
+         2.22530691261736635e-01,  2.36340799847466698e-01,  2.50429662099733719e-01,  2.64837704529636397e-01,
+         2.79604458162193481e-01,  2.94768613818334302e-01,  3.10368075871274129e-01,  3.26440014510154697e-01,
+         3.43020916541625809e-01,  3.60146634760887707e-01,  3.77852435922399366e-01,  3.96173047340269591e-01,
+         4.15142702148095566e-01,  4.34795183246620809e-01,  4.55163865968430059e-01,  4.76281759487093836e-01,
+         4.98181546998850422e-01,  5.20895624702816917e-01,  5.44456139608286094e-01,  5.68895026192521414e-01,
+         5.94244041937272982e-01,  6.20534801766751798e-01,  6.47798811414105558e-01,  6.76067499738962852e-01,
+         7.05372250019252078e-01,  7.35744430244210434e-01,  7.67215422425579163e-01,  7.99816650955165187e-01,
+         8.33579610026959017e-01,  8.68535890146631573e-01,  9.04717203750578847e-01,  9.42155409951396905e-01,
+         9.80882538435594142e-01,  1.02093081252843376e+00,  1.06233267144779120e+00,  1.10512079176487532e+00,
+         1.14932810809267494e+00,  1.19498783301429512e+00,  1.24213347627920712e+00,  1.29079886327218674e+00,
+         1.34101815278359027e+00,  1.39282585408824389e+00,  1.44625684335653659e+00,  1.50134637940720950e+00,
+         1.55813011882185037e+00,  1.61664413043422428e+00,  1.67692490920831005e+00,  1.73900938952135675e+00,
+    },
+    {
+         1.11684799194335938e-02,  9.03398523314535851e-03,  6.96047107872765913e-03,  4.94452056947242147e-03,
+         2.98278195867092422e-03,  1.07196750769258942e-03, -7.91147638684402965e-04, -2.60972656936137026e-03,
+        -4.38687171614954297e-03, -6.12562595484045236e-03, -7.82897369786705877e-03, -9.49984197820991083e-03,
+        -1.11411015243824685e-02, -1.27555678261667138e-02, -1.43460021908658475e-02, -1.59151127898352063e-02,
+        -1.74655556950745472e-02, -1.89999359056015060e-02, -2.05208083634666819e-02, -2.20306789591019625e-02,
+        -2.35320055258824157e-02, -2.50271988236646648e-02, -2.65186235110703716e-02, -2.80085991064301654e-02,
+        -2.94994009371010169e-02, -3.09932610770822237e-02, -3.24923692726861724e-02, -3.39988738561678439e-02,
+        -3.55148826471247681e-02, -3.70424638415305374e-02, -3.85836468883016259e-02, -4.01404233532063337e-02,
+        -4.17147477700634539e-02, -4.33085384790308225e-02, -4.49236784519220222e-02, -4.65620161045077197e-02,
+        -4.82253660955445085e-02, -4.99155101126023126e-02, -5.16341976444731898e-02, -5.33831467402237081e-02,
+        -5.51640447546830615e-02, -5.69785490803589312e-02, -5.88282878657064856e-02, -6.07148607197220969e-02,
+        -6.26398394028342409e-02, -6.46047685038446673e-02, -6.66111661032573465e-02, -6.86605244225688693e-02,
+        -7.07543104597299077e-02, -7.28939666107635276e-02, -7.50809112772614640e-02, -7.73165394601385003e-02,
+        -7.96022233393038903e-02, -8.19393128394239056e-02, -8.43291361817826157e-02, -8.67730004220064188e-02,
+        -8.92721919741319425e-02, -9.18279771205163797e-02, -9.44416025080485610e-02, -9.71142956301491722e-02,
+        -9.98472652954873752e-02, -1.02641702082436836e-01, -1.05498778779882230e-01, -1.08419650814340685e-01,
+    },
+    {
+        -9.26542282104492188e-03, -7.15169203846244272e-03, -5.09634872123528732e-03, -3.09599869344225065e-03,
+        -1.14731252947279649e-03,  7.52975581902848301e-04,  2.60806896585083492e-03,  4.42110958183972169e-03,
+         6.19517913579650803e-03,  7.93330018375357215e-03,  9.63843722671237080e-03,  1.13134977964385597e-02,
+         1.29613335320000467e-02,  1.45847412466618143e-02,  1.61864639850362174e-02,  1.77691920701681522e-02,
+         1.93355641403178957e-02,  2.08881681752767223e-02,  2.24295425119622749e-02,  2.39621768490683174e-02,
+         2.54885132405970882e-02,  2.70109470781010330e-02,  2.85318280613964248e-02,  3.00534611575764554e-02,
+         3.15781075482073348e-02,  3.31079855644706988e-02,  3.46452716101368630e-02,  3.61921010722210390e-02,
+         3.77505692191344444e-02,  3.93227320862195029e-02,  4.09106073485920874e-02,  4.25161751810421151e-02,
+         4.41413791049827253e-02,  4.57881268222930515e-02,  4.74582910359533372e-02,  4.91537102573680329e-02,
+         5.08761896002951630e-02,  5.26275015612736041e-02,  5.44093867865154124e-02,  5.62235548251273087e-02,
+         5.80716848686524401e-02,  5.99554264767814260e-02,  6.18764002893037457e-02,  6.38361987241431450e-02,
+         6.58363866614699589e-02,  6.78785021137890965e-02,  6.99640568822239572e-02,  7.20945371984420547e-02,
+         7.42714043529026924e-02,  7.64960953087410189e-02,  7.87700233016899176e-02,  8.10945784259189395e-02,
+         8.34711282057583048e-02,  8.59010181532902095e-02,  8.83855723118927017e-02,  9.09260937858817897e-02,
+         9.35238652556407146e-02,  9.61801494792595690e-02,  9.88961897797082656e-02,  1.01673210518470114e-01,
+         1.04512417554843751e-01,  1.07414998691474750e-01,  1.10382124106280344e-01,  1.13414946770078018e-01,
+    },
+    {
+         7.47913122177124023e-03,  6.66596837717747803e-03,  5.86611703975565418e-03,  5.07911854822064301e-03,
+         4.30451665001831130e-03,  3.54185761211739392e-03,  2.79069032979306630e-03,  2.05056643340434386e-03,
+         1.32104039318575728e-03,  6.01669622059652909e-04, -1.07985423546508308e-04, -8.08361144842395518e-04,
+        -1.49989070379596967e-03, -2.18300392814474442e-03, -2.85812721846595563e-03, -3.52568345705539521e-03,
+        -4.18609191880991993e-03, -4.83976818400755349e-03, -5.48712405296525318e-03, -6.12856746261536411e-03,
+        -6.76450240495107824e-03, -7.39532884733173912e-03, -8.02144265469872941e-03, -8.64323551352141894e-03,
+        -9.26109485767867557e-03, -9.87540379616203001e-03, -1.04865410424690442e-02, -1.10948808459537807e-02,
+        -1.17007929248083564e-02, -1.23046424009050637e-02, -1.29067897363703277e-02, -1.35075906718272049e-02,
+        -1.41073961665092174e-02, -1.47065523399234066e-02, -1.53054004153174716e-02, -1.59042766647590206e-02,
+        -1.65035123559663655e-02, -1.71034337006761294e-02, -1.77043618047496576e-02, -1.83066126198361268e-02,
+        -1.89104968966882225e-02, -1.95163201400339048e-02, -2.01243825649939367e-02, -2.07349790551853985e-02,
+        -2.13483991221918856e-02, -2.19649268667758690e-02, -2.25848409413655915e-02, -2.32084145142152920e-02,
+        -2.38359152350380299e-02, -2.44676052019991985e-02, -2.51037409302838910e-02, -2.57445733220276196e-02,
+        -2.63903476376334822e-02, -2.70413034687138065e-02, -2.76976747120833977e-02, -2.83596895454092390e-02,
+        -2.90275704041231819e-02, -2.97015339596509165e-02, -3.03817910990265005e-02, -3.10685469057734309e-02,
+        -3.17620006421979184e-02, -3.24623457327426479e-02, -3.31697697489143906e-02, -3.38844543952117050e-02,
+    },
+    {
+        -6.75165653228759766e-03, -5.94068242844514316e-03, -5.14267616586891463e-03, -4.35717846416620869e-03,
+        -3.58373257523833533e-03, -2.82188439301833682e-03, -2.07118256117111432e-03, -1.33117857880130086e-03,
+        -6.01426904157847941e-04,  1.18514943640735115e-04,  8.29086284903801651e-04,  1.53072318160074605e-03,
+         2.22385834158150830e-03,  2.90892102475454051e-03,  3.58633695119309204e-03,  4.25652821122740610e-03,
+         4.91991317739276512e-03,  5.57690641837688128e-03,  6.22791861479843334e-03,  6.87335647691184048e-03,
+         7.51362266424737690e-03,  8.14911570700022070e-03,  8.78022992940524771e-03,  9.40735537486425688e-03,
+         1.00308777329671250e-02,  1.06511782683109124e-02,  1.12686337511314905e-02,  1.18836163896754721e-02,
+         1.24964937644870405e-02,  1.31076287642897249e-02,  1.37173795237752749e-02,  1.43260993629948374e-02,
+         1.49341367286220938e-02,  1.55418351367733187e-02,  1.61495331176029211e-02,  1.67575641616346527e-02,
+         1.73662566675980568e-02,  1.79759338920635336e-02,  1.85869139006857864e-02,  1.91995095209906985e-02,
+         1.98140282968246595e-02,  2.04307724443881789e-02,  2.10500388098520119e-02,  2.16721188285649013e-02,
+         2.22972984856566470e-02,  2.29258582783646858e-02,  2.35580731797311316e-02,  2.41942126038976468e-02,
+         2.48345403727912029e-02,  2.54793146843130813e-02,  2.61287880820475493e-02,  2.67832074262823738e-02,
+         2.74428138665205879e-02,  2.81078428153982429e-02,  2.87785239239841673e-02,  2.94550810584581768e-02,
+         3.01377322781117840e-02,  3.08266898147451229e-02,  3.15221600534201229e-02,  3.22243435143647616e-02,
+         3.29334348363694573e-02,  3.36496227614411225e-02,  3.43730901205621109e-02,  3.51040138209164354e-02,
+    },
+    {
+         4.08309698104858398e-03,  3.67722941387427227e-03,  3.27363007640849371e-03,  2.87228185659747087e-03,
+         2.47316693682551186e-03,  2.07626682933848006e-03,  1.68156241169734044e-03,  1.28903396225264755e-03,
+         8.98661195630284793e-04,  5.10423298184903285e-04,  1.24298963451618949e-04, -2.59733572479936559e-04,
+        -6.41696495623123031e-04, -1.02161237884806910e-03, -1.39950414670003687e-03, -1.77539504037255158e-03,
+        -2.14930858276507486e-03, -2.52126854366913067e-03, -2.89129890517869637e-03, -3.25942382716909451e-03,
+        -3.62566761301647000e-03, -3.99005467555946236e-03, -4.35260950314031447e-03, -4.71335662603999950e-03,
+        -5.07232058299411648e-03, -5.42952588809875181e-03, -5.78499699790990807e-03, -6.13875827883780811e-03,
+        -6.49083397485261671e-03, -6.84124817548753539e-03, -7.19002478420957547e-03, -7.53718748703198493e-03,
+        -7.88275972157129190e-03, -8.22676464645308303e-03, -8.56922511103122564e-03, -8.91016362555568930e-03,
+        -9.24960233173760527e-03, -9.58756297365548349e-03, -9.92406686927038706e-03, -1.02591348820399997e-02,
+        -1.05927873933898686e-02, -1.09250442753499044e-02, -1.12559248637147391e-02, -1.15854479317978321e-02,
+        -1.19136316645267470e-02, -1.22404936331479419e-02, -1.25660507703941882e-02, -1.28903193461966659e-02,
+        -1.32133149438322661e-02, -1.35350524368167413e-02, -1.38555459660527625e-02, -1.41748089178155290e-02,
+        -1.44928539021851321e-02, -1.48096927319771865e-02, -1.51253364023400394e-02, -1.54397950709741494e-02,
+        -1.57530780388768221e-02, -1.60651937317064508e-02, -1.63761496817391716e-02, -1.66859525105476081e-02,
+        -1.69946079121041649e-02, -1.73021206367494074e-02, -1.76084944755920958e-02, -1.79137322456828230e-02,
+    },
+    {
+        -3.69644165039062500e-03, -3.29008132484887028e-03, -2.88598194766476190e-03, -2.48412592351349160e-03,
+        -2.08449498356991919e-03, -1.68707022101915322e-03, -1.29183212661929114e-03, -8.98760624227321059e-04,
+        -5.07835106342682807e-04, -1.19034469617723682e-04,  2.67662849698646621e-04,  6.52278840350184463e-04,
+         1.03483588073546851e-03,  1.41535670371714661e-03,  1.79386436146458661e-03,  2.17038219045831426e-03,
+         2.54493377664721798e-03,  2.91754292071616517e-03,  3.28823360355232075e-03,  3.65702995191855007e-03,
+         4.02395620425069489e-03,  4.38903667673878894e-03,  4.75229572961149982e-03,  5.11375773365999042e-03,
+         5.47344703700947122e-03,  5.83138793218399010e-03,  6.18760462344122852e-03,  6.54212119438965511e-03,
+         6.89496157596419801e-03,  7.24614951467621171e-03,  7.59570854123459149e-03,  7.94366193949230803e-03,
+         8.29003271576572720e-03,  8.63484356857163737e-03,  8.97811685866223286e-03,  9.31987457958072252e-03,
+         9.66013832849210718e-03,  9.99892927753953664e-03,  1.03362681456700134e-02,  1.06721751707390400e-02,
+         1.10066700822968322e-02,  1.13397720745693764e-02,  1.16714997802787046e-02,  1.20018712446217091e-02,
+         1.23309038998624665e-02,  1.26586145406277772e-02,  1.29850192993266056e-02,  1.33101336225029954e-02,
+         1.36339722474785319e-02,  1.39565491795856644e-02,  1.42778776700787091e-02,  1.45979701944578544e-02,
+         1.49168384314481983e-02,  1.52344932424961499e-02,  1.55509446520269989e-02,  1.58662018280066874e-02,
+         1.61802730634388325e-02,  1.64931657582343405e-02,  1.68048864017382726e-02,  1.71154405560098866e-02,
+         1.74248328395494312e-02,  1.77330669118518358e-02,  1.80401454584240284e-02,  1.83460701765731926e-02,
+    },
+    {
+         1.27714872360229492e-03,  1.00757974271203921e-03,  7.38085207949712441e-04,  4.68737195861823608e-04,
+         1.99607651702571331e-04, -6.92316296646566798e-05, -3.37709022799614900e-04, -6.05753090662908278e-04,
+        -8.73292603484898677e-04, -1.14025655759775191e-03, -1.40657419414580431e-03, -1.67217501773464505e-03,
+        -1.93698881496828790e-03, -2.20094567288242615e-03, -2.46397599730840966e-03, -2.72601053107912605e-03,
+        -2.98698037216382772e-03, -3.24681699164486304e-03, -3.50545225160203699e-03, -3.76281842290282498e-03,
+        -4.01884820274389654e-03, -4.27347473219441554e-03, -4.52663161346933407e-03, -4.77825292722044992e-03,
+        -5.02827324945798182e-03, -5.27662766853254084e-03, -5.52325180182933195e-03, -5.76808181233090522e-03,
+        -6.01105442502358756e-03, -6.25210694312983151e-03, -6.49117726414161211e-03, -6.72820389570816246e-03,
+        -6.96312597133541544e-03, -7.19588326583675553e-03, -7.42641621071982172e-03, -7.65466590924290813e-03,
+        -7.88057415133636141e-03, -8.10408342833568440e-03, -8.32513694748371336e-03, -8.54367864616989436e-03,
+        -8.75965320612692722e-03, -8.97300606717976734e-03, -9.18368344095910061e-03, -9.39163232426665218e-03,
+        -9.59680051235523024e-03, -9.79913661174691697e-03, -9.99859005310810289e-03, -1.01951111036626685e-02,
+        -1.03886508794488464e-02, -1.05791613573487098e-02, -1.07665953867979169e-02, -1.09509067013533468e-02,
+        -1.11320499299765174e-02, -1.13099806079546283e-02, -1.14846551876581771e-02, -1.16560310491777841e-02,
+        -1.18240665103357401e-02, -1.19887208368254505e-02, -1.21499542518392900e-02, -1.23077279454548716e-02,
+        -1.24620040839076296e-02, -1.26127458183944441e-02, -1.27599172936285754e-02, -1.29034836563448607e-02,
+    },
+    {
+        -1.00886821746826172e-03, -7.39029057967854897e-04, -4.69336608512449516e-04, -1.99862906358205805e-04,
+         6.93201618195971037e-05,  3.38140878993087313e-04,  6.06527716760396629e-04,  8.74409354278071760e-04,
+         1.14171469706469964e-03,  1.40837289579387459e-03,  1.67431336491219440e-03,  1.93946580123949275e-03,
+         2.20376020241452864e-03,  2.46712688526429247e-03,  2.72949650405784894e-03,  2.99080006865182213e-03,
+         3.25096896249377210e-03,  3.50993496055096443e-03,  3.76763024706505689e-03,  4.02398743316467744e-03,
+         4.27893957440517170e-03,  4.53242018813426739e-03,  4.78436327065878686e-03,  5.03470331436162155e-03,
+         5.28337532458067471e-03,  5.53031483636345911e-03,  5.77545793105826988e-03,  6.01874125273837990e-03,
+         6.26010202444504671e-03,  6.49947806425643648e-03,  6.73680780118957045e-03,  6.97203029091753024e-03,
+         7.20508523124507860e-03,  7.43591297749190971e-03,  7.66445455759878769e-03,  7.89065168706315490e-03,
+         8.11444678368644645e-03,  8.33578298207982016e-03,  8.55460414794606550e-03,  8.77085489225493120e-03,
+         8.98448058509870862e-03,  9.19542736928491422e-03,  9.40364217387923418e-03,  9.60907272731503781e-03,
+         9.81166757044604765e-03,  1.00113760692792653e-02,  1.02081484273952583e-02,  1.04019356983471312e-02,
+         1.05926897976047485e-02,  1.07803635142929011e-02,  1.09649105228371013e-02,  1.11462853941475259e-02,
+         1.13244436066395338e-02,  1.14993415570481261e-02,  1.16709365709226631e-02,  1.18391869127805194e-02,
+         1.20040517962607396e-02,  1.21654913936453113e-02,  1.23234668454159646e-02,  1.24779402693988573e-02,
+         1.26288747696818859e-02,  1.27762344451411991e-02,  1.29199843979392881e-02,  1.30600907414404332e-02,
+    },
+    {
+         4.20186768812581158e+03, -7.83540433624712023e+01,  3.24378382667237020e+00,  8.22567691994227062e+01,
+         1.58968320906264125e+02,  2.33653098906881496e+02,  3.06577374086366035e+02,  3.77999378492670076e+02,
+         4.48169646863156231e+02,  5.17331349606705771e+02,  5.85720617404389486e+02,  6.53566857591460575e+02,
+         7.21093062478626962e+02,  7.88516109771546326e+02,  8.56047055241579073e+02,  9.23891417803199147e+02,
+         9.92249457146215718e+02,  1.06131644407348358e+03,  1.13128292368928669e+03,  1.20233497158324462e+03,
+         1.27465444315125933e+03,  1.34841921619552886e+03,  1.42380342693766579e+03,  1.50097769958421122e+03,
+         1.58010936957813101e+03,  1.66136270066432189e+03,  1.74489909590256866e+03,  1.83087730275373906e+03,
+         1.91945361236354802e+03,  2.01078205316927051e+03,  2.10501457894820487e+03,  2.20230125143029727e+03,
+         2.30279041758785024e+03,  2.40662888172065141e+03,  2.51396207244927064e+03,  2.62493420472589787e+03,
+         2.73968843697418924e+03,  2.85836702346208040e+03,  2.98111146201775409e+03,  3.10806263718893752e+03,
+         3.23936095894104801e+03,  3.37514649701106828e+03,  3.51555911099177320e+03,  3.66073857626412064e+03,
+         3.81082470584986731e+03,  3.96595746830059215e+03,  4.12627710169134662e+03,  4.29192422381904908e+03,
+         4.46303993868967518e+03,  4.63976593938213773e+03,  4.82224460736033507e+03,  5.01061910833953880e+03,
+         5.20503348474553786e+03,  5.40563274489575997e+03,  5.61256294893450104e+03,  5.82597129161935300e+03,
+         6.04600618202658370e+03,  6.27281732025044039e+03,  6.50655577115109190e+03,  6.74737403525132686e+03,
+         6.99542611679807305e+03,  7.25086758911469951e+03,  7.51385565724922344e+03,  7.78454921802598983e+03,
+    },
+};
+
+static const double lbr_lfe_iir_state[11][10] = {
+    {
+        -4.00789360518053215e+01, -4.04236706025156636e+01, -4.21012982461583363e+02, -4.38670106114961243e+02,
+        -5.30852972536280390e+02, -5.57760285699799397e+02, -5.65413171388636215e+02, -5.95623933700398197e+02,
+        -5.91407853060118782e+02, -6.23937448855370462e+02,
+    },
+    {
+         4.09899609887066845e+01,  4.13322889952338954e+01,  4.45410460271125487e+02,  4.63716430475056313e+02,
+         5.66834960626221118e+02,  5.95139437222201991e+02,  6.05501713283449476e+02,  6.37416667286416782e+02,
+         6.34397725911377051e+02,  6.68840634632138404e+02,
+    },
+    {
+         0.00000000000000000e+00,  0.00000000000000000e+00, -4.16538668568707351e+01, -4.20041254418653693e+01,
+        -4.21010015463012408e+01, -4.41348018744163682e+01, -4.41702838234654820e+01, -4.64465201014521369e+01,
+        -4.58041862257219137e+01, -4.82503923180233159e+01,
+    },
+    {
+         0.00000000000000000e+00,  0.00000000000000000e+00,  4.24785462324694976e+01,  4.28240397465483724e+01,
+         4.51401868963516151e+01,  4.72543321659259874e+01,  4.76692951649416656e+01,  5.00578218951027907e+01,
+         4.96213403932640063e+01,  5.22011511046087406e+01,
+    },
+    {
+         0.00000000000000000e+00,  0.00000000000000000e+00,  0.00000000000000000e+00,  0.00000000000000000e+00,
+        -4.41787344739000645e+01, -4.45440141989116398e+01, -1.29416628657977064e+01, -1.36961785395593392e+01,
+        -1.31124568350014243e+01, -1.39042834779975433e+01,
+    },
+    {
+         0.00000000000000000e+00,  0.00000000000000000e+00,  0.00000000000000000e+00,  0.00000000000000000e+00,
+         4.48796751787655523e+01,  4.52367505650016994e+01,  1.41585023160633359e+01,  1.49450987305434744e+01,
+         1.44512338141445493e+01,  1.52831061241856379e+01,
+    },
+    {
+         0.00000000000000000e+00,  0.00000000000000000e+00,  0.00000000000000000e+00,  0.00000000000000000e+00,
+         0.00000000000000000e+00,  0.00000000000000000e+00, -4.70660411159833316e+01, -4.74620820299046642e+01,
+        -7.15868970401740157e+00, -7.59194220888074689e+00,
+    },
+    {
+         0.00000000000000000e+00,  0.00000000000000000e+00,  0.00000000000000000e+00,  0.00000000000000000e+00,
+         0.00000000000000000e+00,  0.00000000000000000e+00,  4.76566688305339241e+01,  4.80413276252762529e+01,
+         7.83153410441046471e+00,  8.28257658779384087e+00,
+    },
+    {
+         0.00000000000000000e+00,  0.00000000000000000e+00,  0.00000000000000000e+00,  0.00000000000000000e+00,
+         0.00000000000000000e+00,  0.00000000000000000e+00,  0.00000000000000000e+00,  0.00000000000000000e+00,
+        -5.03279288592686669e+01, -5.07824888859315351e+01,
+    },
+    {
+         0.00000000000000000e+00,  0.00000000000000000e+00,  0.00000000000000000e+00,  0.00000000000000000e+00,
+         0.00000000000000000e+00,  0.00000000000000000e+00,  0.00000000000000000e+00,  0.00000000000000000e+00,
+         5.08474286144836753e+01,  5.12883715132055613e+01,
+    },
+    {
+         1.70765571376588457e+05,  1.72234392615984951e+05,  1.97330358173126914e+06,  2.05004505181925418e+06,
+         2.63502308059687167e+06,  2.76001705529833538e+06,  2.86074743068028335e+06,  3.00427732549666660e+06,
+         3.02499062089330750e+06,  3.18144102260591276e+06,
+    },
+};
+
+#endif
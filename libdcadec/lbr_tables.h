@@ -457,11 +457,3 @@ static const float lfe_step_size_24[144] = {
     1.8627639845328312E+000, 2.0490403233814627E+000, 2.2539444272451910E+000,
     2.4793389414952922E+000, 2.7272728356448215E+000, 2.9999998807906962E+000
 };
-
-static const float lfe_iir[5][4] = {
-    { -0.98618466, 1.9861259, 1.0, -1.9840510 },
-    { -0.98883152, 1.9887193, 1.0, -1.9979848 },
-    { -0.99252087, 1.9923381, 1.0, -1.9990897 },
-    { -0.99591690, 1.9956781, 1.0, -1.9993745 },
-    { -0.99872285, 1.9984550, 1.0, -1.9994639 }
-};
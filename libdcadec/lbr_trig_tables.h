@@ -0,0 +1,105 @@
+/*
+ * This file is part of libdcadec.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation; either version 2.1 of the License, or (at your
+ * option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+// Generated by tablegen.c, do not edit
+
+#ifndef LBR_TRIG_TABLES_H
+#define LBR_TRIG_TABLES_H
+
+// Tonal synthesis oscillator indexed by 8-bit phase
+//
+// cos(i * PI / 128), i = 0 .. 256
+static const float sin_tab[256] = {
+     1.000000000e+00f,  9.996988177e-01f,  9.987954497e-01f,  9.972904325e-01f,
+     9.951847196e-01f,  9.924795628e-01f,  9.891765118e-01f,  9.852776527e-01f,
+     9.807852507e-01f,  9.757021070e-01f,  9.700312614e-01f,  9.637760520e-01f,
+     9.569403529e-01f,  9.495281577e-01f,  9.415440559e-01f,  9.329928160e-01f,
+     9.238795042e-01f,  9.142097831e-01f,  9.039893150e-01f,  8.932242990e-01f,
+     8.819212914e-01f,  8.700869679e-01f,  8.577286005e-01f,  8.448535800e-01f,
+     8.314695954e-01f,  8.175848126e-01f,  8.032075167e-01f,  7.883464098e-01f,
+     7.730104327e-01f,  7.572088242e-01f,  7.409511209e-01f,  7.242470980e-01f,
+     7.071067691e-01f,  6.895405650e-01f,  6.715589762e-01f,  6.531728506e-01f,
+     6.343932748e-01f,  6.152315736e-01f,  5.956993103e-01f,  5.758081675e-01f,
+     5.555702448e-01f,  5.349976420e-01f,  5.141027570e-01f,  4.928981960e-01f,
+     4.713967443e-01f,  4.496113360e-01f,  4.275550842e-01f,  4.052413106e-01f,
+     3.826834261e-01f,  3.598950505e-01f,  3.368898630e-01f,  3.136817515e-01f,
+     2.902846634e-01f,  2.667127550e-01f,  2.429801822e-01f,  2.191012353e-01f,
+     1.950903237e-01f,  1.709618866e-01f,  1.467304677e-01f,  1.224106774e-01f,
+     9.801714122e-02f,  7.356456667e-02f,  4.906767607e-02f,  2.454122901e-02f,
+     6.123234263e-17f, -2.454122901e-02f, -4.906767607e-02f, -7.356456667e-02f,
+    -9.801714122e-02f, -1.224106774e-01f, -1.467304677e-01f, -1.709618866e-01f,
+    -1.950903237e-01f, -2.191012353e-01f, -2.429801822e-01f, -2.667127550e-01f,
+    -2.902846634e-01f, -3.136817515e-01f, -3.368898630e-01f, -3.598950505e-01f,
+    -3.826834261e-01f, -4.052413106e-01f, -4.275550842e-01f, -4.496113360e-01f,
+    -4.713967443e-01f, -4.928981960e-01f, -5.141027570e-01f, -5.349976420e-01f,
+    -5.555702448e-01f, -5.758081675e-01f, -5.956993103e-01f, -6.152315736e-01f,
+    -6.343932748e-01f, -6.531728506e-01f, -6.715589762e-01f, -6.895405650e-01f,
+    -7.071067691e-01f, -7.242470980e-01f, -7.409511209e-01f, -7.572088242e-01f,
+    -7.730104327e-01f, -7.883464098e-01f, -8.032075167e-01f, -8.175848126e-01f,
+    -8.314695954e-01f, -8.448535800e-01f, -8.577286005e-01f, -8.700869679e-01f,
+    -8.819212914e-01f, -8.932242990e-01f, -9.039893150e-01f, -9.142097831e-01f,
+    -9.238795042e-01f, -9.329928160e-01f, -9.415440559e-01f, -9.495281577e-01f,
+    -9.569403529e-01f, -9.637760520e-01f, -9.700312614e-01f, -9.757021070e-01f,
+    -9.807852507e-01f, -9.852776527e-01f, -9.891765118e-01f, -9.924795628e-01f,
+    -9.951847196e-01f, -9.972904325e-01f, -9.987954497e-01f, -9.996988177e-01f,
+    -1.000000000e+00f, -9.996988177e-01f, -9.987954497e-01f, -9.972904325e-01f,
+    -9.951847196e-01f, -9.924795628e-01f, -9.891765118e-01f, -9.852776527e-01f,
+    -9.807852507e-01f, -9.757021070e-01f, -9.700312614e-01f, -9.637760520e-01f,
+    -9.569403529e-01f, -9.495281577e-01f, -9.415440559e-01f, -9.329928160e-01f,
+    -9.238795042e-01f, -9.142097831e-01f, -9.039893150e-01f, -8.932242990e-01f,
+    -8.819212914e-01f, -8.700869679e-01f, -8.577286005e-01f, -8.448535800e-01f,
+    -8.314695954e-01f, -8.175848126e-01f, -8.032075167e-01f, -7.883464098e-01f,
+    -7.730104327e-01f, -7.572088242e-01f, -7.409511209e-01f, -7.242470980e-01f,
+    -7.071067691e-01f, -6.895405650e-01f, -6.715589762e-01f, -6.531728506e-01f,
+    -6.343932748e-01f, -6.152315736e-01f, -5.956993103e-01f, -5.758081675e-01f,
+    -5.555702448e-01f, -5.349976420e-01f, -5.141027570e-01f, -4.928981960e-01f,
+    -4.713967443e-01f, -4.496113360e-01f, -4.275550842e-01f, -4.052413106e-01f,
+    -3.826834261e-01f, -3.598950505e-01f, -3.368898630e-01f, -3.136817515e-01f,
+    -2.902846634e-01f, -2.667127550e-01f, -2.429801822e-01f, -2.191012353e-01f,
+    -1.950903237e-01f, -1.709618866e-01f, -1.467304677e-01f, -1.224106774e-01f,
+    -9.801714122e-02f, -7.356456667e-02f, -4.906767607e-02f, -2.454122901e-02f,
+    -1.836970147e-16f,  2.454122901e-02f,  4.906767607e-02f,  7.356456667e-02f,
+     9.801714122e-02f,  1.224106774e-01f,  1.467304677e-01f,  1.709618866e-01f,
+     1.950903237e-01f,  2.191012353e-01f,  2.429801822e-01f,  2.667127550e-01f,
+     2.902846634e-01f,  3.136817515e-01f,  3.368898630e-01f,  3.598950505e-01f,
+     3.826834261e-01f,  4.052413106e-01f,  4.275550842e-01f,  4.496113360e-01f,
+     4.713967443e-01f,  4.928981960e-01f,  5.141027570e-01f,  5.349976420e-01f,
+     5.555702448e-01f,  5.758081675e-01f,  5.956993103e-01f,  6.152315736e-01f,
+     6.343932748e-01f,  6.531728506e-01f,  6.715589762e-01f,  6.895405650e-01f,
+     7.071067691e-01f,  7.242470980e-01f,  7.409511209e-01f,  7.572088242e-01f,
+     7.730104327e-01f,  7.883464098e-01f,  8.032075167e-01f,  8.175848126e-01f,
+     8.314695954e-01f,  8.448535800e-01f,  8.577286005e-01f,  8.700869679e-01f,
+     8.819212914e-01f,  8.932242990e-01f,  9.039893150e-01f,  9.142097831e-01f,
+     9.238795042e-01f,  9.329928160e-01f,  9.415440559e-01f,  9.495281577e-01f,
+     9.569403529e-01f,  9.637760520e-01f,  9.700312614e-01f,  9.757021070e-01f,
+     9.807852507e-01f,  9.852776527e-01f,  9.891765118e-01f,  9.924795628e-01f,
+     9.951847196e-01f,  9.972904325e-01f,  9.987954497e-01f,  9.996988177e-01f,
+};
+
+// Reflection coefficient dequantization
+//
+// sin((i - 8) * PI / 17), i = 0 .. 8
+// sin((i - 8) * PI / 15), i = 8 .. 16
+static const float lpc_tab[16] = {
+    -9.957341552e-01f, -9.618256688e-01f, -8.951632977e-01f, -7.980172038e-01f,
+    -6.736956239e-01f, -5.264321566e-01f, -3.612416685e-01f, -1.837495118e-01f,
+     0.000000000e+00f,  2.079116851e-01f,  4.067366421e-01f,  5.877852440e-01f,
+     7.431448102e-01f,  8.660253882e-01f,  9.510565400e-01f,  9.945219159e-01f,
+};
+
+#endif
@@ -0,0 +1,108 @@
+/*
+ * This file is part of libdcadec.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation; either version 2.1 of the License, or (at your
+ * option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#ifndef STATS_H
+#define STATS_H
+
+// Define DCADEC_STATS to 0 to compile out the stage timers, counters and trace
+// spans
+#ifndef DCADEC_STATS
+#define DCADEC_STATS    1
+#endif
+
+#if DCADEC_STATS
+
+#if (defined _M_IX86) || (defined _M_X64)
+#include <intrin.h>
+#elif (defined __i386__) || (defined __x86_64__)
+#include <x86intrin.h>
+#elif (defined _WIN32)
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+// Set by dcadec_trace_start() and cleared by dcadec_trace_stop(), read here so
+// that the stage timers don't call into trace.c when nothing is recorded
+extern volatile int dca_trace_enabled;
+
+static inline uint64_t dca_stats_time(void)
+{
+#if (defined _M_IX86) || (defined _M_X64) || (defined __i386__) || (defined __x86_64__)
+    return __rdtsc();
+#elif (defined _WIN32)
+    LARGE_INTEGER counter;
+    QueryPerformanceCounter(&counter);
+    return counter.QuadPart;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+#endif
+}
+
+// Charge the time since *start to the stage, record it as a span if tracing
+// and restart the timer, so that consecutive stages can share one time stamp
+static inline void dca_stats_add(struct dcadec_stage_stats *stage, uint64_t *start,
+                                 const char *name)
+{
+    uint64_t now = dca_stats_time();
+    stage->ticks += now - *start;
+    stage->calls++;
+    if (dca_trace_enabled)
+        dcadec_trace_add(name, *start, now);
+    *start = now;
+}
+
+// Record a span that has no stage counter
+static inline void dca_stats_span(const char *name, uint64_t start)
+{
+    if (dca_trace_enabled)
+        dcadec_trace_add(name, start, dca_stats_time());
+}
+
+#define dca_stats_count(counter)        ((counter)++)
+#define dca_stats_sum(counter, value)   ((counter) += (value))
+
+#else
+
+static inline uint64_t dca_stats_time(void)
+{
+    return 0;
+}
+
+static inline void dca_stats_add(struct dcadec_stage_stats *stage, uint64_t *start,
+                                 const char *name)
+{
+    (void)stage;
+    (void)start;
+    (void)name;
+}
+
+static inline void dca_stats_span(const char *name, uint64_t start)
+{
+    (void)name;
+    (void)start;
+}
+
+#define dca_stats_count(counter)        ((void)0)
+#define dca_stats_sum(counter, value)   ((void)0)
+
+#endif
+
+#endif
@@ -28,6 +28,8 @@ struct ta_header {
     struct ta_header *prev;     // ring list containing siblings
     struct ta_header *next;
     struct ta_ext_header *ext;
+    struct ta_arena *arena;     // arena the allocation lives in, or NULL
+    struct ta_account *account; // account the allocation is charged to
 };
 
 union aligned_header {
@@ -50,8 +52,35 @@ struct ta_ext_header {
     struct ta_header *header;  // points back to normal header
     struct ta_header children; // list of children, with this as sentinel
     void (*destructor)(void *);
+    struct ta_arena *arena;    // arena owned by this allocation, or NULL
 };
 
+// Memory of all allocations below an arena owner is bump allocated from a
+// list of slabs. Freeing a single allocation only gives its memory back if
+// it was the last one made, everything is released with the owner. A block
+// too large for a slab of the minimum size gets a slab of its own, which is
+// freed again along with the block.
+struct ta_arena {
+    struct ta_slab *slabs;      // list of slabs, current one first
+    size_t slab_size;           // minimum size of a new slab
+    size_t align;               // alignment of user allocations
+    size_t capacity;            // total size of all slabs
+    size_t nallocs;             // number of slabs ever allocated
+    bool walk;                  // subtree has destructors or foreign memory
+    struct ta_account *account; // account charged for the slabs, or NULL
+};
+
+struct ta_slab {
+    struct ta_slab *next;
+    char *pos;                  // first free byte
+    char *end;                  // end of the slab
+    char *last;                 // start of the most recent allocation
+    bool own;                   // holds a single large block
+};
+
+#define ALIGN_UP(ptr, align) \
+    ((char *)(((size_t)(ptr) + (align) - 1) & ~((size_t)(align) - 1)))
+
 // ta_ext_header.children.size is set to this
 #define CHILDREN_SENTINEL ((size_t)-1)
 
@@ -60,13 +89,209 @@ static struct ta_header *get_header(void *ptr)
     return ptr ? PTR_TO_HEADER(ptr) : NULL;
 }
 
+enum { ACCOUNT_NONE, ACCOUNT_ALLOC, ACCOUNT_REALLOC, ACCOUNT_FREE, ACCOUNT_MOVE };
+
+static void account_update_one(struct ta_account *a, size_t old_size, size_t new_size, int event)
+{
+    a->live += new_size - old_size;
+    if (a->live > a->peak)
+        a->peak = a->live;
+    if (event == ACCOUNT_ALLOC)
+        a->nallocs++;
+    else if (event == ACCOUNT_REALLOC)
+        a->nreallocs++;
+    else if (event == ACCOUNT_FREE)
+        a->nfrees++;
+    else if (event == ACCOUNT_MOVE)
+        a->nallocs += new_size ? 1 : -1;
+}
+
+// Change the bytes charged to the account and its parents, and count event
+static void account_update(struct ta_account *a, size_t old_size, size_t new_size, int event)
+{
+    for (; a; a = a->parent)
+        account_update_one(a, old_size, new_size, event);
+}
+
+// Same as account_update() for the account of an allocation. Allocations
+// made from an arena are not charged one by one, the arena charges its slabs
+// to its own account instead.
+static void account_charge(struct ta_header *h, size_t old_size, size_t new_size, int event)
+{
+    if (!h->arena)
+        account_update(h->account, old_size, new_size, event);
+}
+
+static bool account_is_parent(struct ta_account *a, struct ta_account *child)
+{
+    for (; child; child = child->parent)
+        if (child == a)
+            return true;
+    return false;
+}
+
+// Bytes charged for the allocation itself
+static size_t charged_size(struct ta_header *h)
+{
+    return sizeof(union aligned_header) + h->size + (h->ext ? sizeof(struct ta_ext_header) : 0);
+}
+
+// Add a slab of bytes to the arena, or of the minimum slab size if that is
+// more. It becomes the current one, unless it is made for a single block,
+// then it is exactly as large and goes behind the current one so the free
+// space left there is still used.
+static struct ta_slab *arena_add_slab(struct ta_arena *a, size_t bytes, bool own)
+{
+    struct ta_slab *slab;
+    own = own && a->slabs;
+    if (bytes < a->slab_size && !own)
+        bytes = a->slab_size;
+    if (!(slab = malloc(bytes)))
+        return NULL;
+    slab->pos = (char *)(slab + 1);
+    slab->end = (char *)slab + bytes;
+    slab->last = NULL;
+    slab->own = own;
+    if (own) {
+        slab->next = a->slabs->next;
+        a->slabs->next = slab;
+    } else {
+        slab->next = a->slabs;
+        a->slabs = slab;
+    }
+    a->capacity += bytes;
+    a->nallocs++;
+    account_update(a->account, 0, bytes, ACCOUNT_ALLOC);
+    return slab;
+}
+
+static void arena_free_slab(struct ta_arena *a, struct ta_slab *slab)
+{
+    size_t bytes = (size_t)(slab->end - (char *)slab);
+    a->capacity -= bytes;
+    account_update(a->account, bytes, 0, ACCOUNT_FREE);
+    free(slab);
+}
+
+// Return a block of offset + size bytes from the arena, such that the block
+// plus offset is aligned to align
+static void *arena_alloc(struct ta_arena *a, size_t offset, size_t size, size_t align)
+{
+    struct ta_slab *slab = a->slabs;
+    char *ptr = slab ? ALIGN_UP(slab->pos + offset, align) : NULL;
+
+    if (size > ((size_t)-1) - sizeof(struct ta_slab) - offset - align)
+        return NULL;
+    if (!slab || ptr > slab->end || size > (size_t)(slab->end - ptr)) {
+        size_t bytes = sizeof(struct ta_slab) + offset + size + align;
+        // Only blocks of up to a quarter of a slab start a new current one,
+        // so at most that much is left unused at the end of each slab
+        if (!(slab = arena_add_slab(a, bytes, bytes > a->slab_size / 4)))
+            return NULL;
+        ptr = ALIGN_UP(slab->pos + offset, align);
+    }
+
+    slab->last = ptr - offset;
+    slab->pos = ptr + size;
+    return slab->last;
+}
+
+// Give the block back if it was the last one allocated from the current
+// slab or has a slab of its own, otherwise it stays in use until the arena is
+// reset or freed
+static void arena_release(struct ta_arena *a, void *ptr)
+{
+    struct ta_slab *slab = a->slabs;
+    if (!slab)
+        return;
+    if (slab->last == ptr) {
+        slab->pos = slab->last;
+        return;
+    }
+    for (struct ta_slab **prev = &slab->next; *prev; prev = &(*prev)->next) {
+        if ((*prev)->own && (*prev)->last == ptr) {
+            struct ta_slab *own = *prev;
+            *prev = own->next;
+            arena_free_slab(a, own);
+            return;
+        }
+    }
+}
+
+// Keep the first slab and drop everything allocated from the arena
+static void arena_reset(struct ta_arena *a)
+{
+    struct ta_slab *slab = a->slabs;
+    if (!slab)
+        return;
+    while (slab->next) {
+        struct ta_slab *next = slab->next->next;
+        arena_free_slab(a, slab->next);
+        slab->next = next;
+    }
+    slab->pos = (char *)(slab + 1);
+    slab->last = NULL;
+}
+
+static void arena_free(struct ta_arena *a)
+{
+    if (!a)
+        return;
+    while (a->slabs) {
+        struct ta_slab *next = a->slabs->next;
+        account_update(a->account, (size_t)(a->slabs->end - (char *)a->slabs), 0, ACCOUNT_FREE);
+        free(a->slabs);
+        a->slabs = next;
+    }
+    account_update(a->account, sizeof(struct ta_arena), 0, ACCOUNT_FREE);
+    free(a);
+}
+
+// Arena that children of h are allocated from
+static struct ta_arena *get_child_arena(struct ta_header *h)
+{
+    if (!h)
+        return NULL;
+    if (h->ext && h->ext->arena)
+        return h->ext->arena;
+    return h->arena;
+}
+
+static struct ta_header *alloc_header(struct ta_arena *a, size_t size, bool zero)
+{
+    struct ta_header *h;
+    if (a) {
+        h = arena_alloc(a, sizeof(union aligned_header), size, a->align);
+        if (h && zero)
+            memset(PTR_FROM_HEADER(h), 0, size);
+    } else if (zero) {
+        h = calloc(1, sizeof(union aligned_header) + size);
+    } else {
+        h = malloc(sizeof(union aligned_header) + size);
+    }
+    if (h)
+        *h = (struct ta_header) {.size = size, .arena = a};
+    return h;
+}
+
+static void free_header(struct ta_header *h)
+{
+    if (h->arena)
+        arena_release(h->arena, h);
+    else
+        free(h);
+}
+
 static struct ta_ext_header *get_or_alloc_ext_header(void *ptr)
 {
     struct ta_header *h = get_header(ptr);
     if (!h)
         return NULL;
     if (!h->ext) {
-        h->ext = malloc(sizeof(struct ta_ext_header));
+        if (h->arena)
+            h->ext = arena_alloc(h->arena, 0, sizeof(struct ta_ext_header), MIN_ALIGN);
+        else
+            h->ext = malloc(sizeof(struct ta_ext_header));
         if (!h->ext)
             return NULL;
         *h->ext = (struct ta_ext_header) {
@@ -79,6 +304,7 @@ static struct ta_ext_header *get_or_alloc_ext_header(void *ptr)
                 .ext = h->ext,
             },
         };
+        account_charge(h, 0, sizeof(struct ta_ext_header), ACCOUNT_NONE);
     }
     return h->ext;
 }
@@ -91,6 +317,9 @@ static struct ta_ext_header *get_or_alloc_ext_header(void *ptr)
  * Warning: if ta_parent is a direct or indirect child of ptr, things will go
  *          wrong. The function will apparently succeed, but creates circular
  *          parent links, which are not allowed.
+ *
+ * Warning: an allocation made from an arena can't be moved out of the tree of
+ *          the arena owner, its memory is released together with the owner.
  */
 bool ta_set_parent(void *ptr, void *ta_parent)
 {
@@ -100,6 +329,11 @@ bool ta_set_parent(void *ptr, void *ta_parent)
     struct ta_ext_header *parent_eh = get_or_alloc_ext_header(ta_parent);
     if (ta_parent && !parent_eh) // do nothing on OOM
         return false;
+    struct ta_arena *arena = get_child_arena(get_header(ta_parent));
+    assert(!ch->arena || ch->arena == arena);
+    // Memory not owned by the arena must be freed one by one
+    if (arena && ch->arena != arena)
+        arena->walk = true;
     // Unlink from previous parent
     if (ch->next) {
         ch->next->prev = ch->prev;
@@ -126,10 +360,12 @@ void *ta_alloc_size(void *ta_parent, size_t size)
 {
     if (size >= MAX_ALLOC)
         return NULL;
-    struct ta_header *h = malloc(sizeof(union aligned_header) + size);
+    struct ta_header *parent = get_header(ta_parent);
+    struct ta_header *h = alloc_header(get_child_arena(parent), size, false);
     if (!h)
         return NULL;
-    *h = (struct ta_header) {.size = size};
+    if (parent && (h->account = parent->account))
+        account_charge(h, 0, charged_size(h), ACCOUNT_ALLOC);
     void *ptr = PTR_FROM_HEADER(h);
     if (!ta_set_parent(ptr, ta_parent)) {
         ta_free(ptr);
@@ -145,10 +381,12 @@ void *ta_zalloc_size(void *ta_parent, size_t size)
 {
     if (size >= MAX_ALLOC)
         return NULL;
-    struct ta_header *h = calloc(1, sizeof(union aligned_header) + size);
+    struct ta_header *parent = get_header(ta_parent);
+    struct ta_header *h = alloc_header(get_child_arena(parent), size, true);
     if (!h)
         return NULL;
-    *h = (struct ta_header) {.size = size};
+    if (parent && (h->account = parent->account))
+        account_charge(h, 0, charged_size(h), ACCOUNT_ALLOC);
     void *ptr = PTR_FROM_HEADER(h);
     if (!ta_set_parent(ptr, ta_parent)) {
         ta_free(ptr);
@@ -183,9 +421,26 @@ void *ta_realloc_size(void *ta_parent, void *ptr, size_t size)
     struct ta_header *old_h = h;
     if (h->size == size)
         return ptr;
-    h = realloc(h, sizeof(union aligned_header) + size);
-    if (!h)
-        return NULL;
+    if (h->arena) {
+        // Resize in place if this is the most recent allocation, otherwise
+        // move it to a new block
+        struct ta_slab *slab = h->arena->slabs;
+        char *end = (char *)PTR_FROM_HEADER(h) + size;
+        if (slab->last == (char *)h && end <= slab->end) {
+            slab->pos = end;
+        } else {
+            h = arena_alloc(h->arena, sizeof(union aligned_header), size, h->arena->align);
+            if (!h)
+                return NULL;
+            memcpy(h, old_h, sizeof(union aligned_header) + (size < old_h->size ? size : old_h->size));
+            arena_release(h->arena, old_h);
+        }
+    } else {
+        h = realloc(h, sizeof(union aligned_header) + size);
+        if (!h)
+            return NULL;
+    }
+    account_charge(h, h->size, size, ACCOUNT_REALLOC);
     h->size = size;
     if (h != old_h) {
         if (h->next) {
@@ -213,8 +468,34 @@ size_t ta_get_size(void *ptr)
     return h ? h->size : 0;
 }
 
+/* Return the memory used by ptr and all of its direct and indirect children,
+ * including the allocator's own headers.
+ * If ptr==NULL, return 0.
+ */
+size_t ta_get_tree_size(void *ptr)
+{
+    struct ta_header *h = get_header(ptr);
+    if (!h)
+        return 0;
+    // Allocations made from an arena are accounted as part of its slabs
+    size_t size = h->arena ? 0 : sizeof(union aligned_header) + h->size;
+    if (h->ext) {
+        if (!h->arena)
+            size += sizeof(struct ta_ext_header);
+        if (h->ext->arena)
+            size += sizeof(struct ta_arena) + h->ext->arena->capacity;
+        for (struct ta_header *ch = h->ext->children.next; ch != &h->ext->children; ch = ch->next)
+            size += ta_get_tree_size(PTR_FROM_HEADER(ch));
+    }
+    return size;
+}
+
 /* Free all allocations that (recursively) have ptr as parent allocation, but
  * do not free ptr itself.
+ *
+ * If ptr owns an arena and nothing below it has a destructor or memory from
+ * elsewhere, the children are dropped at once without visiting them. They
+ * are not charged to any account, only the slabs released are credited.
  */
 void ta_free_children(void *ptr)
 {
@@ -222,6 +503,11 @@ void ta_free_children(void *ptr)
     struct ta_ext_header *eh = h ? h->ext : NULL;
     if (!eh)
         return;
+    if (eh->arena && !eh->arena->walk) {
+        eh->children.next = eh->children.prev = &eh->children;
+        arena_reset(eh->arena);
+        return;
+    }
     while (eh->children.next != &eh->children)
         ta_free(PTR_FROM_HEADER(eh->children.next));
 }
@@ -241,8 +527,15 @@ void ta_free(void *ptr)
         h->next->prev = h->prev;
         h->prev->next = h->next;
     }
-    free(h->ext);
-    free(h);
+    account_charge(h, charged_size(h), 0, ACCOUNT_FREE);
+    if (h->ext) {
+        arena_free(h->ext->arena);
+        if (h->arena)
+            arena_release(h->arena, h->ext);
+        else
+            free(h->ext);
+    }
+    free_header(h);
 }
 
 /* Set a destructor that is to be called when the given allocation is freed.
@@ -263,6 +556,42 @@ bool ta_set_destructor(void *ptr, void (*destructor)(void *))
     if (!eh)
         return false;
     eh->destructor = destructor;
+    if (eh->header->arena)
+        eh->header->arena->walk = true;
+    return true;
+}
+
+/* Make ptr the owner of an arena. All allocations made with ptr as direct or
+ * indirect parent afterwards are carved out of slabs of at least slab_size
+ * bytes, and the user memory is aligned to align, which must be a power of 2
+ * not smaller than MIN_ALIGN. Freeing ptr or its children releases the slabs
+ * all at once. Any existing children keep their memory.
+ *
+ * The arena and its slabs are charged to account if not NULL, which must
+ * remain valid until ptr is freed. The allocations made from the slabs are
+ * not charged to any account.
+ *
+ * Returns false if ptr==NULL, ptr already owns an arena, align is invalid,
+ * or on OOM.
+ */
+bool ta_set_arena(void *ptr, size_t slab_size, size_t align, struct ta_account *account)
+{
+    if (align < MIN_ALIGN || (align & (align - 1)))
+        return false;
+    struct ta_ext_header *eh = get_or_alloc_ext_header(ptr);
+    if (!eh || eh->arena)
+        return false;
+    struct ta_arena *a = malloc(sizeof(struct ta_arena));
+    if (!a)
+        return false;
+    *a = (struct ta_arena) {.slab_size = slab_size, .align = align, .account = account};
+    account_update(account, 0, sizeof(struct ta_arena), ACCOUNT_ALLOC);
+    // Existing children are not part of the arena
+    a->walk = eh->children.next != &eh->children;
+    eh->arena = a;
+    // A nested arena has slabs of its own
+    if (eh->header->arena)
+        eh->header->arena->walk = true;
     return true;
 }
 
@@ -296,3 +625,88 @@ char *ta_strdup(void *ta_parent, const char *str)
     }
     return NULL;
 }
+
+/* Make sure that at least size bytes can be allocated below the arena owner
+ * ptr without allocating a new slab. Alignment padding of the allocations is
+ * not accounted for.
+ *
+ * Returns false if ptr doesn't own an arena, or on OOM.
+ */
+bool ta_reserve_arena(void *ptr, size_t size)
+{
+    struct ta_header *h = get_header(ptr);
+    struct ta_arena *a = h && h->ext ? h->ext->arena : NULL;
+    if (!a)
+        return false;
+    struct ta_slab *slab = a->slabs;
+    if (slab && size <= (size_t)(slab->end - slab->pos))
+        return true;
+    if (size > ((size_t)-1) - sizeof(struct ta_slab))
+        return false;
+    // Leaves the new slab empty and current
+    return arena_add_slab(a, sizeof(struct ta_slab) + size, false) != NULL;
+}
+
+/* Return the number of bytes allocated from the slabs of the arena owned by
+ * ptr, including alignment padding but not the free space left in them.
+ * If ptr doesn't own an arena, return 0.
+ */
+size_t ta_get_arena_used(void *ptr)
+{
+    struct ta_header *h = get_header(ptr);
+    struct ta_arena *a = h && h->ext ? h->ext->arena : NULL;
+    size_t size = 0;
+    for (struct ta_slab *slab = a ? a->slabs : NULL; slab; slab = slab->next)
+        size += (size_t)(slab->pos - (char *)(slab + 1));
+    return size;
+}
+
+/* Return the number of slabs the arena owned by ptr has allocated from the
+ * heap since it was created.
+ * If ptr doesn't own an arena, return 0.
+ */
+size_t ta_get_arena_allocs(void *ptr)
+{
+    struct ta_header *h = get_header(ptr);
+    struct ta_arena *a = h && h->ext ? h->ext->arena : NULL;
+    return a ? a->nallocs : 0;
+}
+
+/* Return the number of bytes a child of ptr with the given size takes from its
+ * arena at most, including the header and alignment padding.
+ * If children of ptr are not allocated from an arena, return size.
+ */
+size_t ta_get_arena_block_size(void *ptr, size_t size)
+{
+    struct ta_arena *a = get_child_arena(get_header(ptr));
+    return a ? sizeof(union aligned_header) + size + a->align - 1 : size;
+}
+
+/* Charge ptr and all allocations made with it as direct or indirect parent
+ * afterwards to account, instead of the account of its parent. Existing
+ * children stay charged to their account, and so do allocations moved to
+ * another parent with ta_set_parent(). The account must remain valid until
+ * ptr is freed. Allocations made from an arena are not charged, the arena
+ * charges its slabs to the account given to ta_set_arena().
+ *
+ * Returns false if ptr==NULL.
+ */
+bool ta_set_account(void *ptr, struct ta_account *account)
+{
+    struct ta_header *h = get_header(ptr);
+    if (!h)
+        return false;
+    if (h->account == account)
+        return true;
+    // Only the accounts that are not shared by both see the move, which
+    // counts as if the allocation had been made with the new account
+    if (!h->arena) {
+        size_t size = charged_size(h);
+        for (struct ta_account *a = h->account; a && !account_is_parent(a, account); a = a->parent)
+            account_update_one(a, size, 0, ACCOUNT_MOVE);
+        for (struct ta_account *a = account; a && !account_is_parent(a, h->account); a = a->parent)
+            account_update_one(a, 0, size, ACCOUNT_MOVE);
+    }
+    h->account = account;
+    return true;
+}
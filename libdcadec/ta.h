@@ -18,13 +18,30 @@
 #include <stdbool.h>
 #include <stdarg.h>
 
+// Memory charged to a subtree, see ta_set_account()
+struct ta_account {
+    size_t live;                // bytes allocated, including ta headers
+    size_t peak;                // highest value of live
+    size_t nallocs;             // number of allocations
+    size_t nreallocs;           // number of allocations resized
+    size_t nfrees;              // number of allocations freed
+    struct ta_account *parent;  // account that is charged as well, or NULL
+};
+
 void *ta_alloc_size(void *ta_parent, size_t size);
 void *ta_zalloc_size(void *ta_parent, size_t size);
 void *ta_realloc_size(void *ta_parent, void *ptr, size_t size);
 size_t ta_get_size(void *ptr);
+size_t ta_get_tree_size(void *ptr);
 void ta_free(void *ptr);
 void ta_free_children(void *ptr);
 bool ta_set_destructor(void *ptr, void (*destructor)(void *));
+bool ta_set_arena(void *ptr, size_t slab_size, size_t align, struct ta_account *account);
+bool ta_reserve_arena(void *ptr, size_t size);
+size_t ta_get_arena_used(void *ptr);
+size_t ta_get_arena_allocs(void *ptr);
+size_t ta_get_arena_block_size(void *ptr, size_t size);
+bool ta_set_account(void *ptr, struct ta_account *account);
 bool ta_set_parent(void *ptr, void *ta_parent);
 void *ta_find_parent(void *ptr);
 char *ta_strdup(void *ta_parent, const char *str);
@@ -0,0 +1,369 @@
+/*
+ * This file is part of libdcadec.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation; either version 2.1 of the License, or (at your
+ * option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+// Host tool that generates the constant tables which used to be computed at
+// decoder initialization. It is not part of the library and runs against
+// the host C library, so the decoder does no trigonometry when a stream is
+// opened.
+//
+// The Visual Studio project runs it as a custom build step and bench/Makefile
+// checks the committed headers against its output with 'make check-tables'.
+//
+// Usage: tablegen [output directory]
+
+#include "common.h"
+#include "idct.h"
+
+static const char license[] =
+    "/*\n"
+    " * This file is part of libdcadec.\n"
+    " *\n"
+    " * This library is free software; you can redistribute it and/or modify it\n"
+    " * under the terms of the GNU Lesser General Public License as published by the\n"
+    " * Free Software Foundation; either version 2.1 of the License, or (at your\n"
+    " * option) any later version.\n"
+    " *\n"
+    " * This library is distributed in the hope that it will be useful, but WITHOUT\n"
+    " * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or\n"
+    " * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License\n"
+    " * for more details.\n"
+    " *\n"
+    " * You should have received a copy of the GNU Lesser General Public License\n"
+    " * along with this library; if not, write to the Free Software Foundation,\n"
+    " * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA\n"
+    " */\n"
+    "\n"
+    "// Generated by tablegen.c, do not edit\n";
+
+#define PER_LINE    4
+
+static FILE *open_header(const char *dir, const char *name, const char *guard)
+{
+    char path[1024];
+    snprintf(path, sizeof(path), "%s/%s", dir, name);
+
+    // Binary mode keeps LF line endings identical on every host
+    FILE *fp = fopen(path, "wb");
+    if (!fp) {
+        perror(path);
+        return NULL;
+    }
+
+    fprintf(fp, "%s\n#ifndef %s\n#define %s\n\n", license, guard, guard);
+    return fp;
+}
+
+static int close_header(FILE *fp)
+{
+    fprintf(fp, "#endif\n");
+    return fclose(fp) ? -1 : 0;
+}
+
+static void write_double(FILE *fp, const char *indent, const double *data, int count)
+{
+    for (int i = 0; i < count; i++) {
+        if (i % PER_LINE == 0)
+            fprintf(fp, "%s", indent);
+        fprintf(fp, "% .17e,", data[i]);
+        fprintf(fp, i % PER_LINE == PER_LINE - 1 || i == count - 1 ? "\n" : " ");
+    }
+}
+
+static void write_float(FILE *fp, const char *indent, const double *data, int count)
+{
+    for (int i = 0; i < count; i++) {
+        if (i % PER_LINE == 0)
+            fprintf(fp, "%s", indent);
+        fprintf(fp, "% .9ef,", (double)(float)data[i]);
+        fprintf(fp, i % PER_LINE == PER_LINE - 1 || i == count - 1 ? "\n" : " ");
+    }
+}
+
+// Rows of 2D tables hold only the used prefix, the rest is zero filled
+static void write_rows(FILE *fp, const char *decl, bool single, double (*rows)[IDCT_SIZE / 2], const int *count, int nrows)
+{
+    fprintf(fp, "%s = {\n", decl);
+    for (int i = 0; i < nrows; i++) {
+        fprintf(fp, "    {\n");
+        if (single)
+            write_float(fp, "        ", rows[i], count[i]);
+        else
+            write_double(fp, "        ", rows[i], count[i]);
+        fprintf(fp, "    },\n");
+    }
+    fprintf(fp, "};\n\n");
+}
+
+static int write_idct_tables(const char *dir)
+{
+    FILE *fp = open_header(dir, "idct_tables.h", "IDCT_TABLES_H");
+    if (!fp)
+        return -1;
+
+    double cs[IDCT_SIZE / 2];
+    double ac[IDCT_BITS - 1][IDCT_SIZE / 2];
+    double as[IDCT_BITS - 1][IDCT_SIZE / 2];
+    double permute[IDCT_BITS - 1][IDCT_SIZE / 2];
+    int count[IDCT_BITS - 1];
+    int i, j, k, n, base;
+
+    for (i = base = 0; i < IDCT_BITS - 1; base += 1 << i, i++)
+        for (j = 0; j < 1 << i; j++)
+            cs[base + j] = cos(M_PI * (4 * j + 1) / (4 << i));
+
+    for (n = 2; n <= IDCT_BITS; n++) {
+        count[n - 2] = 1 << (n - 1);
+        for (i = 0; i < count[n - 2]; i++) {
+            double a = M_PI * (2 * i + 1) / (4 << n);
+            ac[n - 2][i] = cos(a);
+            as[n - 2][i] = sin(a);
+            for (j = k = 0; j < n - 1; j++)
+                k = (k << 1) | ((i >> j) & 1);
+            permute[n - 2][i] = k;
+        }
+    }
+
+    fprintf(fp, "// Butterfly twiddles of all stages, stage i occupies 2^i entries starting\n"
+                "// at 2^i - 1. Stages do not depend on the transform size.\n"
+                "//\n"
+                "// cos((4 * j + 1) * PI / (4 << i)), j = 0 .. 2^i\n"
+                "static const double idct_cs[IDCT_SIZE / 2] = {\n");
+    write_double(fp, "    ", cs, base);
+    fprintf(fp, "};\n\n");
+
+    fprintf(fp, "// Single precision version of idct_cs[]\n"
+                "static const float idct_cs32[IDCT_SIZE / 2] = {\n");
+    write_float(fp, "    ", cs, base);
+    fprintf(fp, "};\n\n");
+
+    fprintf(fp, "// Output rotations for n = 2^nbits, row nbits - 2\n"
+                "//\n"
+                "// cos((2 * i + 1) * PI / (4 * n)), i = 0 .. n / 2\n");
+    write_rows(fp, "static const double idct_ac[IDCT_BITS - 1][IDCT_SIZE / 2]", false, ac, count, IDCT_BITS - 1);
+    fprintf(fp, "// sin((2 * i + 1) * PI / (4 * n)), i = 0 .. n / 2\n");
+    write_rows(fp, "static const double idct_as[IDCT_BITS - 1][IDCT_SIZE / 2]", false, as, count, IDCT_BITS - 1);
+
+    fprintf(fp, "// Single precision versions of idct_ac[] and idct_as[]\n");
+    write_rows(fp, "static const float idct_ac32[IDCT_BITS - 1][IDCT_SIZE / 2]", true, ac, count, IDCT_BITS - 1);
+    write_rows(fp, "static const float idct_as32[IDCT_BITS - 1][IDCT_SIZE / 2]", true, as, count, IDCT_BITS - 1);
+
+    fprintf(fp, "// Bit reversal permutation of nbits - 1 bit indices, row nbits - 2\n"
+                "static const uint8_t idct_permute[IDCT_BITS - 1][IDCT_SIZE / 2] = {\n");
+    for (n = 0; n < IDCT_BITS - 1; n++) {
+        fprintf(fp, "    {\n");
+        for (i = 0; i < count[n]; i++)
+            fprintf(fp, "%s%2d,%s", i % 16 ? " " : "        ", (int)permute[n][i],
+                    i % 16 == 15 || i == count[n] - 1 ? "\n" : "");
+        fprintf(fp, "    },\n");
+    }
+    fprintf(fp, "};\n\n");
+
+    return close_header(fp);
+}
+
+static int write_lbr_tables(const char *dir)
+{
+    FILE *fp = open_header(dir, "lbr_trig_tables.h", "LBR_TRIG_TABLES_H");
+    if (!fp)
+        return -1;
+
+    double sin_tab[256];
+    double lpc_tab[16];
+    int i;
+
+    for (i = 0; i < 256; i++)
+        sin_tab[i] = cos(M_PI * i / 128);
+
+    for (i = 0; i < 16; i++)
+        lpc_tab[i] = sin((i - 8) * (M_PI / ((i < 8) ? 17 : 15)));
+
+    fprintf(fp, "// Tonal synthesis oscillator indexed by 8-bit phase\n"
+                "//\n"
+                "// cos(i * PI / 128), i = 0 .. 256\n"
+                "static const float sin_tab[256] = {\n");
+    write_float(fp, "    ", sin_tab, 256);
+    fprintf(fp, "};\n\n");
+
+    fprintf(fp, "// Reflection coefficient dequantization\n"
+                "//\n"
+                "// sin((i - 8) * PI / 17), i = 0 .. 8\n"
+                "// sin((i - 8) * PI / 15), i = 8 .. 16\n"
+                "static const float lpc_tab[16] = {\n");
+    write_float(fp, "    ", lpc_tab, 16);
+    fprintf(fp, "};\n\n");
+
+    return close_header(fp);
+}
+
+// Core LFE interpolation IIR, a cascade of three biquad sections
+static const double lfe_iir_scale = 0.001985816114019982;
+
+static const double lfe_iir[3][4] = {
+    { -0.9698530866436986, 1.9696040724997900, 0.9999999999999996, -1.9643358221499630 },
+    { -0.9787938538720836, 1.9785545764679620, 1.0000000000000020, -1.9951847249255470 },
+    { -0.9925096137076496, 1.9922787089263100, 1.0000000000000000, -1.9974180593495760 }
+};
+
+// LBR LFE interpolation IIR, a cascade of five biquad sections in single
+// precision, and its input scale
+static const double lbr_lfe_iir_scale = 64 * 0x7fffff * 0.0000078265894;
+
+static const float lbr_lfe_iir[5][4] = {
+    { -0.98618466, 1.9861259, 1.0, -1.9840510 },
+    { -0.98883152, 1.9887193, 1.0, -1.9979848 },
+    { -0.99252087, 1.9923381, 1.0, -1.9990897 },
+    { -0.99591690, 1.9956781, 1.0, -1.9993745 },
+    { -0.99872285, 1.9984550, 1.0, -1.9994639 }
+};
+
+// Runs a cascade of 'nsections' biquads over one block of zero input
+// following a single decimated sample, starting from unit history entry or
+// unit input 'unit'
+static void run_iir(const double (*coeff)[4], int nsections, double scale,
+                    int unit, int factor, double *output, double *state)
+{
+    double history[10] = { 0 };
+    double res1 = 0.0, res2;
+
+    if (unit < nsections * 2)
+        history[unit] = 1.0;
+    else
+        res1 = scale;
+
+    for (int j = 0; j < factor; j++) {
+        for (int k = 0; k < nsections; k++) {
+            double tmp1 = history[k * 2 + 0];
+            double tmp2 = history[k * 2 + 1];
+
+            res2 = tmp1 * coeff[k][0] + tmp2 * coeff[k][1] + res1;
+            res1 = tmp1 * coeff[k][2] + tmp2 * coeff[k][3] + res2;
+
+            history[k * 2 + 0] = tmp2;
+            history[k * 2 + 1] = res2;
+        }
+
+        output[j] = res1;
+        res1 = 0.0;
+    }
+
+    for (int k = 0; k < nsections * 2; k++)
+        state[k] = history[k];
+}
+
+static int write_iir_tables(const char *dir)
+{
+    FILE *fp = open_header(dir, "iir_float.h", "IIR_FLOAT_H");
+    if (!fp)
+        return -1;
+
+    fprintf(fp, "// LFE interpolation IIR in state-space form. Between two decimated samples\n"
+                "// the input is zero, so one block of 64 or 128 interpolated samples and the\n"
+                "// filter history after it are linear functions of the history before it\n"
+                "// (rows 0-5) and of the decimated input sample (row 6).\n"
+                "//\n"
+                "// Response of the cascade of three biquad sections in tablegen.c to a unit\n"
+                "// value in each row, with the input scale folded into row 6.\n"
+                "\n");
+    for (int factor = 64; factor <= 128; factor *= 2) {
+        double output[7][128];
+        double state[7][6];
+
+        for (int i = 0; i < 7; i++)
+            run_iir(lfe_iir, 3, lfe_iir_scale, i, factor, output[i], state[i]);
+
+        fprintf(fp, "static const double lfe_iir_%d_output[7][%d] = {\n", factor, factor);
+        for (int i = 0; i < 7; i++) {
+            fprintf(fp, "    {\n");
+            write_double(fp, "        ", output[i], factor);
+            fprintf(fp, "    },\n");
+        }
+        fprintf(fp, "};\n\n");
+
+        fprintf(fp, "static const double lfe_iir_%d_state[7][6] = {\n", factor);
+        for (int i = 0; i < 7; i++) {
+            fprintf(fp, "    {\n");
+            write_double(fp, "        ", state[i], 6);
+            fprintf(fp, "    },\n");
+        }
+        fprintf(fp, "};\n\n");
+    }
+
+    return close_header(fp);
+}
+
+static int write_lbr_iir_tables(const char *dir)
+{
+    FILE *fp = open_header(dir, "lbr_iir_tables.h", "LBR_IIR_TABLES_H");
+    if (!fp)
+        return -1;
+
+    double coeff[5][4];
+    double output[11][64];
+    double state[11][10];
+
+    for (int i = 0; i < 5; i++)
+        for (int j = 0; j < 4; j++)
+            coeff[i][j] = lbr_lfe_iir[i][j];
+
+    for (int i = 0; i < 11; i++)
+        run_iir(coeff, 5, lbr_lfe_iir_scale, i, 64, output[i], state[i]);
+
+    fprintf(fp, "// LBR LFE interpolation IIR in state-space form, like the core one in\n"
+                "// iir_float.h: one block of 64 interpolated samples and the filter history\n"
+                "// after it are linear functions of the history before it (rows 0-9) and of\n"
+                "// the decimated input sample (row 10).\n"
+                "//\n"
+                "// Response of the single precision cascade of five biquad sections in\n"
+                "// tablegen.c to a unit value in each row, evaluated in double precision, with\n"
+                "// the input scale folded into row 10.\n"
+                "\n");
+
+    fprintf(fp, "static const double lbr_lfe_iir_output[11][64] = {\n");
+    for (int i = 0; i < 11; i++) {
+        fprintf(fp, "    {\n");
+        write_double(fp, "        ", output[i], 64);
+        fprintf(fp, "    },\n");
+    }
+    fprintf(fp, "};\n\n");
+
+    fprintf(fp, "static const double lbr_lfe_iir_state[11][10] = {\n");
+    for (int i = 0; i < 11; i++) {
+        fprintf(fp, "    {\n");
+        write_double(fp, "        ", state[i], 10);
+        fprintf(fp, "    },\n");
+    }
+    fprintf(fp, "};\n\n");
+
+    return close_header(fp);
+}
+
+int main(int argc, char **argv)
+{
+    const char *dir = argc > 1 ? argv[1] : ".";
+
+    if (write_idct_tables(dir) < 0)
+        return 1;
+    if (write_lbr_tables(dir) < 0)
+        return 1;
+    if (write_iir_tables(dir) < 0)
+        return 1;
+    if (write_lbr_iir_tables(dir) < 0)
+        return 1;
+
+    return 0;
+}
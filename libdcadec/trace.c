@@ -0,0 +1,137 @@
+/*
+ * This file is part of libdcadec.
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation; either version 2.1 of the License, or (at your
+ * option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "common.h"
+
+#if (defined _WIN32)
+#include <windows.h>
+#define atomic_inc(p)       ((uint32_t)InterlockedIncrement((volatile LONG *)(p)))
+#define memory_barrier()    MemoryBarrier()
+#define thread_id()         ((uint32_t)GetCurrentThreadId())
+#else
+#include <pthread.h>
+#define atomic_inc(p)       __atomic_add_fetch((p), 1, __ATOMIC_SEQ_CST)
+#define memory_barrier()    __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#if (defined __linux__)
+#include <unistd.h>
+#include <sys/syscall.h>
+#define thread_id()         ((uint32_t)syscall(SYS_gettid))
+#else
+#define thread_id()         ((uint32_t)(uintptr_t)pthread_self())
+#endif
+#endif
+
+// Slot sequence is the ring position plus one once the event is complete and
+// zero while it is being written
+struct trace_slot {
+    volatile uint32_t           seq;
+    struct dcadec_trace_event   event;
+};
+
+static struct trace_slot    *trace_slots;
+static uint32_t             trace_mask;
+static volatile uint32_t    trace_head;
+volatile int                dca_trace_enabled;
+
+DCADEC_API int dcadec_trace_start(size_t size)
+{
+    if (!trace_slots) {
+        if (!size || size > 0x10000000)
+            return -DCADEC_EINVAL;
+
+        size_t nslots = 1;
+        while (nslots < size)
+            nslots <<= 1;
+
+        if (!(trace_slots = calloc(nslots, sizeof(*trace_slots))))
+            return -DCADEC_ENOMEM;
+        trace_mask = (uint32_t)nslots - 1;
+    }
+
+    dca_trace_enabled = 0;
+    memory_barrier();
+    for (uint32_t i = 0; i <= trace_mask; i++)
+        trace_slots[i].seq = 0;
+    trace_head = 0;
+    memory_barrier();
+    dca_trace_enabled = 1;
+    return 0;
+}
+
+DCADEC_API void dcadec_trace_stop(void)
+{
+    dca_trace_enabled = 0;
+    memory_barrier();
+}
+
+DCADEC_API void dcadec_trace_add(const char *name, uint64_t start, uint64_t end)
+{
+    if (!dca_trace_enabled)
+        return;
+
+    // Claim a slot, writers never wait for each other
+    uint32_t pos = atomic_inc(&trace_head) - 1;
+    struct trace_slot *slot = &trace_slots[pos & trace_mask];
+
+    slot->seq = 0;
+    memory_barrier();
+    slot->event.name = name;
+    slot->event.thread = thread_id();
+    slot->event.start = start;
+    slot->event.end = end;
+    memory_barrier();
+    slot->seq = pos + 1;
+}
+
+DCADEC_API size_t dcadec_trace_read(struct dcadec_trace_event *events, size_t size)
+{
+    if (!trace_slots || !events)
+        return 0;
+
+    memory_barrier();
+    uint32_t head = trace_head;
+    uint32_t count = head;
+    if (count > trace_mask + 1)
+        count = trace_mask + 1;
+    if (count > size)
+        count = (uint32_t)size;
+
+    size_t n = 0;
+    for (uint32_t pos = head - count; pos != head; pos++) {
+        struct trace_slot *slot = &trace_slots[pos & trace_mask];
+
+        // Copy the event and keep it only if no writer touched the slot
+        uint32_t seq = slot->seq;
+        memory_barrier();
+        events[n] = slot->event;
+        memory_barrier();
+        if (seq == pos + 1 && slot->seq == seq)
+            n++;
+    }
+
+    return n;
+}
+
+DCADEC_API void dcadec_trace_free(void)
+{
+    dca_trace_enabled = 0;
+    free(trace_slots);
+    trace_slots = NULL;
+    trace_mask = 0;
+    trace_head = 0;
+}
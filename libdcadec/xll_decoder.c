@@ -19,6 +19,7 @@
 #include "common.h"
 #include "bitstream.h"
 #include "fixed_math.h"
+#include "fixed_math_sse2.h"
 #include "xll_decoder.h"
 #include "exss_parser.h"
 #include "dmix_tables.h"
@@ -27,6 +28,14 @@
 
 #define XLL_PBR_SIZE    (240 << 10)
 
+// Buffered data is consumed from the front and only moved back to the start
+// of the buffer when the next packet doesn't fit after it. Twice the maximum
+// amount of buffered data makes that happen at most once every XLL_PBR_SIZE
+// bytes decoded.
+#define XLL_PBR_BUFFER_SIZE (XLL_PBR_SIZE * 2)
+
+#define XLL_ASSEMBLE_BLOCK  256
+
 static int parse_dmix_coeffs(struct xll_chset *chs)
 {
     struct xll_decoder *xll = chs->decoder;
@@ -746,22 +755,90 @@ void xll_assemble_msbs_lsbs(struct xll_chset *chs, int band_i)
     }
 }
 
-static void filter0(int *dst, const int *src, int nsamples)
+// Input section of the lattice filter. All four updates operate on the same
+// sample index of both bands, so they are done in a single pass.
+static void filter0(int *band0, int *band1, int nsamples)
 {
-    for (int n = 0; n < nsamples; n++)
-        dst[n] -= src[n];
+    int n = 0;
+
+#if HAVE_SSE2
+    const struct coeff_sse2 c0 = coeff_sse2_init(band_coeff_table0[0], 22);
+    const struct coeff_sse2 c1 = coeff_sse2_init(band_coeff_table0[1], 22);
+    const struct coeff_sse2 c2 = coeff_sse2_init(band_coeff_table0[2], 22);
+
+    for (; n + 4 <= nsamples; n += 4) {
+        __m128i b0 = _mm_loadu_si128((const __m128i *)&band0[n]);
+        __m128i b1 = _mm_loadu_si128((const __m128i *)&band1[n]);
+        b0 = _mm_sub_epi32(b0, mul__coeff_sse2(b1, &c0, 22));
+        b1 = _mm_sub_epi32(b1, mul__coeff_sse2(b0, &c1, 22));
+        b0 = _mm_sub_epi32(b0, mul__coeff_sse2(b1, &c2, 22));
+        b1 = _mm_sub_epi32(b1, b0);
+        _mm_storeu_si128((__m128i *)&band0[n], b0);
+        _mm_storeu_si128((__m128i *)&band1[n], b1);
+    }
+#endif
+
+    for (; n < nsamples; n++) {
+        int b0 = band0[n];
+        int b1 = band1[n];
+        b0 -= mul22(b1, band_coeff_table0[0]);
+        b1 -= mul22(b0, band_coeff_table0[1]);
+        b0 -= mul22(b1, band_coeff_table0[2]);
+        b1 -= b0;
+        band0[n] = b0;
+        band1[n] = b1;
+    }
 }
 
-static void filter1(int *dst, const int *src, int nsamples, int32_t coeff)
+// One decimator history section of the lattice filter. Caller offsets band0
+// by the section index, the three updates are again done in a single pass.
+static void filter1(int *band0, int *band1, int nsamples, int32_t coeff1, int32_t coeff2)
 {
-    for (int n = 0; n < nsamples; n++)
-        dst[n] -= mul22(src[n], coeff);
+    int n = 0;
+
+#if HAVE_SSE2
+    const struct coeff_sse2 c1 = coeff_sse2_init(coeff1, 23);
+    const struct coeff_sse2 c2 = coeff_sse2_init(coeff2, 23);
+
+    for (; n + 4 <= nsamples; n += 4) {
+        __m128i b0 = _mm_loadu_si128((const __m128i *)&band0[n]);
+        __m128i b1 = _mm_loadu_si128((const __m128i *)&band1[n]);
+        b0 = _mm_sub_epi32(b0, mul__coeff_sse2(b1, &c1, 23));
+        b1 = _mm_sub_epi32(b1, mul__coeff_sse2(b0, &c2, 23));
+        b0 = _mm_sub_epi32(b0, mul__coeff_sse2(b1, &c1, 23));
+        _mm_storeu_si128((__m128i *)&band0[n], b0);
+        _mm_storeu_si128((__m128i *)&band1[n], b1);
+    }
+#endif
+
+    for (; n < nsamples; n++) {
+        int b0 = band0[n];
+        int b1 = band1[n];
+        b0 -= mul23(b1, coeff1);
+        b1 -= mul23(b0, coeff2);
+        b0 -= mul23(b1, coeff1);
+        band0[n] = b0;
+        band1[n] = b1;
+    }
 }
 
-static void filter2(int *dst, const int *src, int nsamples, int32_t coeff)
+static void interleave(int *dst, const int *band0, const int *band1, int nsamples)
 {
-    for (int n = 0; n < nsamples; n++)
-        dst[n] -= mul23(src[n], coeff);
+    int n = 0;
+
+#if HAVE_SSE2
+    for (; n + 4 <= nsamples; n += 4) {
+        __m128i b0 = _mm_loadu_si128((const __m128i *)&band0[n]);
+        __m128i b1 = _mm_loadu_si128((const __m128i *)&band1[n]);
+        _mm_storeu_si128((__m128i *)&dst[n * 2 + 0], _mm_unpacklo_epi32(b1, b0));
+        _mm_storeu_si128((__m128i *)&dst[n * 2 + 4], _mm_unpackhi_epi32(b1, b0));
+    }
+#endif
+
+    for (; n < nsamples; n++) {
+        dst[n * 2 + 0] = band1[n];
+        dst[n * 2 + 1] = band0[n];
+    }
 }
 
 static int chs_assemble_freq_bands(struct xll_chset *chs)
@@ -789,24 +866,24 @@ static int chs_assemble_freq_bands(struct xll_chset *chs)
         for (int i = 1; i < XLL_DECI_HISTORY; i++)
             band0[i - XLL_DECI_HISTORY] = chs->deci_history[ch][i];
 
-        // Filter
-        filter1(band0, band1, nsamples, band_coeff_table0[0]);
-        filter1(band1, band0, nsamples, band_coeff_table0[1]);
-        filter1(band0, band1, nsamples, band_coeff_table0[2]);
-        filter0(band1, band0, nsamples);
-
-        for (int i = 0; i < XLL_DECI_HISTORY; i++) {
-            filter2(band0, band1, nsamples, band_coeff_table1[i]);
-            filter2(band1, band0, nsamples, band_coeff_table2[i]);
-            filter2(band0, band1, nsamples, band_coeff_table1[i]);
-            band0--;
+        // Filter. Each lattice section only depends on the previous one at
+        // the same or earlier sample index, so all sections are run over one
+        // cache resident block before moving on to the next one.
+        for (int n = 0; n < nsamples; n += XLL_ASSEMBLE_BLOCK) {
+            int len = nsamples - n;
+            if (len > XLL_ASSEMBLE_BLOCK)
+                len = XLL_ASSEMBLE_BLOCK;
+
+            filter0(band0 + n, band1 + n, len);
+
+            for (int i = 0; i < XLL_DECI_HISTORY; i++)
+                filter1(band0 + n - i, band1 + n, len,
+                        band_coeff_table1[i], band_coeff_table2[i]);
         }
 
         // Assemble
-        for (int i = 0; i < nsamples; i++) {
-            *ptr++ = *band1++;
-            *ptr++ = *++band0;
-        }
+        interleave(ptr, band0 - XLL_DECI_HISTORY + 1, band1, nsamples);
+        ptr += 2 * nsamples;
     }
 
     return 0;
@@ -957,9 +1034,11 @@ static int parse_sub_headers(struct xll_decoder *xll, struct exss_asset *asset)
     struct xll_chset *chs;
     int i, ret;
 
-    // Reallocate channel sets
-    if (ta_zalloc_fast(xll, &xll->chset, xll->nchsets, sizeof(struct xll_chset)) < 0)
+    // Reallocate channel sets, their band buffers are allocated below them
+    if ((ret = ta_zalloc_fast(xll, &xll->chset, xll->nchsets, sizeof(struct xll_chset))) < 0)
         return -DCADEC_ENOMEM;
+    if (ret > 0)
+        ta_set_account(xll->chset, dca_get_account(xll->ctx, DCADEC_MEM_XLL_CHSET));
 
     // Parse channel set headers
     xll->nfreqbands = 0;
@@ -1096,6 +1175,7 @@ static int parse_frame(struct xll_decoder *xll, uint8_t *data, int size, struct
 
 static void clear_pbr(struct xll_decoder *xll)
 {
+    xll->pbr_start = 0;
     xll->pbr_length = 0;
     xll->pbr_delay = 0;
 }
@@ -1106,10 +1186,15 @@ static int copy_to_pbr(struct xll_decoder *xll, uint8_t *data, int size, int del
         xll_err("PBR smoothing buffer overflow");
         return -DCADEC_EINVAL;
     }
-    if (!xll->pbr_buffer && !(xll->pbr_buffer = ta_zalloc_size(xll, XLL_PBR_SIZE + DCADEC_BUFFER_PADDING)))
-        return -DCADEC_ENOMEM;
+    if (!xll->pbr_buffer) {
+        if (!(xll->pbr_buffer = ta_zalloc_size(xll, XLL_PBR_BUFFER_SIZE + DCADEC_BUFFER_PADDING)))
+            return -DCADEC_ENOMEM;
+        ta_set_account(xll->pbr_buffer, dca_get_account(xll->ctx, DCADEC_MEM_PBR));
+    }
     memcpy(xll->pbr_buffer, data, size);
+    xll->pbr_start = 0;
     xll->pbr_length = size;
+    xll->pbr_copied += size;
     xll->pbr_delay = delay;
     return 0;
 }
@@ -1147,13 +1232,6 @@ static int parse_frame_no_pbr(struct xll_decoder *xll, uint8_t *data, int size,
             return -DCADEC_ENOSYNC;
         }
 
-        // Can't parse in place when data is not aligned properly. We could
-        // copy to PBR buffer first, but don't bother for now.
-        if (asset->xll_sync_offset & 3) {
-            xll_warn("Unsupported XLL sync word alignment");
-            return -DCADEC_ENOSYNC;
-        }
-
         // No decoding delay, just parse the frame in place
         ret = parse_frame(xll, data, size, asset);
     }
@@ -1182,8 +1260,15 @@ static int parse_frame_pbr(struct xll_decoder *xll, uint8_t *data, int size, str
         goto fail;
     }
 
-    memcpy(xll->pbr_buffer + xll->pbr_length, data, size);
+    if (xll->pbr_start + xll->pbr_length + size > XLL_PBR_BUFFER_SIZE) {
+        memmove(xll->pbr_buffer, xll->pbr_buffer + xll->pbr_start, xll->pbr_length);
+        xll->pbr_copied += xll->pbr_length;
+        xll->pbr_start = 0;
+    }
+
+    memcpy(xll->pbr_buffer + xll->pbr_start + xll->pbr_length, data, size);
     xll->pbr_length += size;
+    xll->pbr_copied += size;
 
     // Respect decoding delay after synchronization error
     if (xll->pbr_delay > 0 && --xll->pbr_delay) {
@@ -1191,7 +1276,7 @@ static int parse_frame_pbr(struct xll_decoder *xll, uint8_t *data, int size, str
         return -DCADEC_ENOSYNC;
     }
 
-    if ((ret = parse_frame(xll, xll->pbr_buffer, xll->pbr_length, asset)) < 0)
+    if ((ret = parse_frame(xll, xll->pbr_buffer + xll->pbr_start, xll->pbr_length, asset)) < 0)
         goto fail;
 
     if (xll->frame_size > xll->pbr_length) {
@@ -1203,8 +1288,8 @@ static int parse_frame_pbr(struct xll_decoder *xll, uint8_t *data, int size, str
         // End of PBR smoothing period
         clear_pbr(xll);
     } else {
+        xll->pbr_start += xll->frame_size;
         xll->pbr_length -= xll->frame_size;
-        memmove(xll->pbr_buffer, xll->pbr_buffer + xll->frame_size, xll->pbr_length);
     }
 
     return 0;
@@ -1235,6 +1320,8 @@ int xll_parse(struct xll_decoder *xll, uint8_t *data, struct exss_asset *asset)
         xll->hd_stream_id = asset->hd_stream_id;
     }
 
+    xll->pbr_copied = 0;
+
     if (xll->pbr_length)
         ret = parse_frame_pbr(xll, data + asset->xll_offset, asset->xll_size, asset);
     else
@@ -1253,3 +1340,82 @@ void xll_clear(struct xll_decoder *xll)
         clear_chs(xll);
     }
 }
+
+void xll_trim(struct xll_decoder *xll)
+{
+    if (!xll)
+        return;
+
+    // Sample buffers only live for one frame, including channel sets beyond
+    // the current count that were used by earlier frames
+    int nchsets = ta_get_size(xll->chset) / sizeof(struct xll_chset);
+    for (int i = 0; i < nchsets; i++) {
+        struct xll_chset *chs = &xll->chset[i];
+        ta_free(chs->sample_buffer1);
+        ta_free(chs->sample_buffer2);
+        ta_free(chs->sample_buffer3);
+        chs->sample_buffer1 = chs->sample_buffer2 = chs->sample_buffer3 = NULL;
+        for (int band = 0; band < XLL_MAX_BANDS; band++) {
+            memset(chs->bands[band].msb_sample_buffer, 0, sizeof(chs->bands[band].msb_sample_buffer));
+            memset(chs->bands[band].lsb_sample_buffer, 0, sizeof(chs->bands[band].lsb_sample_buffer));
+        }
+        memset(chs->out_sample_buffer, 0, sizeof(chs->out_sample_buffer));
+    }
+
+    // PBR buffer is kept while it holds data for the next frames
+    if (!xll->pbr_length) {
+        ta_free(xll->pbr_buffer);
+        xll->pbr_buffer = NULL;
+    }
+}
+
+// Bytes to reserve for the sample buffers of a channel set, as allocated by
+// chs_alloc_msb_band_data(), chs_alloc_lsb_band_data() with every band having
+// an LSB part and chs_assemble_freq_bands()
+static size_t chs_get_reserve_size(struct xll_decoder *xll, struct xll_chset *chs,
+                                   int nchannels, int nfreqbands)
+{
+    size_t nsamples = xll->nframesamples;
+    size_t size = 0;
+
+    size += dca_reserve_size(xll->chset, chs ? chs->sample_buffer1 : NULL,
+                             (nsamples + XLL_DECI_HISTORY) * nchannels * nfreqbands * sizeof(int));
+    size += dca_reserve_size(xll->chset, chs ? chs->sample_buffer2 : NULL,
+                             nsamples * nchannels * nfreqbands * sizeof(int));
+    if (nfreqbands > 1)
+        size += dca_reserve_size(xll->chset, chs ? chs->sample_buffer3 : NULL,
+                                 2 * nsamples * nchannels * sizeof(int));
+    return size;
+}
+
+size_t xll_get_reserve_size(struct xll_decoder *xll, struct exss_asset *asset)
+{
+    // Channel sets above 96 kHz are split in two frequency bands
+    int nfreqbands = asset->max_sample_rate > 96000 ? XLL_MAX_BANDS : 1;
+    int nchannels = 0;
+    size_t size = 0;
+
+    for (int i = 0; i < xll->nchsets; i++) {
+        struct xll_chset *chs = &xll->chset[i];
+        size += chs_get_reserve_size(xll, chs, chs->nchannels, DCA_MAX(chs->nfreqbands, nfreqbands));
+        nchannels += chs->nchannels;
+    }
+
+    // Channel sets for channels of the asset missing so far reallocate the
+    // channel set array, and with it all buffers below it. Reserved as one
+    // set per channel, which needs the most headers.
+    if (nchannels < asset->nchannels_total) {
+        size += ta_get_arena_block_size(xll, asset->nchannels_total * sizeof(struct xll_chset));
+        for (int ch = 0; ch < asset->nchannels_total; ch++) {
+            size += chs_get_reserve_size(xll, NULL, 1, nfreqbands);
+            size += ta_get_arena_block_size(xll->chset, asset->nchannels_total * 2 * sizeof(int));
+        }
+        size += ta_get_arena_block_size(xll, 1024 * sizeof(*xll->navi));
+    }
+
+    // Frames split across packets are put together in the PBR buffer
+    if (asset->xll_sync_present && !xll->pbr_buffer)
+        size += ta_get_arena_block_size(xll, XLL_PBR_BUFFER_SIZE + DCADEC_BUFFER_PADDING);
+
+    return size;
+}
@@ -150,8 +150,10 @@ struct xll_decoder {
     int     hd_stream_id;   ///< Previous DTS-HD stream ID for detecting changes
 
     uint8_t     *pbr_buffer;    ///< Peak bit rate (PBR) smoothing buffer
+    int         pbr_start;      ///< Offset of data currently buffered
     int         pbr_length;     ///< Length in bytes of data currently buffered
     int         pbr_delay;      ///< Delay in frames before decoding buffered data
+    int         pbr_copied;     ///< Bytes copied into PBR buffer by last frame
 };
 
 void xll_clear_band_data(struct xll_chset *chs, int band) __attribute__((cold));
@@ -162,5 +164,7 @@ int xll_assemble_freq_bands(struct xll_decoder *xll);
 int xll_map_ch_to_spkr(struct xll_chset *chs, int ch);
 int xll_parse(struct xll_decoder *xll, uint8_t *data, struct exss_asset *asset);
 void xll_clear(struct xll_decoder *xll) __attribute__((cold));
+void xll_trim(struct xll_decoder *xll) __attribute__((cold));
+size_t xll_get_reserve_size(struct xll_decoder *xll, struct exss_asset *asset) __attribute__((cold));
 
 #endif